@@ -39,6 +39,16 @@
 #define Yellow          0xFFE0      /* 255, 255, 0   */
 #define White           0xFFFF      /* 255, 255, 255 */
 
+/* GLCD_BitmapIdx formats: bits per palette index, rows top down unless       */
+/* GLCD_BOTTOM_UP; each row starts on a byte, first pixel in the MSB.         */
+/* A 1 bpp image with no palette draws 1 in text, 0 in back colour.           */
+#define GLCD_IDX1       0x001
+#define GLCD_IDX2       0x002
+#define GLCD_IDX4       0x004
+#define GLCD_IDX8       0x008
+#define GLCD_IDX_BPP    0x00F       /* bits per pixel field                */
+#define GLCD_BOTTOM_UP  0x100
+
 extern void GLCD_Init           (void);
 extern void GLCD_WindowMax      (void);
 extern void GLCD_PutPixel       (unsigned int x, unsigned int y);
@@ -51,6 +61,9 @@ extern void GLCD_DisplayString  (unsigned int ln, unsigned int col, unsigned cha
 extern void GLCD_ClearLn        (unsigned int ln, unsigned char fi);
 extern void GLCD_Bargraph       (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned int val);
 extern void GLCD_Bitmap         (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned char *bitmap);
+extern void GLCD_DrawCharRLE    (unsigned int x,  unsigned int y, unsigned int cw, unsigned int ch, const unsigned char *c);
+extern void GLCD_BitmapRLE      (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, const unsigned char *rle);
+extern void GLCD_BitmapIdx      (unsigned int x,  unsigned int y, unsigned int w, unsigned int h, unsigned int fmt, const unsigned short *lut, const unsigned char *bitmap);
 extern void GLCD_ScrollVertical (unsigned int dy);
 
 extern void GLCD_WrCmd          (unsigned char cmd);
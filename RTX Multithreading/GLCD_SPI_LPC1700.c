@@ -12,8 +12,12 @@
 
 #include <lpc17xx.h>
 #include "GLCD.h"
+#include "font_subset.h"
+#include "glcd_rle.h"
+#if !FONT_SUBSET
 #include "Font_6x8_h.h"
 #include "Font_16x24_h.h"
+#endif
 
 /************************** Orientation  configuration ************************/
 
@@ -752,24 +756,79 @@ void GLCD_DrawChar (unsigned int x, unsigned int y, unsigned int cw, unsigned in
 }
 
 
+/*******************************************************************************
+* Draw run-length coded character on given position (format in glcd_rle.h)     *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   cw:       character width in pixel                         *
+*                   ch:       character height in pixels                       *
+*                   c:        pointer to coded character                       *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_DrawCharRLE (unsigned int x, unsigned int y, unsigned int cw, unsigned int ch, const unsigned char *c) {
+  unsigned int n, i, k, b;
+  unsigned short col;
+
+  GLCD_SetWindow(x, y, cw, ch);
+
+  wr_cmd(0x22);
+  wr_dat_start();
+
+  for (n = cw * ch; n != 0; n -= k) {
+    b = *c++;
+    if (b & RLE_RUN) {                  /* run: one colour, no flash reads   */
+      k   = (b & RLE_G_LEN) + 1;
+      if (k > n) k = n;
+      col = Color[(b & RLE_G_COLOR) != 0];
+      for (i = 0; i < k; i++) {
+        wr_dat_only (col);
+      }
+    }
+    else {                              /* literal: 7 pixels, bit 0 first    */
+      k = (n < RLE_G_LIT) ? n : RLE_G_LIT;
+      for (i = 0; i < k; i++) {
+        wr_dat_only (Color[(b >> i) & 1]);
+      }
+    }
+  }
+  wr_dat_stop();
+}
+
+
 /*******************************************************************************
 * Disply character on given line                                               *
 *   Parameter:      ln:       line number                                      *
 *                   col:      column number                                    *
 *                   fi:       font index (0 = 6x8, 1 = 16x24)                  *
-*                   c:        ascii character                                  *
+*                   c:        ascii character (FONT_FALLBACK if no glyph)      *
 *   Return:                                                                    *
 *******************************************************************************/
 
 void GLCD_DisplayChar (unsigned int ln, unsigned int col, unsigned char fi, unsigned char c) {
+#if FONT_RLE
+  unsigned int g = font_sub_slot(c);
+  const unsigned char  *f0 = font_sub_6x8;
+#elif FONT_SUBSET
+  unsigned int g = font_sub_slot(c);
+  const unsigned char  *f0 = font_sub_6x8;
+  const unsigned short *f1 = font_sub_16x24;
+#else
+  unsigned int g = font_full_slot(c);
+  const unsigned char  *f0 = Font_6x8_h;
+  const unsigned short *f1 = Font_16x24_h;
+#endif
 
-  c -= 32;
   switch (fi) {
     case 0:  /* Font 6 x 8 */
-      GLCD_DrawChar(col *  6, ln *  8,  6,  8, (unsigned char *)&Font_6x8_h  [c * 8]);
+      GLCD_DrawChar(col *  6, ln *  8,  6,  8, (unsigned char *)&f0[g * 8]);
       break;
     case 1:  /* Font 16 x 24 */
-      GLCD_DrawChar(col * 16, ln * 24, 16, 24, (unsigned char *)&Font_16x24_h[c * 24]);
+#if FONT_RLE
+      GLCD_DrawCharRLE(col * 16, ln * 24, 16, 24, &font_sub_16x24_rle[font_sub_16x24_off[g]]);
+#else
+      GLCD_DrawChar(col * 16, ln * 24, 16, 24, (unsigned char *)&f1[g * 24]);
+#endif
       break;
   }
 }
@@ -878,6 +937,114 @@ void GLCD_Bitmap (unsigned int x, unsigned int y, unsigned int w, unsigned int h
 }
 
 
+/*******************************************************************************
+* Display run-length coded bitmap image at position x horizontally and y       *
+* vertically (format in glcd_rle.h, rows top down)                             *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   w:        width of bitmap                                  *
+*                   h:        height of bitmap                                 *
+*                   rle:      address at which the coded bitmap resides        *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_BitmapRLE (unsigned int x, unsigned int y, unsigned int w, unsigned int h, const unsigned char *rle) {
+  unsigned int n, i, k, b;
+  unsigned char hi, lo;
+
+  GLCD_SetWindow (x, y, w, h);
+
+  wr_cmd(0x22);
+  wr_dat_start();
+  for (n = w * h; n != 0; n -= k) {
+    b = *rle++;
+    if (b & RLE_RUN) {                  /* run: one pixel, sent k times      */
+      k  = (b & RLE_B_LEN) + RLE_B_RUN_MIN;
+      hi = rle[0];
+      lo = rle[1];
+      rle += 2;
+      if (k > n) k = n;
+      for (i = 0; i < k; i++) {
+        spi_tran(hi);
+        spi_tran(lo);
+      }
+    }
+    else {                              /* literal: bytes go out as stored   */
+      k = b + 1;
+      if (k > n) k = n;
+      for (i = 0; i < k; i++) {
+        spi_tran(*rle++);
+        spi_tran(*rle++);
+      }
+    }
+  }
+  wr_dat_stop();
+}
+
+
+/*******************************************************************************
+* Display palette-indexed bitmap image at position x horizontally and y        *
+* vertically, each index looked up in lut as it goes out                       *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   w:        width of bitmap                                  *
+*                   h:        height of bitmap                                 *
+*                   fmt:      GLCD_IDX1/2/4/8, optionally | GLCD_BOTTOM_UP     *
+*                   lut:      RGB565 palette, 1 << bpp entries (1 bpp: may be  *
+*                             0 for text colour on back colour)                *
+*                   bitmap:   address at which the indices reside              *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void GLCD_BitmapIdx (unsigned int x, unsigned int y, unsigned int w, unsigned int h,
+                     unsigned int fmt, const unsigned short *lut, const unsigned char *bitmap) {
+  unsigned int bpp = fmt & GLCD_IDX_BPP, mask = (1 << bpp) - 1;
+  unsigned int stride = (w * bpp + 7) / 8;
+  unsigned int i, j, b, sh;
+  const unsigned char *row, *p;
+  unsigned short mono[2];
+  int step;
+
+  if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) return;
+  if (lut == 0) {
+    if (bpp != 1) return;
+    mono[0] = Color[BG_COLOR];
+    mono[1] = Color[TXT_COLOR];
+    lut = mono;
+  }
+  if (fmt & GLCD_BOTTOM_UP) {           /* last row in memory goes first     */
+    row  = bitmap + (h - 1) * stride;
+    step = -(int)stride;
+  }
+  else {
+    row  = bitmap;
+    step = (int)stride;
+  }
+
+  GLCD_SetWindow (x, y, w, h);
+
+  wr_cmd(0x22);
+  wr_dat_start();
+  for (j = 0; j < h; j++, row += step) {
+    p = row;
+    if (bpp == 8) {                     /* one index per byte                */
+      for (i = 0; i < w; i++) {
+        wr_dat_only (lut[p[i]]);
+      }
+    }
+    else {                              /* 8/bpp indices per byte, MSB first */
+      for (i = 0; i < w; ) {
+        b = *p++;
+        for (sh = 8; sh != 0 && i < w; i++) {
+          sh -= bpp;
+          wr_dat_only (lut[(b >> sh) & mask]);
+        }
+      }
+    }
+  }
+  wr_dat_stop();
+}
+
 
 /*******************************************************************************
 * Scroll content of the whole display for dy pixels vertically                 *
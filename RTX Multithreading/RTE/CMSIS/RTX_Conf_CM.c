@@ -24,7 +24,9 @@
  *---------------------------------------------------------------------------*/
  
 #include "cmsis_os.h"
+#include "../../hrclock.h"
 unsigned int countIDLE = 0;
+volatile uint32_t g_idle_cyc = 0;       // core cycles in the idle loop (telem.c)
 
 /*----------------------------------------------------------------------------
  *      RTX User configuration part BEGIN
@@ -128,6 +130,9 @@ unsigned int countIDLE = 0;
 // ===============================
 //
 // <i> Enables Round-Robin Thread switching.
+#if defined(RR_SLICE) && !defined(OS_ROBIN)
+ #define OS_ROBIN       0        // rr_slice.c slices equal-priority threads itself
+#endif
 #ifndef OS_ROBIN
  #define OS_ROBIN       1
 #endif
@@ -215,9 +220,14 @@ unsigned int countIDLE = 0;
 /// \brief The idle demon is running when no other thread is ready to run
 void os_idle_demon (void) {
  
+  uint32_t last = hrclock_cyc32(), now;
+
   for (;;) {
     /* HERE: include optional user code to be executed when no thread runs.*/
 		countIDLE++;
+		now = hrclock_cyc32();
+		if (now - last < 32u) g_idle_cyc += now - last;   // longer: an ISR or a thread ran
+		last = now;
 	}
 }
  
@@ -300,6 +310,13 @@ void os_error (uint32_t error_code) {
  
 #include "RTX_CM_lib.h"
  
+/*----------------------------------------------------------------------------
+ *      Keep time_units.h in step with the kernel timer settings above
+ *---------------------------------------------------------------------------*/
+#include "../../time_units.h"
+TU_STATIC_ASSERT(os_clock_mirror, OS_CLOCK == TU_OS_CLOCK);
+TU_STATIC_ASSERT(os_tick_mirror,  OS_TICK  == TU_OS_TICK);
+ 
 /*----------------------------------------------------------------------------
  * end of file
  *---------------------------------------------------------------------------*/
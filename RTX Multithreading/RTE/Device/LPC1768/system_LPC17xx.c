@@ -539,3 +539,16 @@ void SystemInit (void)
   LPC_SC->FLASHCFG  = (LPC_SC->FLASHCFG & ~0x0000F000) | FLASHCFG_Val;
 #endif
 }
+
+/*----------------------------------------------------------------------------
+  Keep time_units.h in step with the clock setup above
+ *----------------------------------------------------------------------------*/
+#include "../../../time_units.h"
+TU_STATIC_ASSERT(clock_setup,      CLOCK_SETUP == 1 && PLL0_SETUP == 1);
+TU_STATIC_ASSERT(xtal_mirror,      XTAL          == TU_XTAL_HZ);
+TU_STATIC_ASSERT(clksrcsel_mirror, CLKSRCSEL_Val == TU_CLKSRCSEL);
+TU_STATIC_ASSERT(pll0cfg_mirror,   PLL0CFG_Val   == TU_PLL0CFG);
+TU_STATIC_ASSERT(cclkcfg_mirror,   CCLKCFG_Val   == TU_CCLKCFG);
+TU_STATIC_ASSERT(pclksel0_mirror,  PCLKSEL0_Val  == TU_PCLKSEL0);
+TU_STATIC_ASSERT(pclksel1_mirror,  PCLKSEL1_Val  == TU_PCLKSEL1);
+TU_STATIC_ASSERT(core_clock,       __CORE_CLK    == TU_CCLK_HZ);
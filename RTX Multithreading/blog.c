@@ -0,0 +1,51 @@
+/* COE718 Lab 3a - deferred binary logging, see blog.h */
+
+#include "blog.h"
+#include "cmsis_os.h"
+#include "LPC17xx.h"            /* __LDREXW/__STREXW */
+#include "hrclock.h"
+
+blog_ring_t g_blog;
+
+static void (*blog_lcd_sink)(unsigned int line, const char *txt);
+
+void blog_init(void)
+{
+  g_blog.magic    = BLOG_MAGIC;
+  g_blog.slots    = BLOG_SLOTS;
+  g_blog.rec_size = sizeof(blog_rec_t);
+  g_blog.head     = 0u;
+}
+
+void blog_set_lcd_sink(void (*sink)(unsigned int line, const char *txt))
+{
+  blog_lcd_sink = sink;
+}
+
+/* Any thread may emit: the slot is claimed with LDREX/STREX on head, then
+   filled without further synchronisation.  Oldest records are overwritten. */
+void blog_emit(uint8_t lcd_line, uint16_t id, uint32_t nargs,
+               uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+  uint32_t h;
+  blog_rec_t *r;
+
+  do {
+    h = __LDREXW(&g_blog.head);
+  } while (__STREXW(h + 1u, &g_blog.head));
+
+  r = &g_blog.rec[h & (BLOG_SLOTS - 1u)];
+  r->ts       = hrclock_cyc32();
+  r->id       = id;
+  r->lcd_line = lcd_line;
+  r->nargs    = (uint8_t)nargs;
+  r->arg[0] = a0; r->arg[1] = a1; r->arg[2] = a2; r->arg[3] = a3;
+
+#if BLOG_LCD
+  if (lcd_line != BLOG_NO_LCD && blog_lcd_sink) {
+    char txt[32];
+    (void)blog_format(txt, sizeof(txt), r);
+    blog_lcd_sink(lcd_line, txt);
+  }
+#endif
+}
@@ -0,0 +1,64 @@
+/* COE718 Lab 3a - deferred binary logging
+ *
+ * A call site stores a message id and up to four raw integers into a RAM
+ * ring; no text is built on the target.  Halt, dump g_blog with
+ *
+ *   SAVE blog.hex &g_blog, ((char*)&g_blog) + sizeof(g_blog) - 1
+ *
+ * and run tools/blog_decode to get the text back from blog_msgs.h.
+ *
+ * With BLOG_LCD=1 (demo builds) each record that carries an LCD line is
+ * also rendered through the sink set by blog_set_lcd_sink(), so the same
+ * record drives the status lines.  The caller must already own the LCD.
+ */
+#pragma once
+#include <stdint.h>
+
+#ifndef BLOG_LCD
+# define BLOG_LCD        0
+#endif
+
+#define BLOG_SLOTS       64u          /* power of two */
+#define BLOG_MAX_ARGS    4u
+#define BLOG_MAGIC       0x31474C42u  /* "BLG1" */
+#define BLOG_NO_LCD      0xFFu
+
+#define BLOG_MSG(id, fmt) id,
+typedef enum {
+#include "blog_msgs.h"
+  BLOG_MSG_COUNT
+} blog_id_t;
+#undef BLOG_MSG
+
+typedef struct {
+  uint32_t ts;                        /* hrclock_cyc32() at emit */
+  uint16_t id;                        /* blog_id_t */
+  uint8_t  lcd_line;                  /* BLOG_NO_LCD or text line */
+  uint8_t  nargs;
+  uint32_t arg[BLOG_MAX_ARGS];
+} blog_rec_t;                         /* 24 bytes */
+
+typedef struct {
+  uint32_t          magic;
+  uint32_t          slots;
+  uint32_t          rec_size;
+  volatile uint32_t head;             /* total records ever emitted */
+  blog_rec_t        rec[BLOG_SLOTS];  /* oldest overwritten first */
+} blog_ring_t;
+
+extern blog_ring_t g_blog;
+
+void blog_init(void);
+void blog_emit(uint8_t lcd_line, uint16_t id, uint32_t nargs,
+               uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+void blog_set_lcd_sink(void (*sink)(unsigned int line, const char *txt));
+
+/* Formats one record; shared by the LCD renderer and the host decoder.
+   Returns the number of characters written (dst is always terminated). */
+unsigned int blog_format(char *dst, unsigned int size, const blog_rec_t *r);
+const char  *blog_fmt_of(uint16_t id);
+
+#define BLOG0(ln, id)                 blog_emit((ln), (id), 0u, 0u, 0u, 0u, 0u)
+#define BLOG1(ln, id, a)              blog_emit((ln), (id), 1u, (uint32_t)(a), 0u, 0u, 0u)
+#define BLOG2(ln, id, a, b)           blog_emit((ln), (id), 2u, (uint32_t)(a), (uint32_t)(b), 0u, 0u)
+#define BLOG4(ln, id, a, b, c, d)     blog_emit((ln), (id), 4u, (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d))
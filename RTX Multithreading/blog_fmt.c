@@ -0,0 +1,74 @@
+/* COE718 Lab 3a - binary log formatter (target LCD renderer + host decoder)
+ *
+ * Built for the target only when BLOG_LCD=1; analysis builds leave this
+ * file and its string table out.  The host decoder defines BLOG_HOST.
+ */
+
+#include "blog.h"
+
+#if BLOG_LCD || defined(BLOG_HOST)
+
+#define BLOG_MSG(id, fmt) fmt,
+static const char *const blog_fmt_table[BLOG_MSG_COUNT] = {
+#include "blog_msgs.h"
+};
+#undef BLOG_MSG
+
+const char *blog_fmt_of(uint16_t id)
+{
+  return (id < BLOG_MSG_COUNT) ? blog_fmt_table[id] : 0;
+}
+
+static unsigned int put_num(char *dst, unsigned int room, uint32_t v,
+                            unsigned int base, unsigned int width, char pad)
+{
+  static const char H[16] = "0123456789ABCDEF";
+  char tmp[10];
+  unsigned int n = 0, w = 0;
+  do { tmp[n++] = H[v % base]; v /= base; } while (v && n < sizeof(tmp));
+  while (n < width && n < sizeof(tmp)) tmp[n++] = pad;
+  while (n && w < room) dst[w++] = tmp[--n];
+  return w;
+}
+
+unsigned int blog_format(char *dst, unsigned int size, const blog_rec_t *r)
+{
+  const char *f = blog_fmt_of(r->id);
+  unsigned int o = 0, ai = 0;
+
+  if (size == 0u) return 0u;
+  if (!f) f = "?";
+  while (*f && o + 1u < size) {
+    unsigned int width = 0;
+    char pad = ' ';
+    uint32_t a;
+
+    if (*f != '%') { dst[o++] = *f++; continue; }
+    f++;
+    if (*f == '%') { dst[o++] = *f++; continue; }
+    if (*f == '0') { pad = '0'; f++; }
+    if (*f >= '1' && *f <= '9') { width = (unsigned int)(*f - '0'); f++; }
+    a = (ai < r->nargs && ai < BLOG_MAX_ARGS) ? r->arg[ai] : 0u;
+    ai++;
+
+    switch (*f) {
+      case 'd':
+        if ((int32_t)a < 0) {
+          dst[o++] = '-';
+          a = (uint32_t)(-(int32_t)a);
+          if (o + 1u >= size) break;
+        }
+        o += put_num(&dst[o], size - 1u - o, a, 10u, width, pad);
+        break;
+      case 'u': o += put_num(&dst[o], size - 1u - o, a, 10u, width, pad); break;
+      case 'X': o += put_num(&dst[o], size - 1u - o, a, 16u, width, pad); break;
+      case 'c': dst[o++] = (char)a; break;
+      default:  dst[o++] = '?'; break;
+    }
+    if (*f) f++;
+  }
+  dst[o] = '\0';
+  return o;
+}
+
+#endif /* BLOG_LCD || BLOG_HOST */
@@ -0,0 +1,48 @@
+/* COE718 Lab 3a - binary log message table
+ *
+ * One line per message: BLOG_MSG(id, format).  The target only ever sees
+ * the ids (blog.h turns this list into an enum); the format strings are
+ * compiled in only where text is actually produced: the host decoder in
+ * tools/blog_decode.c and, in the demo builds, the LCD renderer.
+ *
+ * Formats take up to BLOG_MAX_ARGS integer arguments: %u %d %X %c and %%,
+ * with an optional zero flag and one-digit width (e.g. %02u, %08X).
+ * Append new ids at the end so recorded dumps keep decoding.
+ *
+ * No include guard: blog.h and the decoder expand it with their own
+ * definition of BLOG_MSG.
+ */
+
+/* --- shared --- */
+BLOG_MSG(BLOG_ACTIVE_WAITING,  "Active: (waiting)")
+BLOG_MSG(BLOG_ERR_CREATE,      "ERR: thread create")
+BLOG_MSG(BLOG_ERR_CREATE_T,    "ERR: T%u create")
+BLOG_MSG(BLOG_ERR_POOL,        "ERR: msg pool empty")
+
+/* --- thread_demo.c (Q1 round-robin) --- */
+BLOG_MSG(BLOG_ACTIVE_T,        "Active: T%u")
+BLOG_MSG(BLOG_T_DONE,          "T%u Done")
+BLOG_MSG(BLOG_PAINTER,         "Painter: %u/10")
+BLOG_MSG(BLOG_MORSE_DOT,       "Morse: dot (%02u/%02u)")
+BLOG_MSG(BLOG_MORSE_DASH,      "Morse: dash (%02u/%02u)")
+BLOG_MSG(BLOG_MORSE_GAP,       "Morse: gap (%02u/%02u)")
+BLOG_MSG(BLOG_ROBOT,           "Robot: (%02d, %02d) %02u/%02u")
+
+/* --- thread2_demo.c (Q2 OS roles) --- */
+BLOG_MSG(BLOG_ACTIVE_MEMORY,   "Active: Memory")
+BLOG_MSG(BLOG_ACTIVE_CPU,      "Active: CPU")
+BLOG_MSG(BLOG_ACTIVE_APP,      "Active: App")
+BLOG_MSG(BLOG_ACTIVE_DEVICE,   "Active: Device")
+BLOG_MSG(BLOG_ACTIVE_UI,       "Active: User IF")
+BLOG_MSG(BLOG_LOGGER_READY,    "logger ready")
+BLOG_MSG(BLOG_MEM_BITBAND,     "bit-band ops...")
+BLOG_MSG(BLOG_MEM_WORD,        "%08X")
+BLOG_MSG(BLOG_MEM_DONE,        "Memory done")
+BLOG_MSG(BLOG_CPU_ROTATE,      "rotate & reply")
+BLOG_MSG(BLOG_CPU_DONE,        "CPU done")
+BLOG_MSG(BLOG_APP_PREFIX,      "write prefix...")
+BLOG_MSG(BLOG_APP_DONE,        "App done")
+BLOG_MSG(BLOG_DEV_APPEND,      "append & signal")
+BLOG_MSG(BLOG_DEV_DONE,        "Device done")
+BLOG_MSG(BLOG_UI_ONESHOT,      "one-shot task")
+BLOG_MSG(BLOG_UI_DONE,         "UI done")
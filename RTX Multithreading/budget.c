@@ -0,0 +1,170 @@
+/* COE718 Lab 3a - per-thread CPU budgets, see budget.h */
+
+#include "budget.h"
+#include "hrclock.h"
+#include "time_units.h"
+#include "trace.h"
+#include "rtx_internal.h"
+#include "LPC17xx.h"
+
+#define BG_TIMER_PER_US  (TU_TIMER1_HZ / 1000000uL)
+TU_STATIC_ASSERT(bg_timer_whole_mhz, TU_TIMER1_HZ % 1000000uL == 0uL);
+
+bg_thread_t       g_bg[BG_MAX_THREADS];
+bg_log_rec_t      g_bg_log[BG_LOG_SLOTS];
+volatile uint32_t g_bg_log_head = 0;
+
+static volatile uint32_t bg_n;
+static uint32_t          bg_now;        /* samples since bg_init() */
+static uint8_t           bg_kick;
+static osThreadId        bg_tid;
+
+/* ------------------- Sampling ISR ------------------- */
+static void bg_close(bg_thread_t *b)
+{
+  b->open = 0u;
+  if (!b->chunk) return;
+  if (b->n_repl < BG_REPL_SLOTS) {
+    b->repl[b->n_repl].at     = b->chunk_start + b->period;
+    b->repl[b->n_repl].amount = b->chunk;
+    b->n_repl++;
+  } else {                              /* merge into the latest: later is safe */
+    b->repl[BG_REPL_SLOTS - 1u].at      = b->chunk_start + b->period;
+    b->repl[BG_REPL_SLOTS - 1u].amount += b->chunk;
+  }
+  b->chunk = 0u;
+}
+
+static void bg_overrun(bg_thread_t *b, uint32_t k)
+{
+  bg_log_rec_t *r = &g_bg_log[g_bg_log_head++ & (BG_LOG_SLOTS - 1u)];
+
+  b->st.overruns++;
+  r->ts     = hrclock_cyc32();
+  r->thread = (uint8_t)k;
+  r->seq    = (uint16_t)b->st.overruns;
+  trace_event(TR_BUDGET_OVERRUN, TRACE_NO_THREAD, (uint16_t)k);
+  b->want = 1u;
+  bg_kick = 1u;
+  bg_close(b);
+}
+
+static void bg_charge(bg_thread_t *b, uint32_t k)
+{
+  if (b->want) {                        /* background time is free */
+    b->st.throttled_us += BG_SAMPLE_US;
+    return;
+  }
+  if (!b->open) {
+    b->open        = 1u;
+    b->chunk_start = bg_now;
+  }
+  b->chunk++;
+  b->st.consumed_us += BG_SAMPLE_US;
+  if (--b->left <= 0) bg_overrun(b, k);
+}
+
+static void bg_replenish(bg_thread_t *b)
+{
+  uint32_t i;
+
+  while (b->n_repl && (int32_t)(bg_now - b->repl[0].at) >= 0) {
+    b->left += (int32_t)b->repl[0].amount;
+    if (b->left > (int32_t)b->budget) b->left = (int32_t)b->budget;
+    for (i = 1; i < b->n_repl; ++i) b->repl[i - 1u] = b->repl[i];
+    b->n_repl--;
+    b->st.replenished++;
+  }
+  if (b->want && b->left > 0) {
+    b->want = 0u;
+    bg_kick = 1u;
+  }
+}
+
+void TIMER1_IRQHandler(void)
+{
+  void    *run = os_tsk.run;
+  uint32_t k, n = bg_n;
+
+  LPC_TIM1->IR = 1u;                    /* MR0 */
+  bg_now++;
+  for (k = 0; k < n; ++k) {
+    bg_thread_t *b = &g_bg[k];
+    if ((void *)b->tid == run) bg_charge(b, k);
+    else if (b->open) bg_close(b);
+    bg_replenish(b);
+  }
+  if (bg_kick) {
+    bg_kick = 0u;
+    osSignalSet(bg_tid, BG_SIG_APPLY);
+  }
+}
+
+/* ------------------- Enforcer ------------------- */
+void bg_enforce(void const *arg)
+{
+  (void)arg;
+  for (;;) {
+    uint32_t k, n;
+
+    osSignalWait(BG_SIG_APPLY, osWaitForever);
+    n = bg_n;
+    for (k = 0; k < n; ++k) {
+      bg_thread_t *b = &g_bg[k];
+      uint8_t w = b->want;
+      if (w == b->applied) continue;
+      (void)osThreadSetPriority(b->tid, w ? b->low : b->prio);
+      b->applied = w;
+      TRACE(w ? TR_BUDGET_THROTTLE : TR_BUDGET_RESTORE, k);
+    }
+  }
+}
+osThreadDef(bg_enforce, osPriorityRealtime, 1, 0);
+
+/* ------------------- Setup ------------------- */
+int bg_init(void)
+{
+  if (bg_tid) return 0;
+  bg_tid = osThreadCreate(osThread(bg_enforce), NULL);
+  if (!bg_tid) return -1;
+  (void)trace_register(bg_tid, "budget");
+
+  LPC_SC->PCONP |= 1u << 2;             /* PCTIM1 */
+  LPC_TIM1->TCR = 2u;
+  LPC_TIM1->PR  = 0u;
+  LPC_TIM1->MR0 = BG_SAMPLE_US * BG_TIMER_PER_US - 1u;
+  LPC_TIM1->MCR = 3u;                   /* interrupt and reset on MR0 */
+  LPC_TIM1->IR  = 0x3Fu;
+  NVIC_SetPriority(TIMER1_IRQn, BG_IRQ_PRIO);
+  NVIC_EnableIRQ(TIMER1_IRQn);
+  LPC_TIM1->TCR = 1u;
+  return 0;
+}
+
+int bg_attach(osThreadId tid, uint32_t budget_us, uint32_t period_us, bg_mode_t mode)
+{
+  uint32_t k = bg_n;
+  bg_thread_t *b;
+  int p;
+
+  if (!tid || k >= BG_MAX_THREADS) return -1;
+  if (budget_us < BG_SAMPLE_US || period_us < budget_us) return -1;
+
+  b = &g_bg[k];
+  b->tid     = tid;
+  b->prio    = osThreadGetPriority(tid);
+  p = (mode == BG_SUSPEND) ? (int)osPriorityIdle : (int)b->prio - 1;
+  b->low     = (osPriority)((p < (int)osPriorityIdle) ? (int)osPriorityIdle : p);
+  b->budget  = budget_us / BG_SAMPLE_US;
+  b->period  = period_us / BG_SAMPLE_US;
+  b->left    = (int32_t)b->budget;
+  b->open    = 0u;
+  b->chunk   = 0u;
+  b->want    = 0u;
+  b->applied = 0u;
+  b->n_repl  = 0u;
+  b->st.consumed_us = b->st.throttled_us = 0u;
+  b->st.overruns    = b->st.replenished  = 0u;
+  bg_n = k + 1u;                        /* publish to the ISR last */
+  return (int)k;
+}
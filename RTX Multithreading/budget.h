@@ -0,0 +1,75 @@
+/* COE718 Lab 3a - per-thread CPU budgets with overrun throttling
+ *
+ * TIMER1 samples the running thread every BG_SAMPLE_US and charges the
+ * sample to it, so a thread's CPU time is counted whether it was sliced by
+ * OS_ROBIN or preempted.  Each attached thread owns a budget per period,
+ * replenished like a sporadic server: CPU time used from the moment the
+ * thread starts running comes back one period after that moment.  A
+ * thread that uses up its budget is logged as an overrun and throttled
+ * until enough budget has been replenished:
+ *
+ *   BG_DEMOTE   one priority step below its own
+ *   BG_SUSPEND  osPriorityIdle, so it only runs when every other thread
+ *               is blocked (CMSIS-RTOS v1 cannot suspend a thread)
+ *
+ * Throttled time is counted but not charged.  The ISR only decides;
+ * priorities are changed by the bg_enforce thread at osPriorityRealtime.
+ * Attached threads must keep their priority otherwise (not with PT_EDF).
+ */
+#pragma once
+#include "cmsis_os.h"
+#include <stdint.h>
+
+#define BG_MAX_THREADS   4u
+#define BG_SAMPLE_US     100u
+#define BG_REPL_SLOTS    4u             /* pending replenishments per thread */
+#define BG_LOG_SLOTS     32u            /* overrun records, power of two */
+#define BG_SIG_APPLY     (1 << 12)
+#define BG_IRQ_PRIO      2u             /* TIMER1 NVIC priority */
+
+typedef enum { BG_DEMOTE = 0, BG_SUSPEND } bg_mode_t;
+
+typedef struct {
+  uint32_t consumed_us;                 /* charged against the budget */
+  uint32_t throttled_us;                /* ran while throttled, free */
+  uint32_t overruns;
+  uint32_t replenished;
+} bg_stat_t;
+
+typedef struct {
+  uint32_t at;                          /* sample count */
+  uint32_t amount;                      /* samples */
+} bg_repl_t;
+
+typedef struct {
+  osThreadId       tid;
+  osPriority       prio;                /* own priority, restored */
+  osPriority       low;                 /* while throttled */
+  uint32_t         budget;              /* samples per period */
+  uint32_t         period;              /* samples */
+  int32_t          left;                /* samples of budget left */
+  uint32_t         chunk_start;         /* current run, for replenishment */
+  uint32_t         chunk;
+  uint8_t          open;
+  volatile uint8_t want;                /* ISR: 1 = throttle */
+  uint8_t          applied;             /* enforcer: priority in force */
+  uint8_t          n_repl;
+  bg_repl_t        repl[BG_REPL_SLOTS];
+  bg_stat_t        st;
+} bg_thread_t;
+
+typedef struct {
+  uint32_t ts;                          /* hrclock_cyc32() */
+  uint8_t  thread;                      /* g_bg index */
+  uint8_t  pad;
+  uint16_t seq;                         /* overrun number of that thread */
+} bg_log_rec_t;
+
+extern bg_thread_t       g_bg[BG_MAX_THREADS];
+extern bg_log_rec_t      g_bg_log[BG_LOG_SLOTS];
+extern volatile uint32_t g_bg_log_head;
+
+int bg_init(void);
+/* Budget and period in us, at least one sample each.  Call from a thread
+   once tid has its final priority; returns the g_bg index or -1. */
+int bg_attach(osThreadId tid, uint32_t budget_us, uint32_t period_us, bg_mode_t mode);
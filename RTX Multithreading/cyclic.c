@@ -0,0 +1,147 @@
+/* COE718 Lab 3a - time-triggered cyclic executive, see cyclic.h */
+
+#include "cyclic.h"
+#include "time_units.h"
+#include "trace.h"
+#include "LPC17xx.h"
+
+#define CE_TIMER_PER_US  (TU_TIMER0_HZ / 1000000uL)
+TU_STATIC_ASSERT(ce_timer_whole_mhz, TU_TIMER0_HZ % 1000000uL == 0uL);
+
+ce_frame_stat_t   g_ce_stat[CE_MAX_FRAMES];
+volatile uint32_t g_ce_major    = 0;
+volatile uint32_t g_ce_overruns = 0;
+volatile uint32_t g_ce_lost     = 0;
+volatile uint8_t  g_ce_active   = 0;
+
+static const ce_table_t *ce_tab;
+static const ce_job_fn_t *ce_jobs;
+static void *const      *ce_ctx;
+static uint32_t          ce_limit;      /* major frames to run, 0 = forever */
+static osThreadId        ce_tid;
+static volatile uint32_t ce_boundary;   /* frame boundaries since start */
+
+/* ------------------- Frame timer ------------------- */
+void TIMER0_IRQHandler(void)
+{
+  LPC_TIM0->IR = 1u;                    /* MR0 */
+  ce_boundary++;
+  osSignalSet(ce_tid, CE_SIG_FRAME);
+}
+
+static void ce_timer_start(uint32_t minor_us)
+{
+  LPC_SC->PCONP |= 1u << 1;             /* PCTIM0 */
+  LPC_TIM0->TCR = 2u;                   /* hold in reset */
+  LPC_TIM0->PR  = 0u;
+  LPC_TIM0->MR0 = minor_us * CE_TIMER_PER_US - 1u;
+  LPC_TIM0->MCR = 3u;                   /* interrupt and reset on MR0 */
+  LPC_TIM0->IR  = 0x3Fu;
+  NVIC_SetPriority(TIMER0_IRQn, CE_IRQ_PRIO);
+  NVIC_EnableIRQ(TIMER0_IRQn);
+  LPC_TIM0->TCR = 1u;
+}
+
+static void ce_timer_stop(void)
+{
+  LPC_TIM0->TCR = 0u;
+  NVIC_DisableIRQ(TIMER0_IRQn);
+  LPC_TIM0->IR  = 0x3Fu;
+}
+
+/* ------------------- Dispatcher ------------------- */
+static void ce_frame_end(uint32_t f, uint32_t boundary)
+{
+  ce_frame_stat_t *s = &g_ce_stat[f];
+  uint32_t tc    = LPC_TIM0->TC;        /* timer counts since the boundary */
+  uint32_t slack = 0u;
+
+  s->runs++;
+  if (ce_boundary != boundary) {        /* next frame already started */
+    s->overruns++;
+    g_ce_overruns++;
+    TRACE(TR_CE_OVERRUN, f);
+  } else {
+    slack = ce_tab->minor_us - tc / CE_TIMER_PER_US;
+  }
+  s->slack_last = slack;
+  if (slack < s->slack_min) s->slack_min = slack;
+}
+
+void ce_dispatch(void const *arg)
+{
+  uint32_t handled = 0u;
+  (void)arg;
+
+  for (;;) {
+    uint32_t now, f, k;
+
+    osSignalWait(CE_SIG_FRAME, osWaitForever);
+    now = ce_boundary;
+    if (now == handled) continue;       /* signal latched during an overrun */
+    g_ce_lost += now - handled - 1u;
+    handled = now;
+
+    f = (now - 1u) % ce_tab->frames;    /* boundary 1 opens frame 0 */
+    TRACE(TR_CE_FRAME, f);
+    for (k = ce_tab->first[f]; k < ce_tab->first[f + 1u]; ++k) {
+      uint8_t i = ce_tab->entry[k];
+      ce_jobs[i](ce_ctx ? ce_ctx[i] : 0);
+    }
+    ce_frame_end(f, now);
+
+    if (f == ce_tab->frames - 1u) {
+      g_ce_major++;
+      if (ce_limit && g_ce_major >= ce_limit) ce_stop();
+    }
+  }
+}
+osThreadDef(ce_dispatch, osPriorityRealtime, 1, 0);
+
+/* ------------------- Setup ------------------- */
+int ce_start(const ce_table_t *tab, const ce_job_fn_t *jobs, void *const *ctx,
+             uint32_t n, uint32_t major_frames)
+{
+  uint32_t f;
+
+  if (g_ce_active || !tab || !jobs) return -1;
+  if (tab->frames == 0u || tab->frames > CE_MAX_FRAMES || tab->minor_us == 0u) return -1;
+  if (n != tab->n_tasks || n > CE_MAX_TASKS) return -1;
+  for (f = 0; f < tab->first[tab->frames]; ++f) {
+    if (tab->entry[f] >= n) return -1;
+  }
+
+  ce_tab        = tab;
+  ce_jobs       = jobs;
+  ce_ctx        = ctx;
+  ce_limit      = major_frames;
+  ce_boundary   = 0u;
+  g_ce_major    = 0u;
+  g_ce_overruns = 0u;
+  g_ce_lost     = 0u;
+  for (f = 0; f < tab->frames; ++f) {
+    g_ce_stat[f].runs       = 0u;
+    g_ce_stat[f].overruns   = 0u;
+    g_ce_stat[f].slack_min  = tab->minor_us;
+    g_ce_stat[f].slack_last = 0u;
+  }
+
+  ce_tid = osThreadCreate(osThread(ce_dispatch), NULL);
+  if (!ce_tid) return -1;
+  (void)trace_register(ce_tid, "cyclic");
+  g_ce_active = 1u;
+  ce_timer_start(tab->minor_us);
+  return 0;
+}
+
+/* From the dispatcher itself or from any other thread */
+void ce_stop(void)
+{
+  osThreadId tid = ce_tid;
+
+  if (!g_ce_active) return;
+  ce_timer_stop();
+  g_ce_active = 0u;
+  ce_tid = 0;
+  (void)osThreadTerminate(tid);         /* no return when tid is us */
+}
@@ -0,0 +1,64 @@
+/* COE718 Lab 3a - time-triggered cyclic executive
+ *
+ * An alternative to OS_ROBIN and to periodic.h for fully static schedules.
+ * tools/cyclic_gen.c turns task periods and WCETs into a ce_table_t: a
+ * major frame (lcm of the periods) cut into equal minor frames, each with
+ * a fixed list of jobs.  TIMER0 interrupts at every minor frame boundary
+ * and wakes one dispatcher thread at osPriorityRealtime, which runs that
+ * frame's jobs in table order and goes back to sleep.  No scheduling
+ * decision is taken at run time; everything else runs in the slack.
+ *
+ * Per minor frame the dispatcher records the slack left at the end of the
+ * frame (frame length - time since the boundary) and counts overruns, a
+ * frame whose jobs were still running at the next boundary.  After an
+ * overrun the dispatcher resynchronises on the current frame; the frames
+ * it skipped are counted in g_ce_lost and their jobs do not run.
+ */
+#pragma once
+#include "cmsis_os.h"
+#include <stdint.h>
+
+#define CE_MAX_TASKS     8u
+#define CE_MAX_FRAMES    64u
+#define CE_SIG_FRAME     (1 << 13)
+#define CE_IRQ_PRIO      1u             /* TIMER0 NVIC priority */
+
+typedef void (*ce_job_fn_t)(void *ctx);
+
+typedef struct {
+  const char *name;
+  uint32_t    period_us;
+  uint32_t    wcet_us;
+} ce_task_info_t;
+
+/* Generated by tools/cyclic_gen.c, see cyclic_table.c */
+typedef struct {
+  uint32_t              minor_us;       /* minor frame length */
+  uint32_t              frames;         /* minor frames per major frame */
+  uint32_t              n_tasks;
+  const ce_task_info_t *task;           /* [n_tasks], for checking only */
+  const uint16_t       *first;          /* [frames + 1] into entry[] */
+  const uint8_t        *entry;          /* task indexes, in run order */
+  const uint32_t       *planned_us;     /* [frames] sum of WCETs */
+} ce_table_t;
+
+typedef struct {
+  uint32_t runs;
+  uint32_t overruns;
+  uint32_t slack_min;                   /* us, 0 after an overrun */
+  uint32_t slack_last;                  /* us */
+} ce_frame_stat_t;
+
+extern const ce_table_t   g_ce_table;  /* cyclic_table.c */
+extern ce_frame_stat_t    g_ce_stat[CE_MAX_FRAMES];
+extern volatile uint32_t  g_ce_major;  /* completed major frames */
+extern volatile uint32_t  g_ce_overruns;
+extern volatile uint32_t  g_ce_lost;   /* minor frames skipped */
+extern volatile uint8_t   g_ce_active;
+
+/* jobs[i] runs task i of the table.  Runs for major_frames major frames
+   (0 = forever).  Returns -1 on a table that does not fit CE_MAX_*, on a
+   task count mismatch, or when the dispatcher cannot be created. */
+int  ce_start(const ce_table_t *tab, const ce_job_fn_t *jobs, void *const *ctx,
+              uint32_t n, uint32_t major_frames);
+void ce_stop(void);
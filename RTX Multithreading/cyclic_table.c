@@ -0,0 +1,40 @@
+/* COE718 Lab 3a - cyclic executive schedule table
+ *
+ * Generated by tools/cyclic_gen.c, do not edit:
+ *   cyclic_gen -o cyclic_table.c Painter:10:3500 Morse:20:4000 Robot:25:3500
+ *
+ * major 100000 us, minor 10000 us, 10 frames, planned load 69.0 %
+ */
+#include "cyclic.h"
+
+static const ce_task_info_t ce_tasks[3] = {
+  { "Painter", 10000u, 3500u },
+  { "Morse", 20000u, 4000u },
+  { "Robot", 25000u, 3500u },
+};
+
+static const uint8_t ce_entry[19] = {
+  /*  0 */ 0, 1,
+  /*  1 */ 0, 2,
+  /*  2 */ 0, 1,
+  /*  3 */ 0, 2,
+  /*  4 */ 0, 1,
+  /*  5 */ 0, 2,
+  /*  6 */ 0, 1,
+  /*  7 */ 0,
+  /*  8 */ 0, 2,
+  /*  9 */ 1, 0,
+};
+
+static const uint16_t ce_first[11] = {
+  0, 2, 4, 6, 8, 10, 12, 14, 15, 17, 19
+};
+
+static const uint32_t ce_planned_us[10] = {
+  7500u, 7000u, 7500u, 7000u, 7500u, 7000u, 7500u, 3500u,
+  7000u, 7500u,
+};
+
+const ce_table_t g_ce_table = {
+  10000u, 10u, 3u, ce_tasks, ce_first, ce_entry, ce_planned_us
+};
@@ -0,0 +1,153 @@
+/* COE718 Lab 3a - earliest-deadline-first layer, see edf.h */
+
+#include "edf.h"
+#include "trace.h"
+#include "LPC17xx.h"            /* __LDREXW/__STREXW */
+
+#define EDF_NONE   0xFFu
+
+volatile uint32_t g_edf_remaps = 0;
+
+/* heap and priorities are touched by the manager thread only */
+static pt_task_t *edf_heap[PT_MAX_TASKS];
+static uint32_t   edf_count;
+static osThreadId edf_tid;
+
+/* pending requests, one bit per g_pt_task index */
+static volatile uint32_t edf_released, edf_completed;
+
+/* ------------------- Deadline heap ------------------- */
+static int edf_before(const pt_task_t *a, const pt_task_t *b)
+{
+  return (int32_t)(a->abs_deadline - b->abs_deadline) < 0;
+}
+
+static void heap_set(uint32_t i, pt_task_t *t)
+{
+  edf_heap[i] = t;
+  t->heap_pos = (uint8_t)i;
+}
+
+static void heap_up(uint32_t i, pt_task_t *t)
+{
+  while (i > 0u) {
+    uint32_t p = (i - 1u) / 2u;
+    if (!edf_before(t, edf_heap[p])) break;
+    heap_set(i, edf_heap[p]);
+    i = p;
+  }
+  heap_set(i, t);
+}
+
+static void heap_down(uint32_t i, pt_task_t *t)
+{
+  for (;;) {
+    uint32_t c = 2u * i + 1u;
+    if (c >= edf_count) break;
+    if (c + 1u < edf_count && edf_before(edf_heap[c + 1u], edf_heap[c])) c++;
+    if (!edf_before(edf_heap[c], t)) break;
+    heap_set(i, edf_heap[c]);
+    i = c;
+  }
+  heap_set(i, t);
+}
+
+static void heap_remove(pt_task_t *t)
+{
+  uint32_t i = t->heap_pos;
+  pt_task_t *last;
+
+  t->heap_pos = EDF_NONE;
+  last = edf_heap[--edf_count];
+  if (i == edf_count) return;           /* removed the tail */
+  if (i > 0u && edf_before(last, edf_heap[(i - 1u) / 2u])) heap_up(i, last);
+  else heap_down(i, last);
+}
+
+static void edf_prio(pt_task_t *t, osPriority p)
+{
+  if (t->prio == p) return;
+  t->prio = p;
+  (void)osThreadSetPriority(t->tid, p);
+  g_edf_remaps++;
+}
+
+static void edf_do_release(pt_task_t *t)
+{
+  pt_task_t *head = edf_count ? edf_heap[0] : 0;
+
+  heap_up(edf_count++, t);
+  if (edf_heap[0] == t) {
+    if (head) edf_prio(head, PT_EDF_LOW);
+    edf_prio(t, PT_PRIO_TOP);
+  } else {
+    edf_prio(t, PT_EDF_LOW);
+  }
+}
+
+static void edf_do_complete(pt_task_t *t)
+{
+  if (t->heap_pos != EDF_NONE) heap_remove(t);
+  if (edf_count) edf_prio(edf_heap[0], PT_PRIO_TOP);
+}
+
+/* ------------------- Manager thread ------------------- */
+static uint32_t edf_take(volatile uint32_t *mask)
+{
+  uint32_t m;
+  do {
+    m = __LDREXW(mask);
+  } while (__STREXW(0u, mask));
+  return m;
+}
+
+static void edf_post(volatile uint32_t *mask, const pt_task_t *t)
+{
+  uint32_t m;
+  do {
+    m = __LDREXW(mask) | (1uL << t->index);
+  } while (__STREXW(m, mask));
+  osSignalSet(edf_tid, EDF_SIG_REQ);
+}
+
+/* A task's completion is always posted before the timer can release it
+   again (busy is cleared after edf_complete()), so completions go first. */
+void edf_manager(void const *arg);
+osThreadDef(edf_manager, EDF_MGR_PRIO, 1, 0);
+
+void edf_manager(void const *arg)
+{
+  uint32_t m;
+  (void)arg;
+
+  for (;;) {
+    (void)osSignalWait(EDF_SIG_REQ, osWaitForever);
+    for (m = edf_take(&edf_completed); m; m &= m - 1u) edf_do_complete(&g_pt_task[__CLZ(__RBIT(m))]);
+    for (m = edf_take(&edf_released);  m; m &= m - 1u) edf_do_release(&g_pt_task[__CLZ(__RBIT(m))]);
+  }
+}
+
+/* ------------------- API ------------------- */
+int edf_init(void)
+{
+  edf_count     = 0u;
+  edf_released  = 0u;
+  edf_completed = 0u;
+  if (!edf_tid) {
+    edf_tid = osThreadCreate(osThread(edf_manager), NULL);
+    if (!edf_tid) return -1;
+    (void)trace_register(edf_tid, "edf");
+  }
+  return 0;
+}
+
+/* timer context: never waits */
+void edf_release(pt_task_t *t)
+{
+  edf_post(&edf_released, t);
+}
+
+void edf_complete(pt_task_t *t)
+{
+  edf_post(&edf_completed, t);
+}
@@ -0,0 +1,27 @@
+/* COE718 Lab 3a - earliest-deadline-first layer over RTX priorities
+ *
+ * RTX only schedules by fixed priority, so EDF is emulated with a band of
+ * two priorities: the ready job with the earliest absolute deadline runs at
+ * PT_PRIO_TOP, every other ready job waits at PT_EDF_LOW.  Ready jobs sit
+ * in a binary min-heap keyed on the deadline (O(log n) insert/remove), and
+ * a release or completion changes at most two thread priorities.
+ *
+ * Called by periodic.c only: edf_release() from the release timer before
+ * the job is signalled, edf_complete() from the task thread when its job
+ * has finished.  Neither blocks: each sets the task's bit in a request
+ * mask and signals the EDF manager thread, which owns the heap and does
+ * the remapping.  It runs at EDF_MGR_PRIO, above every task, so the
+ * priorities are in place before a released job can run.  Deadlines
+ * compare wrap-safe, in kernel ticks.
+ */
+#pragma once
+#include "periodic.h"
+
+#define EDF_MGR_PRIO     osPriorityHigh /* above PT_PRIO_TOP */
+#define EDF_SIG_REQ      (1 << 13)
+
+int  edf_init(void);                    /* creates the manager once */
+void edf_release(pt_task_t *t);         /* t->abs_deadline already set */
+void edf_complete(pt_task_t *t);
+
+extern volatile uint32_t g_edf_remaps;  /* osThreadSetPriority() calls */
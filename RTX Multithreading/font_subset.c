@@ -0,0 +1,674 @@
+/* COE718 Lab 3a - subset fonts, see font_subset.h
+ *
+ * Generated by tools/font_gen.c, do not edit:
+ *   font_gen -o font_subset.c blog_msgs.h thread_demo.c thread2_demo.c
+ *
+ * 60 glyphs:  #&(),-./0123456789:>?ABCDEFIMOPQRSTUabcdefghiklmnoprstuvwxy
+ * 3476 bytes instead of 6272 for the full fonts, 2796 saved
+ * FONT_RLE=1: 2744 bytes, 16x24 glyphs 2148 instead of 2880 with offsets
+ */
+#include "font_subset.h"
+
+#if FONT_SUBSET
+
+const uint32_t font_sub_count = 60u;
+
+/* character code - FONT_FIRST -> slot */
+const uint8_t font_sub_map[FONT_CHARS] = {
+   1,  0,  0,  2,  0,  0,  3,  0,  4,  5,  0,  0,  6,  7,  8,  9,
+  10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,  0,  0,  0, 21,  0,
+   0, 22, 23, 24, 25, 26, 27,  0,  0, 28,  0,  0,  0, 29,  0, 30,
+  31, 32, 33, 34, 35, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0, 37, 38, 39, 40, 41, 42, 43, 44, 45,  0, 46, 47, 48, 49, 50,
+  51,  0, 52, 53, 54, 55, 56, 57, 58, 59,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+const uint8_t font_sub_6x8[480] = {
+  /*  0: 0x3F */
+  0x0E, 0x11, 0x10, 0x0C, 0x04, 0x00, 0x04, 0x00,
+  /*  1: 0x20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /*  2: 0x23 */
+  0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A, 0x00,
+  /*  3: 0x26 */
+  0x02, 0x05, 0x05, 0x02, 0x15, 0x09, 0x16, 0x00,
+  /*  4: 0x28 */
+  0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00,
+  /*  5: 0x29 */
+  0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00,
+  /*  6: 0x2C */
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x04, 0x02,
+  /*  7: 0x2D */
+  0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00,
+  /*  8: 0x2E */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00,
+  /*  9: 0x2F */
+  0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00,
+  /* 10: 0x30 */
+  0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E, 0x00,
+  /* 11: 0x31 */
+  0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00,
+  /* 12: 0x32 */
+  0x0E, 0x11, 0x10, 0x0E, 0x01, 0x01, 0x1F, 0x00,
+  /* 13: 0x33 */
+  0x1F, 0x10, 0x08, 0x0C, 0x10, 0x11, 0x0E, 0x00,
+  /* 14: 0x34 */
+  0x08, 0x0C, 0x0A, 0x09, 0x1F, 0x08, 0x08, 0x00,
+  /* 15: 0x35 */
+  0x1F, 0x01, 0x0F, 0x10, 0x10, 0x11, 0x0E, 0x00,
+  /* 16: 0x36 */
+  0x1C, 0x02, 0x01, 0x0F, 0x11, 0x11, 0x0E, 0x00,
+  /* 17: 0x37 */
+  0x1F, 0x10, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00,
+  /* 18: 0x38 */
+  0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E, 0x00,
+  /* 19: 0x39 */
+  0x0E, 0x11, 0x11, 0x1E, 0x10, 0x08, 0x07, 0x00,
+  /* 20: 0x3A */
+  0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+  /* 21: 0x3E */
+  0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00,
+  /* 22: 0x41 */
+  0x04, 0x0A, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x00,
+  /* 23: 0x42 */
+  0x0F, 0x11, 0x11, 0x0F, 0x11, 0x11, 0x0F, 0x00,
+  /* 24: 0x43 */
+  0x0E, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0E, 0x00,
+  /* 25: 0x44 */
+  0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x00,
+  /* 26: 0x45 */
+  0x1F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x1F, 0x00,
+  /* 27: 0x46 */
+  0x1F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x00,
+  /* 28: 0x49 */
+  0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00,
+  /* 29: 0x4D */
+  0x11, 0x1B, 0x15, 0x15, 0x15, 0x11, 0x11, 0x00,
+  /* 30: 0x4F */
+  0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00,
+  /* 31: 0x50 */
+  0x0F, 0x11, 0x11, 0x0F, 0x01, 0x01, 0x01, 0x00,
+  /* 32: 0x51 */
+  0x0E, 0x11, 0x11, 0x11, 0x15, 0x09, 0x16, 0x00,
+  /* 33: 0x52 */
+  0x0F, 0x11, 0x11, 0x0F, 0x05, 0x09, 0x11, 0x00,
+  /* 34: 0x53 */
+  0x0E, 0x11, 0x01, 0x0E, 0x10, 0x11, 0x0E, 0x00,
+  /* 35: 0x54 */
+  0x1F, 0x15, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+  /* 36: 0x55 */
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00,
+  /* 37: 0x61 */
+  0x00, 0x00, 0x06, 0x08, 0x0E, 0x09, 0x1E, 0x00,
+  /* 38: 0x62 */
+  0x01, 0x01, 0x0D, 0x13, 0x11, 0x13, 0x0D, 0x00,
+  /* 39: 0x63 */
+  0x00, 0x00, 0x0E, 0x11, 0x01, 0x11, 0x0E, 0x00,
+  /* 40: 0x64 */
+  0x10, 0x10, 0x16, 0x19, 0x11, 0x19, 0x16, 0x00,
+  /* 41: 0x65 */
+  0x00, 0x00, 0x0E, 0x11, 0x1F, 0x01, 0x0E, 0x00,
+  /* 42: 0x66 */
+  0x08, 0x14, 0x04, 0x0E, 0x04, 0x04, 0x04, 0x00,
+  /* 43: 0x67 */
+  0x00, 0x00, 0x0E, 0x19, 0x19, 0x16, 0x10, 0x0E,
+  /* 44: 0x68 */
+  0x01, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x11, 0x00,
+  /* 45: 0x69 */
+  0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0E, 0x00,
+  /* 46: 0x6B */
+  0x01, 0x01, 0x09, 0x05, 0x03, 0x05, 0x09, 0x00,
+  /* 47: 0x6C */
+  0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00,
+  /* 48: 0x6D */
+  0x00, 0x00, 0x0B, 0x15, 0x15, 0x15, 0x15, 0x00,
+  /* 49: 0x6E */
+  0x00, 0x00, 0x0D, 0x13, 0x11, 0x11, 0x11, 0x00,
+  /* 50: 0x6F */
+  0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00,
+  /* 51: 0x70 */
+  0x00, 0x00, 0x0D, 0x13, 0x13, 0x0D, 0x01, 0x01,
+  /* 52: 0x72 */
+  0x00, 0x00, 0x0D, 0x13, 0x01, 0x01, 0x01, 0x00,
+  /* 53: 0x73 */
+  0x00, 0x00, 0x1E, 0x01, 0x0E, 0x10, 0x0F, 0x00,
+  /* 54: 0x74 */
+  0x04, 0x04, 0x1F, 0x04, 0x04, 0x14, 0x08, 0x00,
+  /* 55: 0x75 */
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00,
+  /* 56: 0x76 */
+  0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00,
+  /* 57: 0x77 */
+  0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A, 0x00,
+  /* 58: 0x78 */
+  0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x00,
+  /* 59: 0x79 */
+  0x00, 0x00, 0x11, 0x11, 0x1E, 0x10, 0x11, 0x0E,
+};
+
+#if !FONT_RLE
+
+const uint16_t font_sub_16x24[1440] = {
+  /*  0: 0x3F */
+  0x0000, 0x03E0, 0x0FF8, 0x0C18, 0x180C, 0x180C, 0x1800, 0x0C00,
+  0x0600, 0x0300, 0x0180, 0x00C0, 0x00C0, 0x00C0, 0x0000, 0x0000,
+  0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /*  1: 0x20 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /*  2: 0x23 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C60, 0x0C60,
+  0x0C60, 0x0630, 0x0630, 0x1FFE, 0x1FFE, 0x0630, 0x0738, 0x0318,
+  0x1FFE, 0x1FFE, 0x0318, 0x0318, 0x018C, 0x018C, 0x018C, 0x0000,
+  /*  3: 0x26 */
+  0x0000, 0x01E0, 0x03F0, 0x0738, 0x0618, 0x0618, 0x0330, 0x01F0,
+  0x00F0, 0x00F8, 0x319C, 0x330E, 0x1E06, 0x1C06, 0x1C06, 0x3F06,
+  0x73FC, 0x21F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /*  4: 0x28 */
+  0x0000, 0x0200, 0x0300, 0x0180, 0x00C0, 0x00C0, 0x0060, 0x0060,
+  0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+  0x0060, 0x0060, 0x00C0, 0x00C0, 0x0180, 0x0300, 0x0200, 0x0000,
+  /*  5: 0x29 */
+  0x0000, 0x0020, 0x0060, 0x00C0, 0x0180, 0x0180, 0x0300, 0x0300,
+  0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
+  0x0300, 0x0300, 0x0180, 0x0180, 0x00C0, 0x0060, 0x0020, 0x0000,
+  /*  6: 0x2C */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0180, 0x0180, 0x0100, 0x0100, 0x0080, 0x0000, 0x0000,
+  /*  7: 0x2D */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x07E0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /*  8: 0x2E */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /*  9: 0x2F */
+  0x0000, 0x0C00, 0x0C00, 0x0600, 0x0600, 0x0600, 0x0300, 0x0300,
+  0x0300, 0x0380, 0x0180, 0x0180, 0x0180, 0x00C0, 0x00C0, 0x00C0,
+  0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 10: 0x30 */
+  0x0000, 0x03E0, 0x07F0, 0x0E38, 0x0C18, 0x180C, 0x180C, 0x180C,
+  0x180C, 0x180C, 0x180C, 0x180C, 0x180C, 0x180C, 0x0C18, 0x0E38,
+  0x07F0, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 11: 0x31 */
+  0x0000, 0x0100, 0x0180, 0x01C0, 0x01F0, 0x0198, 0x0188, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 12: 0x32 */
+  0x0000, 0x03E0, 0x0FF8, 0x0C18, 0x180C, 0x180C, 0x1800, 0x1800,
+  0x0C00, 0x0600, 0x0300, 0x0180, 0x00C0, 0x0060, 0x0030, 0x0018,
+  0x1FFC, 0x1FFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 13: 0x33 */
+  0x0000, 0x01E0, 0x07F8, 0x0E18, 0x0C0C, 0x0C0C, 0x0C00, 0x0600,
+  0x03C0, 0x07C0, 0x0C00, 0x1800, 0x1800, 0x180C, 0x180C, 0x0C18,
+  0x07F8, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 14: 0x34 */
+  0x0000, 0x0C00, 0x0E00, 0x0F00, 0x0F00, 0x0D80, 0x0CC0, 0x0C60,
+  0x0C60, 0x0C30, 0x0C18, 0x0C0C, 0x3FFC, 0x3FFC, 0x0C00, 0x0C00,
+  0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 15: 0x35 */
+  0x0000, 0x0FF8, 0x0FF8, 0x0018, 0x0018, 0x000C, 0x03EC, 0x07FC,
+  0x0E1C, 0x1C00, 0x1800, 0x1800, 0x1800, 0x180C, 0x0C1C, 0x0E18,
+  0x07F8, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 16: 0x36 */
+  0x0000, 0x07C0, 0x0FF0, 0x1C38, 0x1818, 0x0018, 0x000C, 0x03CC,
+  0x0FEC, 0x0E3C, 0x1C1C, 0x180C, 0x180C, 0x180C, 0x1C18, 0x0E38,
+  0x07F0, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 17: 0x37 */
+  0x0000, 0x1FFC, 0x1FFC, 0x0C00, 0x0600, 0x0600, 0x0300, 0x0380,
+  0x0180, 0x01C0, 0x00C0, 0x00E0, 0x0060, 0x0060, 0x0070, 0x0030,
+  0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 18: 0x38 */
+  0x0000, 0x03E0, 0x07F0, 0x0E38, 0x0C18, 0x0C18, 0x0C18, 0x0638,
+  0x07F0, 0x07F0, 0x0C18, 0x180C, 0x180C, 0x180C, 0x180C, 0x0C38,
+  0x0FF8, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 19: 0x39 */
+  0x0000, 0x03E0, 0x07F0, 0x0E38, 0x0C1C, 0x180C, 0x180C, 0x180C,
+  0x1C1C, 0x1E38, 0x1BF8, 0x19E0, 0x1800, 0x0C00, 0x0C00, 0x0E1C,
+  0x07F8, 0x01F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 20: 0x3A */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 21: 0x3E */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0008, 0x0038, 0x01F0, 0x07C0, 0x1F00, 0x1800, 0x1F00, 0x07C0,
+  0x01F0, 0x0038, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 22: 0x41 */
+  0x0000, 0x0380, 0x0380, 0x06C0, 0x06C0, 0x06C0, 0x0C60, 0x0C60,
+  0x1830, 0x1830, 0x1830, 0x3FF8, 0x3FF8, 0x701C, 0x600C, 0x600C,
+  0xC006, 0xC006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 23: 0x42 */
+  0x0000, 0x03FC, 0x0FFC, 0x0C0C, 0x180C, 0x180C, 0x180C, 0x0C0C,
+  0x07FC, 0x0FFC, 0x180C, 0x300C, 0x300C, 0x300C, 0x300C, 0x180C,
+  0x1FFC, 0x07FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 24: 0x43 */
+  0x0000, 0x07C0, 0x1FF0, 0x3838, 0x301C, 0x700C, 0x6006, 0x0006,
+  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x6006, 0x700C, 0x301C,
+  0x1FF0, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 25: 0x44 */
+  0x0000, 0x03FE, 0x0FFE, 0x0E06, 0x1806, 0x1806, 0x3006, 0x3006,
+  0x3006, 0x3006, 0x3006, 0x3006, 0x3006, 0x1806, 0x1806, 0x0E06,
+  0x0FFE, 0x03FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 26: 0x45 */
+  0x0000, 0x3FFC, 0x3FFC, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+  0x1FFC, 0x1FFC, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+  0x3FFC, 0x3FFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 27: 0x46 */
+  0x0000, 0x3FF8, 0x3FF8, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x1FF8, 0x1FF8, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+  0x0018, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 28: 0x49 */
+  0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 29: 0x4D */
+  0x0000, 0xE00E, 0xF01E, 0xF01E, 0xF01E, 0xD836, 0xD836, 0xD836,
+  0xD836, 0xCC66, 0xCC66, 0xCC66, 0xC6C6, 0xC6C6, 0xC6C6, 0xC6C6,
+  0xC386, 0xC386, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 30: 0x4F */
+  0x0000, 0x07E0, 0x1FF8, 0x381C, 0x700E, 0x6006, 0xC003, 0xC003,
+  0xC003, 0xC003, 0xC003, 0xC003, 0xC003, 0x6006, 0x700E, 0x381C,
+  0x1FF8, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 31: 0x50 */
+  0x0000, 0x0FFC, 0x1FFC, 0x380C, 0x300C, 0x300C, 0x300C, 0x300C,
+  0x180C, 0x1FFC, 0x07FC, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+  0x000C, 0x000C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 32: 0x51 */
+  0x0000, 0x07E0, 0x1FF8, 0x381C, 0x700E, 0x6006, 0xE003, 0xC003,
+  0xC003, 0xC003, 0xC003, 0xC003, 0xE007, 0x6306, 0x3F0E, 0x3C1C,
+  0x3FF8, 0xF7E0, 0xC000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 33: 0x52 */
+  0x0000, 0x0FFE, 0x1FFE, 0x3806, 0x3006, 0x3006, 0x3006, 0x3806,
+  0x1FFE, 0x07FE, 0x0306, 0x0606, 0x0C06, 0x1806, 0x1806, 0x3006,
+  0x3006, 0x6006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 34: 0x53 */
+  0x0000, 0x03E0, 0x0FF8, 0x0C1C, 0x180C, 0x180C, 0x000C, 0x001C,
+  0x03F8, 0x0FE0, 0x1E00, 0x3800, 0x3006, 0x3006, 0x300E, 0x1C1C,
+  0x0FF8, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 35: 0x54 */
+  0x0000, 0x7FFE, 0x7FFE, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+  0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 36: 0x55 */
+  0x0000, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C,
+  0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x1818,
+  0x1FF8, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 37: 0x61 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03F0, 0x07F8,
+  0x0C1C, 0x0C0C, 0x0F00, 0x0FF0, 0x0CF8, 0x0C0C, 0x0C0C, 0x0F1C,
+  0x0FF8, 0x18F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 38: 0x62 */
+  0x0000, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x03D8, 0x0FF8,
+  0x0C38, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0C38,
+  0x0FF8, 0x03D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 39: 0x63 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x07F0,
+  0x0E30, 0x0C18, 0x0018, 0x0018, 0x0018, 0x0018, 0x0C18, 0x0E30,
+  0x07F0, 0x03C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 40: 0x64 */
+  0x0000, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1BC0, 0x1FF0,
+  0x1C30, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1C30,
+  0x1FF0, 0x1BC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 41: 0x65 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x0FF0,
+  0x0C30, 0x1818, 0x1FF8, 0x1FF8, 0x0018, 0x0018, 0x1838, 0x1C30,
+  0x0FF0, 0x07C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 42: 0x66 */
+  0x0000, 0x0F80, 0x0FC0, 0x00C0, 0x00C0, 0x00C0, 0x07F0, 0x07F0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 43: 0x67 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DE0, 0x0FF8,
+  0x0E18, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0C, 0x0E18,
+  0x0FF8, 0x0DE0, 0x0C00, 0x0C0C, 0x061C, 0x07F8, 0x01F0, 0x0000,
+  /* 44: 0x68 */
+  0x0000, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x07D8, 0x0FF8,
+  0x1C38, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818,
+  0x1818, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 45: 0x69 */
+  0x0000, 0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 46: 0x6B */
+  0x0000, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x0C0C, 0x060C,
+  0x030C, 0x018C, 0x00CC, 0x006C, 0x00FC, 0x019C, 0x038C, 0x030C,
+  0x060C, 0x0C0C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 47: 0x6C */
+  0x0000, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 48: 0x6D */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C7C, 0x7EFF,
+  0xE3C7, 0xC183, 0xC183, 0xC183, 0xC183, 0xC183, 0xC183, 0xC183,
+  0xC183, 0xC183, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 49: 0x6E */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0798, 0x0FF8,
+  0x1C38, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818,
+  0x1818, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 50: 0x6F */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x0FF0,
+  0x0C30, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0C30,
+  0x0FF0, 0x03C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 51: 0x70 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03D8, 0x0FF8,
+  0x0C38, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0C38,
+  0x0FF8, 0x03D8, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0000,
+  /* 52: 0x72 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07B0, 0x03F0,
+  0x0070, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+  0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 53: 0x73 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03E0, 0x03F0,
+  0x0E38, 0x0C18, 0x0038, 0x03F0, 0x07C0, 0x0C00, 0x0C18, 0x0E38,
+  0x07F0, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 54: 0x74 */
+  0x0000, 0x0000, 0x0080, 0x00C0, 0x00C0, 0x00C0, 0x07F0, 0x07F0,
+  0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+  0x07C0, 0x0780, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 55: 0x75 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x1818,
+  0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1C38,
+  0x1FF0, 0x19E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 56: 0x76 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x180C, 0x0C18,
+  0x0C18, 0x0C18, 0x0630, 0x0630, 0x0630, 0x0360, 0x0360, 0x0360,
+  0x01C0, 0x01C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 57: 0x77 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41C1, 0x41C1,
+  0x61C3, 0x6363, 0x6363, 0x6363, 0x3636, 0x3636, 0x3636, 0x1C1C,
+  0x1C1C, 0x1C1C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 58: 0x78 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x381C, 0x1C38,
+  0x0C30, 0x0660, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x0660, 0x0C30,
+  0x1C38, 0x381C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  /* 59: 0x79 */
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3018, 0x1830,
+  0x1830, 0x1870, 0x0C60, 0x0C60, 0x0CE0, 0x06C0, 0x06C0, 0x0380,
+  0x0380, 0x0380, 0x0180, 0x0180, 0x01C0, 0x00F0, 0x0070, 0x0000,
+};
+
+#else
+
+/* slot -> start of its stream in font_sub_16x24_rle */
+const uint16_t font_sub_16x24_off[60] = {
+      0,    33,    39,    76,   116,   161,   206,   221,   231,   241,
+    277,   317,   353,   390,   427,   464,   501,   540,   576,   616,
+    655,   668,   693,   732,   772,   810,   848,   882,   917,   953,
+    995,  1033,  1071,  1112,  1152,  1189,  1225,  1266,  1296,  1335,
+   1363,  1402,  1431,  1467,  1506,  1546,  1576,  1615,  1651,  1682,
+   1713,  1743,  1782,  1809,  1836,  1870,  1901,  1930,  1961,  1990,
+};
+
+const uint8_t font_sub_16x24_rle[2028] = {
+  /*  0: 0x3F */
+  0x94, 0xC4, 0x88, 0xC8, 0x86, 0x03, 0x03, 0x06, 0x18, 0x18, 0x60, 0x8D,
+  0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8D,
+  0xC1, 0x8D, 0xC1, 0xAD, 0xC1, 0x8D, 0xC1, 0xBF, 0xA7,
+  /*  1: 0x20 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  /*  2: 0x23 */
+  0xBF, 0xA4, 0x63, 0x88, 0x63, 0x88, 0x63, 0x87, 0x63, 0x88, 0x63, 0x85,
+  0xCB, 0x83, 0xCB, 0x86, 0xC1, 0x18, 0x40, 0x73, 0x87, 0x63, 0x86, 0xCB,
+  0x83, 0xCB, 0x85, 0x63, 0x88, 0x63, 0x87, 0x63, 0x88, 0x63, 0x88, 0x63,
+  0x96,
+  /*  3: 0x26 */
+  0x94, 0xC3, 0x8A, 0xC5, 0x88, 0x67, 0x01, 0x0C, 0x06, 0x30, 0x18, 0x86,
+  0x33, 0x88, 0xC4, 0x8A, 0xC3, 0x8A, 0xC4, 0x89, 0x67, 0x18, 0x0E, 0x66,
+  0x18, 0x70, 0x61, 0x86, 0x07, 0x03, 0x1C, 0x0C, 0x7C, 0x61, 0xC5, 0x1C,
+  0x78, 0x21, 0xBF, 0xA0,
+  /*  4: 0x28 */
+  0x98, 0xC0, 0x8D, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8D, 0xC1, 0x8C, 0xC1,
+  0x8D, 0xC1, 0x8C, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8E, 0xC1, 0x8D, 0xC1, 0x8E, 0xC1,
+  0x8D, 0xC1, 0x8E, 0xC1, 0x8E, 0xC1, 0x8E, 0xC0, 0x95,
+  /*  5: 0x29 */
+  0x94, 0xC0, 0x8E, 0xC1, 0x8E, 0xC1, 0x8E, 0xC1, 0x8D, 0xC1, 0x8E, 0xC1,
+  0x8D, 0xC1, 0x8E, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8C, 0xC1, 0x8D, 0xC1, 0x8C, 0xC1,
+  0x8D, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8D, 0xC0, 0x99,
+  /*  6: 0x2C */
+  0xBF, 0xBF, 0xBF, 0xBF, 0x96, 0xC1, 0x8D, 0xC1, 0x8E, 0xC0, 0x8E, 0xC0,
+  0x8D, 0xC0, 0xA7,
+  /*  7: 0x2D */
+  0xBF, 0xBF, 0xBF, 0x84, 0xC5, 0x89, 0xC5, 0xBF, 0xBF, 0xA4,
+  /*  8: 0x2E */
+  0xBF, 0xBF, 0xBF, 0xBF, 0x95, 0xC1, 0x8D, 0xC1, 0xBF, 0x97,
+  /*  9: 0x2F */
+  0x99, 0xC1, 0x8D, 0xC1, 0x8C, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8C, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8C, 0xC2, 0x8C, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8C, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8C, 0xC1, 0x8D, 0xC1, 0xBF, 0xA8,
+  /* 10: 0x30 */
+  0x94, 0xC4, 0x89, 0xC6, 0x87, 0x47, 0x03, 0x0C, 0x0C, 0x18, 0x84, 0x03,
+  0x03, 0x0C, 0x0C, 0x30, 0x30, 0x40, 0x41, 0x01, 0x06, 0x06, 0x18, 0x18,
+  0x60, 0x60, 0x86, 0x03, 0x03, 0x0C, 0x18, 0x18, 0x60, 0x71, 0x87, 0xC6,
+  0x89, 0xC4, 0xBF, 0xA5,
+  /* 11: 0x31 */
+  0x97, 0xC0, 0x8D, 0xC1, 0x8C, 0xC2, 0x8A, 0xC4, 0x89, 0x33, 0x88, 0x31,
+  0x8C, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF, 0xA6,
+  /* 12: 0x32 */
+  0x94, 0xC4, 0x88, 0xC8, 0x86, 0x03, 0x03, 0x06, 0x18, 0x18, 0x60, 0x8D,
+  0xC1, 0x8D, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8C,
+  0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8C, 0xC1, 0x8C, 0xCA, 0x84, 0xCA, 0xBF,
+  0xA2,
+  /* 13: 0x33 */
+  0x94, 0xC3, 0x89, 0xC7, 0x87, 0x43, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x8C,
+  0xC1, 0x8C, 0xC1, 0x8A, 0xC3, 0x8B, 0xC4, 0x8E, 0xC1, 0x8E, 0xC1, 0x8D,
+  0x03, 0x03, 0x0C, 0x0C, 0x30, 0x60, 0x60, 0x86, 0xC7, 0x89, 0xC4, 0xBF,
+  0xA5,
+  /* 14: 0x34 */
+  0x99, 0xC1, 0x8C, 0xC2, 0x8B, 0xC3, 0x8B, 0xC3, 0x8A, 0x1B, 0x87, 0x33,
+  0x87, 0x63, 0x88, 0x63, 0x87, 0x43, 0x01, 0x06, 0x06, 0x0C, 0x18, 0x83,
+  0xCB, 0x83, 0xCB, 0x8B, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF,
+  0xA3,
+  /* 15: 0x35 */
+  0x92, 0xC8, 0x86, 0xC8, 0x86, 0xC1, 0x8D, 0xC1, 0x8C, 0xC1, 0x8D, 0x7B,
+  0x01, 0x7C, 0x0F, 0x70, 0x70, 0x8D, 0xC2, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D,
+  0x03, 0x03, 0x0C, 0x1C, 0x18, 0x60, 0x70, 0x86, 0xC7, 0x89, 0xC4, 0xBF,
+  0xA5,
+  /* 16: 0x36 */
+  0x95, 0xC4, 0x88, 0xC7, 0x86, 0x07, 0x07, 0x0C, 0x18, 0x30, 0x8B, 0xC1,
+  0x8D, 0x73, 0x01, 0x6C, 0xC4, 0x40, 0x47, 0x03, 0x0E, 0x1C, 0x18, 0x60,
+  0x60, 0x86, 0x03, 0x03, 0x0C, 0x18, 0x38, 0x60, 0x71, 0x87, 0xC6, 0x89,
+  0xC4, 0xBF, 0xA5,
+  /* 17: 0x37 */
+  0x91, 0xCA, 0x84, 0xCA, 0x8C, 0xC1, 0x8C, 0xC1, 0x8D, 0xC1, 0x8C, 0xC1,
+  0x8C, 0xC2, 0x8C, 0xC1, 0x8C, 0xC2, 0x8C, 0xC1, 0x8C, 0xC2, 0x8C, 0xC1,
+  0x8D, 0xC1, 0x8C, 0xC2, 0x8C, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF, 0xA9,
+  /* 18: 0x38 */
+  0x94, 0xC4, 0x89, 0xC6, 0x87, 0xC2, 0x38, 0x85, 0x03, 0x03, 0x0C, 0x0C,
+  0x30, 0x30, 0x40, 0x63, 0x88, 0xC6, 0x88, 0xC6, 0x87, 0x03, 0x03, 0x06,
+  0x18, 0x18, 0x84, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x60, 0x61, 0x86, 0xC8,
+  0x88, 0xC4, 0xBF, 0xA5,
+  /* 19: 0x39 */
+  0x94, 0xC4, 0x89, 0xC6, 0x87, 0x47, 0x03, 0x0E, 0x0C, 0x18, 0x84, 0x03,
+  0x03, 0x0C, 0x0C, 0x30, 0x70, 0x60, 0x01, 0x47, 0x07, 0x7C, 0x1B, 0x40,
+  0x67, 0x8D, 0xC1, 0x8C, 0xC1, 0x8D, 0x03, 0x0E, 0x0E, 0x83, 0xC7, 0x88,
+  0xC4, 0xBF, 0xA6,
+  /* 20: 0x3A */
+  0xBF, 0xA6, 0xC1, 0x8D, 0xC1, 0xBF, 0xBF, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF,
+  0xA6,
+  /* 21: 0x3E */
+  0xBF, 0xBF, 0x08, 0x8B, 0xC2, 0x8D, 0xC4, 0x8C, 0xC4, 0x8C, 0xC4, 0x8D,
+  0xC1, 0x8A, 0xC4, 0x88, 0xC4, 0x88, 0xC4, 0x89, 0xC2, 0x8C, 0xC0, 0xBF,
+  0x9B,
+  /* 22: 0x41 */
+  0x96, 0xC2, 0x8C, 0xC2, 0x8B, 0x1B, 0x88, 0x1B, 0x88, 0x1B, 0x87, 0x63,
+  0x88, 0x63, 0x87, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x84, 0xCA, 0x84,
+  0xCA, 0x83, 0x07, 0x38, 0x0C, 0x85, 0x63, 0x88, 0x33, 0x89, 0x1B, 0x88,
+  0xC1, 0xBF, 0x9F,
+  /* 23: 0x42 */
+  0x91, 0xC7, 0x87, 0xC9, 0x85, 0x03, 0x06, 0x0C, 0x83, 0x03, 0x03, 0x0C,
+  0x0C, 0x30, 0x30, 0x60, 0x85, 0xC8, 0x86, 0xC9, 0x85, 0x03, 0x0C, 0x0C,
+  0x84, 0x43, 0x01, 0x0C, 0x06, 0x30, 0x18, 0x40, 0x61, 0x86, 0x03, 0xCA,
+  0x84, 0xC8, 0xBF, 0xA4,
+  /* 24: 0x43 */
+  0x95, 0xC4, 0x88, 0xC8, 0x85, 0x07, 0x0E, 0x0E, 0x30, 0x18, 0x85, 0x67,
+  0x89, 0x33, 0x8C, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x89, 0x63, 0x87, 0xC2, 0x38, 0x40, 0x01, 0xC8, 0x87, 0xC5,
+  0xBF, 0xA4,
+  /* 25: 0x44 */
+  0x90, 0xC8, 0x86, 0xCA, 0x60, 0x85, 0x07, 0x06, 0x30, 0x18, 0x40, 0x61,
+  0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63, 0x88, 0x63,
+  0x88, 0x63, 0x87, 0x43, 0x01, 0x0C, 0x06, 0x1C, 0x82, 0xCA, 0x84, 0xC8,
+  0xBF, 0xA5,
+  /* 26: 0x45 */
+  0x91, 0xCB, 0x83, 0xCB, 0x30, 0x8C, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D,
+  0xC1, 0x8D, 0xCA, 0x84, 0xCA, 0x60, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xCB, 0x83, 0xCB, 0xBF, 0xA1,
+  /* 27: 0x46 */
+  0x92, 0xCA, 0x84, 0xCA, 0x60, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D,
+  0xC1, 0x8D, 0xC9, 0x85, 0xC9, 0x85, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D,
+  0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF, 0xAA,
+  /* 28: 0x49 */
+  0x96, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF, 0xA6,
+  /* 29: 0x4D */
+  0x90, 0xC2, 0x88, 0x77, 0x01, 0x5E, 0x07, 0x78, 0x1E, 0x60, 0x5B, 0x41,
+  0x6D, 0x06, 0x36, 0x1B, 0x58, 0x6D, 0x60, 0x36, 0x46, 0x59, 0x19, 0x66,
+  0x66, 0x18, 0x1B, 0x36, 0x6C, 0x58, 0x31, 0x63, 0x46, 0x0D, 0x1B, 0x36,
+  0x38, 0x58, 0x61, 0x61, 0xBF, 0x9F,
+  /* 30: 0x4F */
+  0x94, 0xC5, 0x87, 0xC9, 0x84, 0x07, 0x1C, 0x0E, 0x84, 0x67, 0x89, 0x1B,
+  0x89, 0xC3, 0x8B, 0xC3, 0x8B, 0xC3, 0x8B, 0xC3, 0x8B, 0xC3, 0x8B, 0xC3,
+  0x8B, 0x1B, 0x87, 0x73, 0x87, 0xC2, 0x38, 0x60, 0x41, 0xC8, 0x87, 0xC5,
+  0xBF, 0xA4,
+  /* 31: 0x50 */
+  0x91, 0xC9, 0x85, 0xCA, 0x84, 0x03, 0x1C, 0x0C, 0x84, 0x43, 0x01, 0x0C,
+  0x06, 0x30, 0x18, 0x85, 0x43, 0x01, 0x06, 0x7E, 0x1F, 0x78, 0x1F, 0x60,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0xBF, 0xAB,
+  /* 32: 0x51 */
+  0x94, 0xC5, 0x87, 0xC9, 0x84, 0x07, 0x1C, 0x0E, 0x84, 0x67, 0x89, 0x1B,
+  0x88, 0xC4, 0x8B, 0xC3, 0x8B, 0xC3, 0x8B, 0xC3, 0x8B, 0xC3, 0x8B, 0xC4,
+  0x89, 0x37, 0x30, 0x4C, 0x43, 0xC4, 0x70, 0x60, 0x03, 0xCA, 0x86, 0xC5,
+  0x1E, 0x8B, 0xC1, 0xBF, 0x8F,
+  /* 33: 0x52 */
+  0x90, 0xCA, 0x84, 0xCB, 0x83, 0x03, 0x38, 0x0C, 0x85, 0x63, 0x88, 0x63,
+  0x88, 0x63, 0x87, 0x47, 0xCA, 0x83, 0xC9, 0x85, 0x03, 0x03, 0x0C, 0x18,
+  0x30, 0x85, 0x03, 0x03, 0x18, 0x0C, 0x60, 0x30, 0x87, 0x63, 0x88, 0x63,
+  0x89, 0xC1, 0xBF, 0xA0,
+  /* 34: 0x53 */
+  0x94, 0xC4, 0x88, 0xC8, 0x40, 0x03, 0x03, 0x06, 0x18, 0x18, 0x60, 0x60,
+  0x8D, 0xC2, 0x8D, 0xC6, 0x8A, 0xC6, 0x8C, 0xC3, 0x8D, 0xC2, 0x18, 0x86,
+  0x63, 0x88, 0x63, 0x01, 0x0C, 0x0E, 0x1C, 0x83, 0xC8, 0x88, 0xC5, 0xBF,
+  0xA4,
+  /* 35: 0x54 */
+  0x90, 0xCD, 0x81, 0xCD, 0x87, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF, 0xA6,
+  /* 36: 0x55 */
+  0x91, 0xC1, 0x87, 0x43, 0x01, 0x0C, 0x06, 0x30, 0x18, 0x85, 0x43, 0x01,
+  0x0C, 0x06, 0x30, 0x18, 0x40, 0x61, 0x87, 0x43, 0x01, 0x0C, 0x06, 0x30,
+  0x18, 0x40, 0x61, 0x87, 0x43, 0x01, 0x0C, 0x06, 0x30, 0x30, 0x60, 0x85,
+  0xC9, 0x87, 0xC5, 0xBF, 0xA4,
+  /* 37: 0x61 */
+  0xBF, 0xA3, 0xC5, 0x88, 0xC7, 0x86, 0x07, 0x06, 0x0C, 0x18, 0x89, 0xC3,
+  0x87, 0xC7, 0x86, 0x1F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x71, 0x01,
+  0x7E, 0x07, 0x70, 0x31, 0xBF, 0xA1,
+  /* 38: 0x62 */
+  0x92, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0x7B,
+  0x88, 0xC8, 0x86, 0xC2, 0x30, 0x85, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60,
+  0x40, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x61, 0x86, 0xC8, 0x86,
+  0x7B, 0xBF, 0xA5,
+  /* 39: 0x63 */
+  0xBF, 0xA5, 0xC3, 0x89, 0xC6, 0x88, 0x63, 0x01, 0x06, 0x06, 0x18, 0x8B,
+  0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0x03, 0x03, 0x18, 0x0E, 0x84, 0xC6,
+  0x8A, 0xC3, 0xBF, 0xA5,
+  /* 40: 0x64 */
+  0x9A, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x88, 0xC3,
+  0x06, 0x78, 0x1F, 0x60, 0x70, 0x40, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0x40, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x60, 0x70, 0x86, 0xC8, 0x88,
+  0x6F, 0xBF, 0xA2,
+  /* 41: 0x65 */
+  0xBF, 0xA5, 0xC3, 0x89, 0xC7, 0x87, 0xC1, 0x30, 0x40, 0x01, 0x03, 0x7E,
+  0x0F, 0x78, 0x3F, 0x60, 0x8D, 0xC1, 0x8D, 0x07, 0x06, 0x18, 0x1C, 0x84,
+  0xC7, 0x89, 0xC4, 0xBF, 0xA4,
+  /* 42: 0x66 */
+  0x96, 0xC4, 0x89, 0xC5, 0x89, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8B, 0xC6,
+  0x88, 0xC6, 0x8A, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF, 0xA7,
+  /* 43: 0x67 */
+  0xBF, 0xA4, 0xC3, 0x06, 0x78, 0x1F, 0x60, 0x70, 0x40, 0x01, 0x03, 0x06,
+  0x0C, 0x18, 0x30, 0x60, 0x40, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x60, 0x70,
+  0x86, 0xC8, 0x88, 0x6F, 0x8D, 0x03, 0x06, 0x0C, 0x38, 0x18, 0x85, 0xC7,
+  0x88, 0xC4, 0x96,
+  /* 44: 0x68 */
+  0x92, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x3E, 0x86, 0xC8, 0x86, 0x07, 0x07, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x01,
+  0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x01, 0x03, 0x06, 0x0C, 0x18,
+  0x30, 0x60, 0xBF, 0xA2,
+  /* 45: 0x69 */
+  0x95, 0xC1, 0x8D, 0xC1, 0xBD, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0xBF, 0xA7,
+  /* 46: 0x6B */
+  0x91, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0x03,
+  0x06, 0x0C, 0x0C, 0x30, 0x18, 0x85, 0x63, 0x88, 0x33, 0x88, 0x1B, 0x88,
+  0xC5, 0x89, 0xC2, 0x0C, 0x40, 0x71, 0x87, 0x43, 0x01, 0x0C, 0x0C, 0x30,
+  0x60, 0xBF, 0xA3,
+  /* 47: 0x6C */
+  0x95, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0xBF, 0xA7,
+  /* 48: 0x6D */
+  0xBF, 0xA1, 0x1F, 0x1E, 0xC7, 0x7E, 0x0E, 0x0F, 0x1F, 0x18, 0x78, 0x60,
+  0x60, 0x03, 0x03, 0x0F, 0x0C, 0x3C, 0x30, 0x70, 0x41, 0x41, 0x07, 0x06,
+  0x1E, 0x18, 0x78, 0x60, 0x60, 0xBF, 0x9F,
+  /* 49: 0x6E */
+  0xBF, 0xA2, 0xC1, 0x3C, 0x86, 0xC8, 0x86, 0x07, 0x07, 0x0C, 0x18, 0x30,
+  0x60, 0x40, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x01, 0x03,
+  0x06, 0x0C, 0x18, 0x30, 0x60, 0xBF, 0xA2,
+  /* 50: 0x6F */
+  0xBF, 0xA5, 0xC3, 0x89, 0xC7, 0x87, 0xC1, 0x30, 0x85, 0x03, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0x40, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x40, 0x61,
+  0x87, 0xC7, 0x89, 0xC3, 0xBF, 0xA5,
+  /* 51: 0x70 */
+  0xBF, 0xA2, 0x7B, 0x88, 0xC8, 0x86, 0xC2, 0x30, 0x85, 0x03, 0x06, 0x0C,
+  0x18, 0x30, 0x60, 0x85, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x43,
+  0x01, 0x7E, 0x07, 0x58, 0x07, 0x60, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x9A,
+  /* 52: 0x72 */
+  0xBF, 0xA3, 0x7B, 0x88, 0xC5, 0x89, 0xC2, 0x8C, 0xC1, 0x8D, 0xC1, 0x8D,
+  0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D,
+  0xC1, 0xBF, 0xA9,
+  /* 53: 0x73 */
+  0xBF, 0xA4, 0xC4, 0x89, 0xC5, 0x88, 0x47, 0x03, 0x0C, 0x0C, 0x70, 0x8D,
+  0xC5, 0x8B, 0xC4, 0x8E, 0x03, 0x0C, 0x0C, 0x70, 0x38, 0x86, 0xC6, 0x89,
+  0xC4, 0xBF, 0xA5,
+  /* 54: 0x74 */
+  0xA6, 0xC0, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8B, 0xC6, 0x88, 0xC6,
+  0x8A, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC1,
+  0x8D, 0xC1, 0x8D, 0xC1, 0x8D, 0xC4, 0x8B, 0xC3, 0xBF, 0xA4,
+  /* 55: 0x75 */
+  0xBF, 0xA2, 0x03, 0x06, 0x0C, 0x18, 0x83, 0x03, 0x06, 0x0C, 0x18, 0x30,
+  0x60, 0x40, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x01, 0x07,
+  0x07, 0x78, 0x1F, 0x40, 0x67, 0xBF, 0xA2,
+  /* 56: 0x76 */
+  0xBF, 0xA1, 0xC1, 0x86, 0x03, 0x06, 0x06, 0x18, 0x18, 0x60, 0x60, 0x87,
+  0x63, 0x88, 0x63, 0x88, 0x63, 0x89, 0x1B, 0x88, 0x1B, 0x88, 0x1B, 0x89,
+  0xC2, 0x8C, 0xC2, 0xBF, 0xA6,
+  /* 57: 0x77 */
+  0xBF, 0x9F, 0x41, 0x03, 0x05, 0x0E, 0x34, 0x38, 0x58, 0x31, 0x63, 0x46,
+  0x0D, 0x1B, 0x36, 0x4C, 0x0D, 0x1B, 0x36, 0x6C, 0x58, 0x31, 0x43, 0x03,
+  0x07, 0x0E, 0x1C, 0x38, 0x70, 0xBF, 0xA2,
+  /* 58: 0x78 */
+  0xBF, 0xA1, 0x07, 0x1C, 0x38, 0x38, 0x40, 0x61, 0x88, 0x33, 0x89, 0xC3,
+  0x8B, 0xC3, 0x8B, 0xC3, 0x8B, 0xC3, 0x8A, 0x33, 0x87, 0x43, 0x01, 0x0E,
+  0x0E, 0x1C, 0x70, 0xBF, 0xA1,
+  /* 59: 0x79 */
+  0xBF, 0xA2, 0xC1, 0x86, 0x03, 0x06, 0x06, 0x18, 0x18, 0x60, 0x61, 0x87,
+  0x63, 0x88, 0x63, 0x88, 0x67, 0x89, 0x1B, 0x88, 0x1B, 0x89, 0xC2, 0x8C,
+  0xC2, 0x8C, 0xC2, 0x8C, 0xC1, 0x8D, 0xC1, 0x8C, 0xC2, 0x8A, 0xC3, 0x8B,
+  0xC2, 0x98,
+};
+
+#endif /* FONT_RLE */
+
+#endif /* FONT_SUBSET */
@@ -0,0 +1,59 @@
+/* COE718 Lab 3a - subset fonts for the GLCD driver
+ *
+ * Font_6x8_h and Font_16x24_h hold 112 glyphs each (0x20..0x7E and the
+ * 0x80..0x8F symbols), 6272 bytes of flash, while the demos print a few
+ * dozen distinct characters.  tools/font_gen scans the UI sources for
+ * string and character literals (expanding %u, %d and %X to the digits
+ * they can print) and writes font_subset.c: only those glyphs, in the
+ * original bit layout, plus font_sub_map, one byte per character code
+ * giving its slot.
+ *
+ * Build with FONT_SUBSET=1 to draw from the subset; the full fonts then
+ * drop out of the image.  Lookup stays O(1): a subtract, one compare and
+ * one byte load.  A character the subset lacks, or any code outside
+ * 0x20..0x8F, draws slot 0, which is always FONT_FALLBACK; the full-font
+ * path applies the same bounds check.  Regenerate font_subset.c whenever
+ * a displayed string changes (the command is in its header).
+ *
+ * FONT_RLE=1 (with FONT_SUBSET=1) swaps the raw 16x24 glyphs for the
+ * glcd_rle.h streams font_gen writes next to them, drawn by
+ * GLCD_DrawCharRLE; font_sub_16x24_off[slot] is where a glyph starts.
+ * The 6x8 glyphs are raw in both builds.
+ */
+#pragma once
+#include <stdint.h>
+
+#ifndef FONT_SUBSET
+# define FONT_SUBSET     0
+#endif
+#ifndef FONT_RLE
+# define FONT_RLE        0
+#endif
+#if FONT_RLE && !FONT_SUBSET
+# error "FONT_RLE codes the glyphs of font_subset.c, build with FONT_SUBSET=1"
+#endif
+
+#define FONT_FIRST       0x20u
+#define FONT_CHARS       112u           /* glyphs in the full fonts */
+#define FONT_FALLBACK    '?'
+
+extern const uint8_t  font_sub_map[FONT_CHARS];
+extern const uint8_t  font_sub_6x8[];   /* 8 bytes per glyph */
+extern const uint16_t font_sub_16x24[]; /* 24 halfwords per glyph */
+extern const uint16_t font_sub_16x24_off[];
+extern const uint8_t  font_sub_16x24_rle[];
+extern const uint32_t font_sub_count;
+
+/* slot of c in the subset; 0 (FONT_FALLBACK) when missing */
+static __inline uint32_t font_sub_slot(unsigned char c)
+{
+  uint32_t i = (uint32_t)c - FONT_FIRST;
+  return i < FONT_CHARS ? font_sub_map[i] : 0u;
+}
+
+/* glyph of c in the full fonts, FONT_FALLBACK when out of range */
+static __inline uint32_t font_full_slot(unsigned char c)
+{
+  uint32_t i = (uint32_t)c - FONT_FIRST;
+  return i < FONT_CHARS ? i : (uint32_t)FONT_FALLBACK - FONT_FIRST;
+}
@@ -0,0 +1,179 @@
+/* COE718 Lab 3a - GLCD drawing benchmark: raw vs coded glyphs and images
+ *
+ * Build this file in place of thread_analysis.c / thread2_demo.c, with
+ * FONT_SUBSET=1 and FONT_RLE=1.  One thread draws, GB_REPS times each:
+ *
+ *   GB_GLYPH_RAW    GB_TEXT in 16x24, Font_16x24_h via GLCD_DrawChar
+ *   GB_GLYPH_RLE    the same text from font_sub_16x24_rle (GLCD_DrawCharRLE)
+ *   GB_BITMAP_RAW   the img_gen test card via GLCD_Bitmap
+ *   GB_BITMAP_RLE   the same card via GLCD_BitmapRLE
+ *   GB_BITMAP_I8..I1  the card palette-indexed at 8, 4, 2 and 1 bpp via
+ *                   GLCD_BitmapIdx (quantized below 8 bpp, see the
+ *                   numbers in glcd_bench_img.h)
+ *
+ * and, over the same windows, a plain one-colour fill (GLCD_Bargraph at
+ * full scale): the SSP1 stream with nothing to decode.  The fastest
+ * repetition counts.
+ *
+ * Watch: g_gb_flash[case]       bytes read from flash (glyphs: the
+ *                               drawn characters, offsets included)
+ *        g_gb_cyc_px_x10[case]  cycles per pixel x 10
+ *        g_gb_decode_x10[case]  the same minus the plain fill, i.e. the
+ *                               decode cost per pixel x 10 (negative
+ *                               when the format beats the fill loop)
+ *        g_gb_kpix_s[case]      thousand pixels per second
+ *        g_gb_per_s[case]       whole draws per second (text lines,
+ *                               images)
+ *        g_gb_fill_x10[0..1]    plain fill per pixel x 10, glyph and
+ *                               bitmap windows
+ *        g_gb_done
+ */
+#include "cmsis_os.h"
+#include "GLCD.h"
+#include "font_subset.h"
+#include "glcd_rle.h"
+#include "hrclock.h"
+#include "time_units.h"
+#include <stdint.h>
+#include "Font_16x24_h.h"               /* raw reference, not linked by the driver */
+#include "glcd_bench_img.h"             /* tools/img_gen -t 96x64 */
+
+#if !FONT_RLE
+# error "glcd_bench.c needs FONT_SUBSET=1 and FONT_RLE=1"
+#endif
+
+#define GB_REPS          8u
+#define GB_TEXT          "Thread 0123456789"
+#define GB_GLYPH_PIX     (16u * 24u)
+#define GB_BITMAP_PIX    (GB_SPLASH_W * GB_SPLASH_H)
+
+enum {
+  GB_GLYPH_RAW = 0, GB_GLYPH_RLE,
+  GB_BITMAP_RAW, GB_BITMAP_RLE, GB_BITMAP_I8, GB_BITMAP_I4, GB_BITMAP_I2, GB_BITMAP_I1,
+  GB_CASES
+};
+
+volatile uint32_t g_gb_flash[GB_CASES];
+volatile uint32_t g_gb_cyc_px_x10[GB_CASES];
+volatile int32_t  g_gb_decode_x10[GB_CASES];
+volatile uint32_t g_gb_kpix_s[GB_CASES];
+volatile uint32_t g_gb_per_s[GB_CASES];
+volatile uint32_t g_gb_fill_x10[2];
+volatile uint8_t  g_gb_done = 0;
+
+/* ------------------- Draw passes ------------------- */
+static void gb_text(uint32_t c, uint32_t y)
+{
+  const unsigned char *s = (const unsigned char *)GB_TEXT;
+  uint32_t col;
+
+  for (col = 0; s[col]; ++col) {
+    uint32_t x = col * 16u;
+    switch (c) {
+      case GB_GLYPH_RAW:
+        GLCD_DrawChar(x, y, 16, 24, (unsigned char *)&Font_16x24_h[font_full_slot(s[col]) * 24u]);
+        break;
+      case GB_GLYPH_RLE:
+        GLCD_DrawCharRLE(x, y, 16, 24, &font_sub_16x24_rle[font_sub_16x24_off[font_sub_slot(s[col])]]);
+        break;
+      default:
+        GLCD_Bargraph(x, y, 16, 24, 1024);
+        break;
+    }
+  }
+}
+
+static void gb_bitmap(uint32_t c, uint32_t y)
+{
+  switch (c) {
+    case GB_BITMAP_RAW: GLCD_Bitmap(0, y, GB_SPLASH_W, GB_SPLASH_H, (unsigned char *)gb_splash); break;
+    case GB_BITMAP_RLE: GLCD_BitmapRLE(0, y, GB_SPLASH_W, GB_SPLASH_H, gb_splash_rle); break;
+    case GB_BITMAP_I8:  GLCD_BitmapIdx(0, y, GB_SPLASH_W, GB_SPLASH_H, GB_SPLASH_I8_FMT, gb_splash_i8_lut, gb_splash_i8); break;
+    case GB_BITMAP_I4:  GLCD_BitmapIdx(0, y, GB_SPLASH_W, GB_SPLASH_H, GB_SPLASH_I4_FMT, gb_splash_i4_lut, gb_splash_i4); break;
+    case GB_BITMAP_I2:  GLCD_BitmapIdx(0, y, GB_SPLASH_W, GB_SPLASH_H, GB_SPLASH_I2_FMT, gb_splash_i2_lut, gb_splash_i2); break;
+    case GB_BITMAP_I1:  GLCD_BitmapIdx(0, y, GB_SPLASH_W, GB_SPLASH_H, GB_SPLASH_I1_FMT, gb_splash_i1_lut, gb_splash_i1); break;
+    default:            GLCD_Bargraph(0, y, GB_SPLASH_W, GB_SPLASH_H, 1024); break;
+  }
+}
+
+/* fastest of GB_REPS passes, cycles */
+static uint32_t gb_time(void (*pass)(uint32_t, uint32_t), uint32_t c, uint32_t y)
+{
+  uint32_t k, t0, dt, best = 0xFFFFFFFFu;
+
+  for (k = 0; k < GB_REPS; ++k) {
+    t0 = hrclock_cyc32();
+    pass(c, y);
+    dt = hrclock_cyc32() - t0;
+    if (dt < best) best = dt;
+  }
+  return best;
+}
+
+/* bytes of one glyph stream, walked like GLCD_DrawCharRLE does */
+static uint32_t gb_glyph_bytes(const uint8_t *s)
+{
+  uint32_t n = GB_GLYPH_PIX, used = 0, k;
+
+  for (; n != 0u; n -= k) {
+    uint8_t b = s[used++];
+    k = (b & RLE_RUN) ? (b & RLE_G_LEN) + 1u : RLE_G_LIT;
+    if (k > n) k = n;
+  }
+  return used;
+}
+
+static void gb_result(uint32_t c, uint32_t cycles, uint32_t fill, uint32_t pixels)
+{
+  g_gb_cyc_px_x10[c] = (uint32_t)((uint64_t)cycles * 10u / pixels);
+  g_gb_decode_x10[c] = (int32_t)(((int64_t)cycles - (int64_t)fill) * 10 / (int64_t)pixels);
+  g_gb_kpix_s[c]     = (uint32_t)((uint64_t)pixels * (TU_CCLK_HZ / 1000u) / cycles);
+  g_gb_per_s[c]      = TU_CCLK_HZ / cycles;
+}
+
+/* ------------------- Thread ------------------- */
+void Th_GlcdBench(void const *arg);
+osThreadDef(Th_GlcdBench, osPriorityHigh, 1, 0);
+
+void Th_GlcdBench(void const *arg)
+{
+  const unsigned char *s = (const unsigned char *)GB_TEXT;
+  uint32_t n, fill, i, pix;
+  (void)arg;
+
+  for (n = 0, i = 0; s[i]; ++i, ++n) {
+    g_gb_flash[GB_GLYPH_RAW] += 48u;
+    g_gb_flash[GB_GLYPH_RLE] += 2u + gb_glyph_bytes(&font_sub_16x24_rle[font_sub_16x24_off[font_sub_slot(s[i])]]);
+  }
+  g_gb_flash[GB_BITMAP_RAW] = sizeof gb_splash;
+  g_gb_flash[GB_BITMAP_RLE] = sizeof gb_splash_rle;
+  g_gb_flash[GB_BITMAP_I8]  = sizeof gb_splash_i8 + sizeof gb_splash_i8_lut;
+  g_gb_flash[GB_BITMAP_I4]  = sizeof gb_splash_i4 + sizeof gb_splash_i4_lut;
+  g_gb_flash[GB_BITMAP_I2]  = sizeof gb_splash_i2 + sizeof gb_splash_i2_lut;
+  g_gb_flash[GB_BITMAP_I1]  = sizeof gb_splash_i1 + sizeof gb_splash_i1_lut;
+
+  pix  = n * GB_GLYPH_PIX;
+  fill = gb_time(gb_text, GB_CASES, 0);
+  g_gb_fill_x10[0] = (uint32_t)((uint64_t)fill * 10u / pix);
+  gb_result(GB_GLYPH_RAW, gb_time(gb_text, GB_GLYPH_RAW, 24), fill, pix);
+  gb_result(GB_GLYPH_RLE, gb_time(gb_text, GB_GLYPH_RLE, 48), fill, pix);
+
+  fill = gb_time(gb_bitmap, GB_CASES, 80);
+  g_gb_fill_x10[1] = (uint32_t)((uint64_t)fill * 10u / GB_BITMAP_PIX);
+  gb_result(GB_BITMAP_RAW, gb_time(gb_bitmap, GB_BITMAP_RAW, 80), fill, GB_BITMAP_PIX);
+  for (i = GB_BITMAP_RLE; i < GB_CASES; ++i) {
+    gb_result(i, gb_time(gb_bitmap, i, 160), fill, GB_BITMAP_PIX);
+  }
+
+  g_gb_done = 1u;
+  osThreadTerminate(osThreadGetId());
+}
+
+int Init_Thread(void)
+{
+  GLCD_Init();
+  GLCD_SetTextColor(White);
+  GLCD_SetBackColor(Black);
+  GLCD_Clear(Black);
+  return osThreadCreate(osThread(Th_GlcdBench), NULL) ? 0 : -1;
+}
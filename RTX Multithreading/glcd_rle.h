@@ -0,0 +1,40 @@
+/* COE718 Lab 3a - run-length coded glyphs and bitmaps for the GLCD driver
+ *
+ * Both formats are byte streams in the order the pixels go out on SSP1:
+ * row by row, top down, inside the window the draw call sets.  The
+ * driver decodes them straight into the pixel stream, with no line
+ * buffer, and stops after w * h pixels (a packet running past the end is
+ * cut short).
+ *
+ * Glyphs, GLCD_DrawCharRLE, 1 bit per pixel, 0 = back colour:
+ *
+ *   1 c nnnnnn            n + 1 pixels of colour c
+ *   0 bbbbbbb             the next 7 pixels, first in bit 0 (the bit
+ *                         order of GLCD_DrawChar)
+ *
+ * Bitmaps, GLCD_BitmapRLE, RGB565:
+ *
+ *   1 nnnnnnn hi lo       n + 2 copies of pixel hi:lo
+ *   0 nnnnnnn hi lo ...   n + 1 literal pixels
+ *
+ * with every pixel high byte first, as it is sent.  Unlike the raw arrays
+ * GLCD_Bitmap takes, the rows run top down.
+ *
+ * The encoders live on the host (tools/rle_codec.h, used by font_gen and
+ * img_gen) and pick packets by an optimal parse, so a stream is never
+ * longer than the raw pixels plus one byte per 7 (glyphs) or per 128
+ * (bitmaps).  Background runs cost one byte per 64 or 129 pixels.
+ */
+#pragma once
+
+#define RLE_RUN          0x80u          /* packet type bit, both formats */
+
+#define RLE_G_COLOR      0x40u          /* glyph run: text colour */
+#define RLE_G_LEN        0x3Fu          /* glyph run: length - 1 */
+#define RLE_G_RUN_MAX    64u
+#define RLE_G_LIT        7u             /* pixels in a glyph literal */
+
+#define RLE_B_LEN        0x7Fu          /* bitmap packet length field */
+#define RLE_B_RUN_MIN    2u             /* run length = field + 2 */
+#define RLE_B_RUN_MAX    129u
+#define RLE_B_LIT_MAX    128u           /* literal length = field + 1 */
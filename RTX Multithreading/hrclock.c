@@ -0,0 +1,53 @@
+/* COE718 Lab 3a - 64-bit monotonic high-resolution clock, see hrclock.h */
+
+#include "hrclock.h"
+#include "cmsis_os.h"
+#include "time_units.h"
+
+hrclock_conv_t g_hrclock;
+
+static volatile uint32_t hrc_hi;        /* CYCCNT wraps seen */
+static volatile uint32_t hrc_last;      /* CYCCNT at the previous read */
+
+TU_CHECK_MS(hrc_refresh, HRC_REFRESH_MS);
+
+uint64_t hrclock_now(void)
+{
+  uint32_t primask = __get_PRIMASK(), lo, hi;
+
+  __disable_irq();
+  lo = DWT->CYCCNT;
+  if (lo < hrc_last) hrc_hi++;
+  hrc_last = lo;
+  hi = hrc_hi;
+  __set_PRIMASK(primask);
+  return ((uint64_t)hi << 32) | lo;
+}
+
+static void hrclock_refresh(void const *arg)
+{
+  (void)arg;
+  (void)hrclock_now();
+}
+osTimerDef(hrc_refresh, hrclock_refresh);
+
+int hrclock_init(void)
+{
+  static osTimerId refresh;
+  uint32_t hz = SystemCoreClock;
+
+  if (refresh) return 0;                /* already running: stay monotonic */
+  g_hrclock.hz     = hz;
+  g_hrclock.us_q32 = (uint32_t)((1000000ULL << 32) / hz);
+  g_hrclock.ns_q24 = (uint32_t)((1000000000ULL << 24) / hz);  /* hz > 3.9 MHz */
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+  hrc_hi   = 0u;
+  hrc_last = 0u;
+
+  refresh = osTimerCreate(osTimer(hrc_refresh), osTimerPeriodic, NULL);
+  if (!refresh) return -1;
+  return (osTimerStart(refresh, TU_DELAY_MS(HRC_REFRESH_MS)) == osOK) ? 0 : -1;
+}
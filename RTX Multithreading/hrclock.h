@@ -0,0 +1,57 @@
+/* COE718 Lab 3a - 64-bit monotonic high-resolution clock
+ *
+ * Counts core cycles with DWT CYCCNT and extends it to 64 bits in software:
+ * every read compares CYCCNT with the last value seen and carries into the
+ * high word on a wrap, under a few cycles of PRIMASK so threads and ISRs
+ * can both call it.  At 100 MHz CYCCNT wraps every ~43 s; a periodic RTX
+ * timer reads the clock every HRC_REFRESH_MS so no wrap is ever missed.
+ *
+ * hrclock_cyc32() is the raw 32-bit counter for short intervals (deltas
+ * are correct across one wrap); hrclock_now() is the full 64-bit stamp.
+ * Conversions use multipliers precomputed from SystemCoreClock in
+ * hrclock_init(), so they cost two multiplies and no division.
+ */
+#pragma once
+#include "LPC17xx.h"
+#include <stdint.h>
+
+#define HRC_REFRESH_MS   2000u          /* real time between wrap checks */
+
+typedef struct {
+  uint32_t hz;                          /* SystemCoreClock at init */
+  uint32_t us_q32;                      /* 1e6 / hz in Q32 */
+  uint32_t ns_q24;                      /* 1e9 / hz in Q24 */
+} hrclock_conv_t;
+
+extern hrclock_conv_t g_hrclock;
+
+int      hrclock_init(void);             /* enables CYCCNT, starts refresh */
+uint64_t hrclock_now(void);              /* cycles since hrclock_init() */
+
+static __inline uint32_t hrclock_cyc32(void)
+{
+  return DWT->CYCCNT;
+}
+
+/* 64-bit cycle stamp -> time: t * m >> s split into the high and low
+   words of t so every product fits in 64 bits */
+static __inline uint64_t hrclock_to_us(uint64_t t)
+{
+  return (uint64_t)(uint32_t)(t >> 32) * g_hrclock.us_q32 +
+         (((uint64_t)(uint32_t)t * g_hrclock.us_q32) >> 32);
+}
+static __inline uint64_t hrclock_to_ns(uint64_t t)
+{
+  return (((uint64_t)(uint32_t)(t >> 32) * g_hrclock.ns_q24) << 8) +
+         (((uint64_t)(uint32_t)t * g_hrclock.ns_q24) >> 24);
+}
+
+/* 32-bit cycle delta -> time */
+static __inline uint32_t hrclock_cyc_to_us(uint32_t dt)
+{
+  return (uint32_t)(((uint64_t)dt * g_hrclock.us_q32) >> 32);
+}
+static __inline uint64_t hrclock_cyc_to_ns(uint32_t dt)
+{
+  return ((uint64_t)dt * g_hrclock.ns_q24) >> 24;
+}
@@ -1,6 +1,11 @@
 #define osObjectsPublic
 #include "osObjects.h"
 #include "cmsis_os.h"
+#include "time_units.h"
+#include "hrclock.h"
+#include "workload.h"
+#include "telem.h"
+#include "profile.h"
 
 extern int Init_Thread(void);
 
@@ -9,10 +14,18 @@ extern void SystemInit(void);
 int main(void) {
   SystemInit();                 /* clocks, PLL, SysTick base */
   osKernelInitialize();         /* init RTX kernel */
+  (void)hrclock_init();         /* DWT cycle clock + wrap refresh timer */
+  wl_init();                    /* calibrate the synthetic workloads */
   if (Init_Thread() != 0) {
     /* If you want, spin here  but RTX will still start */
   }
+#if TELEMETRY
+  (void)tm_init();              /* after Init_Thread(): names its threads */
+#endif
+#if PROFILE
+  (void)pf_init();              /* TIMER3 PC sampling from here on */
+#endif
   osKernelStart();              /* start scheduler: threads now run */
   /* idle forever */
-  for (;;) { osDelay(1000); }
+  for (;;) { osDelay(TU_DELAY_MS(1000u)); }
 }
@@ -0,0 +1,100 @@
+/* COE718 Lab 3a - zero-copy message ring, see msg_ring.h */
+
+#include "msg_ring.h"
+#include "LPC17xx.h"            /* __DMB */
+#include "trace.h"
+
+/* ------------------- Payload pool ------------------- */
+typedef struct { char b[MSG_BUF_SIZE]; } msg_block_t;
+
+osPoolDef(msg_pool, MSG_POOL_BLOCKS, msg_block_t);
+static osPoolId msg_pool;
+
+volatile uint32_t msg_pool_in_use = 0;   /* watch: blocks currently owned */
+
+int msg_pool_init(void)
+{
+  msg_pool = osPoolCreate(osPool(msg_pool));
+  return msg_pool ? 0 : -1;
+}
+
+char *msg_buf_alloc(void)
+{
+  char *p = (char *)osPoolAlloc(msg_pool);
+  if (p) { p[0] = '\0'; msg_pool_in_use++; }
+  return p;
+}
+
+void msg_buf_free(char *buf)
+{
+  if (buf && osPoolFree(msg_pool, buf) == osOK) msg_pool_in_use--;
+}
+
+uint16_t msg_buf_append(char *buf, uint16_t len, const char *src)
+{
+  while (src && *src && len < MSG_BUF_SIZE - 1u) buf[len++] = *src++;
+  buf[len] = '\0';
+  return len;
+}
+
+/* ------------------- SPSC ring ------------------- */
+void msg_ring_init(msg_ring_t *r, osThreadId consumer, int32_t signal)
+{
+  r->head = r->tail = r->pending = 0u;
+  r->consumer = consumer;
+  r->signal   = signal;
+  r->commits  = 0u;
+  r->full     = 0u;
+}
+
+/* Consumer side: become the consumer.  consumer is stored before head is
+   read and commit stores head before it reads consumer, so a batch is
+   never left without a wake-up (at worst it gets two). */
+void msg_ring_bind(msg_ring_t *r)
+{
+  osThreadId self = osThreadGetId();
+
+  r->consumer = self;
+  __DMB();
+  if (r->head != r->tail) TRACE_SIGNAL_SET(self, r->signal);
+}
+
+/* Producer side: stage one descriptor.  Not visible until commit. */
+int msg_ring_push(msg_ring_t *r, char *data, uint16_t len, uint16_t tag)
+{
+  msg_desc_t *d;
+  if (r->pending - r->tail >= MSG_RING_SLOTS) { r->full++; return -1; }
+  d = &r->slot[r->pending & (MSG_RING_SLOTS - 1u)];
+  d->data = data;
+  d->len  = len;
+  d->tag  = tag;
+  r->pending++;
+  return 0;
+}
+
+/* Producer side: publish the staged batch and wake the consumer once. */
+void msg_ring_commit(msg_ring_t *r)
+{
+  if (r->pending == r->head) return;
+  __DMB();                      /* slot contents before head */
+  r->head = r->pending;
+  r->commits++;
+  if (r->consumer) TRACE_SIGNAL_SET(r->consumer, r->signal);
+}
+
+/* Consumer side: take ownership of the oldest published descriptor. */
+int msg_ring_pop(msg_ring_t *r, msg_desc_t *out)
+{
+  uint32_t t = r->tail;
+  if (t == r->head) return 0;
+  __DMB();                      /* head before slot contents */
+  *out = r->slot[t & (MSG_RING_SLOTS - 1u)];
+  __DMB();                      /* slot read before releasing it */
+  r->tail = t + 1u;
+  return 1;
+}
+
+uint32_t msg_ring_count(const msg_ring_t *r)
+{
+  return r->head - r->tail;
+}
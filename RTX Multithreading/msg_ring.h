@@ -0,0 +1,55 @@
+/* COE718 Lab 3a - zero-copy message ring (App -> Device hand-off)
+ *
+ * Single-producer / single-consumer ring of message descriptors.  The
+ * payload lives in a block taken from the message pool; only the pointer
+ * moves through the ring, so ownership passes from producer to consumer
+ * without strcpy/strcat and without a mutex.
+ *
+ *   producer:  msg_buf_alloc() -> fill -> msg_ring_push() ... msg_ring_commit()
+ *   consumer:  osSignalWait(sig) -> while (msg_ring_pop()) { use; msg_buf_free(); }
+ *
+ * msg_ring_commit() publishes every descriptor pushed since the last commit
+ * and sets the consumer's signal once, so a batch costs one wake-up.
+ *
+ * A ring can be set up before its threads exist: init it with no
+ * consumer and have the consumer call msg_ring_bind() before its first
+ * wait.  A batch committed before the bind then wakes it from there.
+ */
+#pragma once
+#include "cmsis_os.h"
+#include <stdint.h>
+
+#define MSG_RING_SLOTS   16u    /* power of two */
+#define MSG_BUF_SIZE     64u    /* bytes per pooled payload block */
+#define MSG_POOL_BLOCKS  24u    /* > 1 ring in flight plus one being filled */
+
+typedef struct {
+  char     *data;               /* pool block, owned by whoever holds the desc */
+  uint16_t  len;                /* bytes used in data (no terminator counted) */
+  uint16_t  tag;                /* producer-defined record kind */
+} msg_desc_t;
+
+typedef struct {
+  volatile uint32_t head;       /* next free slot, written by producer only */
+  volatile uint32_t tail;       /* next full slot, written by consumer only */
+  uint32_t          pending;    /* producer-local head, not yet published */
+  osThreadId volatile consumer; /* woken by msg_ring_commit(), 0 = none yet */
+  int32_t           signal;
+  volatile uint32_t commits;    /* watch: wake-ups issued */
+  volatile uint32_t full;       /* watch: pushes refused because ring full */
+  msg_desc_t        slot[MSG_RING_SLOTS];
+} msg_ring_t;
+
+int   msg_pool_init(void);
+char *msg_buf_alloc(void);
+void  msg_buf_free(char *buf);
+
+void     msg_ring_init  (msg_ring_t *r, osThreadId consumer, int32_t signal);
+void     msg_ring_bind  (msg_ring_t *r);
+int      msg_ring_push  (msg_ring_t *r, char *data, uint16_t len, uint16_t tag);
+void     msg_ring_commit(msg_ring_t *r);
+int      msg_ring_pop   (msg_ring_t *r, msg_desc_t *out);
+uint32_t msg_ring_count (const msg_ring_t *r);
+
+/* append helper for pooled buffers; returns new length */
+uint16_t msg_buf_append(char *buf, uint16_t len, const char *src);
@@ -0,0 +1,146 @@
+/* COE718 Lab 3a - mutex blocking-time / priority-inheritance probe,
+   see mutex_probe.h */
+
+#include "mutex_probe.h"
+#include "LPC17xx.h"            /* __LDREXW/__STREXW */
+#include "hrclock.h"
+#include "qstat.h"
+
+mp_mutex_report_t g_mp_report[MP_MAX_MUTEXES];
+mp_thread_stat_t  g_mp_thread[TRACE_MAX_THREADS];
+mp_block_rec_t    g_mp_log[MP_LOG_SLOTS];
+volatile uint32_t g_mp_log_head = 0;
+
+static mp_mutex_t *mp_all[MP_MAX_MUTEXES];
+static uint32_t    mp_count;
+
+int mp_create(mp_mutex_t *m, const osMutexDef_t *def, const char *name)
+{
+  if (mp_count >= MP_MAX_MUTEXES) return -1;
+  m->id   = osMutexCreate(def);
+  if (!m->id) return -1;
+  m->name  = name;
+  m->index = (uint8_t)mp_count;
+  m->holder = 0;
+  m->nest   = 0u;
+  m->last_boosted = 0u;
+  m->acquisitions = m->contended = m->boosts = 0u;
+  m->wait_total = 0u;
+  m->wait_max = m->hold_max = 0u;
+  mp_all[mp_count++] = m;
+  return 0;
+}
+
+void mp_report(void)
+{
+  uint32_t i;
+  for (i = 0; i < mp_count; ++i) {
+    const mp_mutex_t *m = mp_all[i];
+    mp_mutex_report_t *r = &g_mp_report[i];
+    r->name         = m->name;
+    r->acquisitions = m->acquisitions;
+    r->contended    = m->contended;
+    r->wait_mean    = m->contended ? (uint32_t)(m->wait_total / m->contended) : 0u;
+    r->wait_max     = m->wait_max;
+    r->hold_max     = m->hold_max;
+    r->boosts       = m->boosts;
+  }
+}
+
+#if MUTEX_ANALYSIS
+
+static void mp_log(const mp_mutex_t *m, uint8_t holder, uint8_t waiter, uint32_t wait)
+{
+  uint32_t h;
+  mp_block_rec_t *r;
+  do {
+    h = __LDREXW(&g_mp_log_head);
+  } while (__STREXW(h + 1u, &g_mp_log_head));
+  r = &g_mp_log[h & (MP_LOG_SLOTS - 1u)];
+  r->wait    = wait;
+  r->mutex   = m->index;
+  r->holder  = holder;
+  r->waiter  = waiter;
+  r->boosted = m->last_boosted;
+}
+
+osStatus mp_wait(mp_mutex_t *m, uint32_t millisec)
+{
+  osThreadId self = osThreadGetId();
+  uint8_t    me   = trace_self();
+  osStatus   st;
+  uint32_t   now;
+
+  if (m->holder == self) {                   /* recursive take */
+    st = osMutexWait(m->id, millisec);
+    if (st == osOK) m->nest++;
+    return st;
+  }
+
+  st = osMutexWait(m->id, 0u);
+  if (st != osOK) {
+    uint8_t  holder = m->holder_slot;        /* snapshot: who blocks us */
+    uint32_t t0 = hrclock_cyc32(), wait;
+
+    TRACE(TR_MUTEX_WAIT, m->index);
+    st = osMutexWait(m->id, millisec);
+    if (st != osOK) return st;
+    now  = hrclock_cyc32();
+    wait = now - t0;
+
+    /* we own the mutex: its counters are ours to update */
+    m->contended++;
+    m->wait_total += wait;
+    if (wait > m->wait_max) m->wait_max = wait;
+    mp_log(m, holder, me, wait);
+    QS_ADD(QS_MUTEX_WAIT, wait);
+    if (me < TRACE_MAX_THREADS) {
+      mp_thread_stat_t *ts = &g_mp_thread[me];
+      ts->blocked_count++;
+      ts->blocked_total += wait;
+      if (wait > ts->blocked_max) ts->blocked_max = wait;
+    }
+  } else {
+    now = hrclock_cyc32();
+  }
+
+  m->holder       = self;
+  m->holder_slot  = me;
+  m->holder_base  = osThreadGetPriority(self);
+  m->acquired_at  = now;
+  m->nest         = 1u;
+  m->last_boosted = 0u;
+  m->acquisitions++;
+  TRACE(TR_MUTEX_ACQUIRE, m->index);
+  return osOK;
+}
+
+osStatus mp_release(mp_mutex_t *m)
+{
+  uint32_t hold;
+  uint8_t  boosted;
+
+  if (m->holder != osThreadGetId()) return osErrorResource;
+  if (m->nest > 1u) {
+    m->nest--;
+    return osMutexRelease(m->id);
+  }
+
+  hold = hrclock_cyc32() - m->acquired_at;
+  if (hold > m->hold_max) m->hold_max = hold;
+
+  /* RTX raises the owner to the highest waiter's priority; it is still
+     raised here, just before the release restores it */
+  boosted = (uint8_t)(osThreadGetPriority(m->holder) > m->holder_base);
+  if (boosted) {
+    m->boosts++;
+    TRACE(TR_PRIO_BOOST, m->index);
+  }
+  m->last_boosted = boosted;
+  m->nest   = 0u;
+  m->holder = 0;
+  TRACE(TR_MUTEX_RELEASE, m->index);
+  return osMutexRelease(m->id);
+}
+
+#endif /* MUTEX_ANALYSIS */
@@ -0,0 +1,82 @@
+/* COE718 Lab 3a - mutex blocking-time / priority-inheritance probe
+ *
+ * Wraps an RTX mutex.  With MUTEX_ANALYSIS=0 mp_wait()/mp_release() are
+ * plain osMutexWait()/osMutexRelease().  With MUTEX_ANALYSIS=1 every
+ * contended wait is timed and logged with holder, waiter and whether RTX
+ * priority inheritance boosted the holder during that critical section
+ * (the holder's priority at release is above the one it acquired with).
+ *
+ * mp_report() folds the counters into g_mp_report[] (per mutex) and
+ * g_mp_thread[] (per trace thread slot) for the Watch window.
+ */
+#pragma once
+#include "cmsis_os.h"
+#include "trace.h"
+#include <stdint.h>
+
+#ifndef MUTEX_ANALYSIS
+# define MUTEX_ANALYSIS   0
+#endif
+
+#define MP_MAX_MUTEXES    4u
+#define MP_LOG_SLOTS      32u           /* power of two */
+
+typedef struct {
+  osMutexId           id;
+  const char         *name;
+  uint8_t             index;            /* slot in g_mp_report[] */
+  /* holder state, touched only by the thread that owns the mutex */
+  volatile osThreadId holder;
+  uint8_t             holder_slot;      /* trace slot */
+  uint8_t             nest;
+  osPriority          holder_base;      /* holder priority when it acquired */
+  uint32_t            acquired_at;
+  volatile uint8_t    last_boosted;     /* previous holder was boosted */
+  /* counters */
+  uint32_t            acquisitions;
+  uint32_t            contended;
+  uint32_t            boosts;
+  uint64_t            wait_total;
+  uint32_t            wait_max;
+  uint32_t            hold_max;
+} mp_mutex_t;
+
+typedef struct {
+  const char *name;
+  uint32_t    acquisitions;
+  uint32_t    contended;
+  uint32_t    wait_mean;                /* cycles, over contended waits */
+  uint32_t    wait_max;
+  uint32_t    hold_max;
+  uint32_t    boosts;
+} mp_mutex_report_t;
+
+typedef struct {
+  uint32_t blocked_count;
+  uint32_t blocked_total;               /* cycles */
+  uint32_t blocked_max;
+} mp_thread_stat_t;
+
+typedef struct {
+  uint32_t wait;                        /* cycles */
+  uint8_t  mutex;
+  uint8_t  holder;                      /* trace slots */
+  uint8_t  waiter;
+  uint8_t  boosted;
+} mp_block_rec_t;
+
+extern mp_mutex_report_t g_mp_report[MP_MAX_MUTEXES];
+extern mp_thread_stat_t  g_mp_thread[TRACE_MAX_THREADS];
+extern mp_block_rec_t    g_mp_log[MP_LOG_SLOTS];
+extern volatile uint32_t g_mp_log_head;
+
+int      mp_create (mp_mutex_t *m, const osMutexDef_t *def, const char *name);
+void     mp_report (void);
+
+#if MUTEX_ANALYSIS
+osStatus mp_wait   (mp_mutex_t *m, uint32_t millisec);
+osStatus mp_release(mp_mutex_t *m);
+#else
+# define mp_wait(m, ms)   osMutexWait((m)->id, (ms))
+# define mp_release(m)    osMutexRelease((m)->id)
+#endif
@@ -0,0 +1,209 @@
+/* COE718 Lab 3a - rate-monotonic periodic tasks, see periodic.h */
+
+#include "periodic.h"
+#include "edf.h"
+#include "hrclock.h"
+#include "time_units.h"
+#include "trace.h"
+#include "qstat.h"
+#include "LPC17xx.h"            /* __LDREXW/__STREXW */
+#include <string.h>
+
+pt_task_t         g_pt_task[PT_MAX_TASKS];
+pt_job_rec_t      g_pt_log[PT_LOG_SLOTS];
+volatile uint32_t g_pt_log_head = 0;
+volatile uint32_t g_pt_active   = 0;
+
+static uint32_t pt_n;
+static uint32_t pt_tick;                /* timer ticks since the first one */
+static uint32_t pt_step;                /* kernel ticks per timer tick */
+static uint64_t pt_base_cyc;            /* hrclock at timer tick 0 */
+static pt_policy_t pt_policy;
+static osTimerId pt_timer;
+
+/* ------------------- Release timer ------------------- */
+static void pt_release(void const *arg)
+{
+  uint64_t now = hrclock_now();
+  uint32_t i;
+  (void)arg;
+
+  if (pt_tick == 0u) pt_base_cyc = now;
+  for (i = 0; i < pt_n; ++i) {
+    pt_task_t *t = &g_pt_task[i];
+    if (t->done || t->next_tick != pt_tick) continue;
+    t->next_tick += t->period_ticks / pt_step;
+    if (t->busy) {                      /* previous job still running */
+      t->st.skipped++;
+      t->st.missed++;
+      continue;
+    }
+    t->release_cyc = pt_base_cyc + (uint64_t)pt_tick * pt_step * TU_TICK_CYCLES;
+    t->busy = 1u;
+    t->st.released++;
+    if (pt_policy == PT_EDF) {
+      t->abs_deadline = pt_tick * pt_step + t->deadline_ticks;
+      edf_release(t);
+    }
+    TRACE(TR_PT_RELEASE, i);
+    osSignalSet(t->tid, PT_SIG_RELEASE);
+  }
+  pt_tick++;
+}
+osTimerDef(pt_timer, pt_release);
+
+/* ------------------- Task thread ------------------- */
+static void pt_log(const pt_task_t *t, uint32_t jitter, uint32_t resp, uint8_t missed)
+{
+  uint32_t h;
+  pt_job_rec_t *r;
+
+  do {
+    h = __LDREXW(&g_pt_log_head);
+  } while (__STREXW(h + 1u, &g_pt_log_head));
+  r = &g_pt_log[h & (PT_LOG_SLOTS - 1u)];
+  r->release = (uint32_t)t->release_cyc;
+  r->jitter  = jitter;
+  r->resp    = resp;
+  r->task    = t->index;
+  r->missed  = missed;
+  r->seq     = (uint16_t)t->st.completed;
+}
+
+void pt_thread(void const *arg);
+osThreadDef(pt_thread, osPriorityNormal, PT_MAX_TASKS, 0);
+
+void pt_thread(void const *arg)
+{
+  pt_task_t *t = (pt_task_t *)arg;
+  pt_stat_t *st = &t->st;
+
+  for (;;) {
+    uint64_t start, end;
+    uint32_t jitter, resp, exec;
+    uint8_t  missed;
+
+    (void)osSignalWait(PT_SIG_RELEASE, osWaitForever);
+    start = hrclock_now();
+    TRACE(TR_PT_START, t->index);
+    t->def->job(t->def->ctx);
+    end = hrclock_now();
+    TRACE(TR_PT_END, t->index);
+    if (pt_policy == PT_EDF) edf_complete(t);
+
+    /* tick 0 is timestamped after the timer thread woke, so a later
+       release can start marginally "before" its ideal instant */
+    jitter = (start > t->release_cyc) ? (uint32_t)(start - t->release_cyc) : 0u;
+    resp   = (end   > t->release_cyc) ? (uint32_t)(end   - t->release_cyc) : 0u;
+    exec   = (uint32_t)(end - start);
+    missed = (uint8_t)(resp > t->deadline_cyc);
+    QS_ADD(QS_ACTIVATION, jitter);
+
+    st->completed++;
+    st->jitter_sum += jitter;
+    st->resp_sum   += resp;
+    if (jitter > st->jitter_max) st->jitter_max = jitter;
+    if (resp   > st->resp_max)   st->resp_max   = resp;
+    if (exec   > st->exec_max)   st->exec_max   = exec;
+    if (exec > t->wcet_cyc) st->over_budget++;
+    if (missed) st->missed++;
+    pt_log(t, jitter, resp, missed);
+
+    if (t->def->jobs && st->completed >= t->def->jobs) {
+      uint32_t a;
+      t->done = 1u;
+      t->busy = 0u;
+      do {
+        a = __LDREXW(&g_pt_active);
+      } while (__STREXW(a - 1u, &g_pt_active));
+      if (a == 1u) (void)osTimerStop(pt_timer);
+      osThreadTerminate(osThreadGetId());
+    }
+    t->busy = 0u;                       /* last: the timer may release again */
+  }
+}
+
+/* ------------------- Setup ------------------- */
+static uint32_t gcd_u32(uint32_t a, uint32_t b)
+{
+  while (b) { uint32_t r = a % b; a = b; b = r; }
+  return a;
+}
+
+/* Rate-monotonic: rank by distinct period, shortest first */
+static osPriority pt_rm_prio(const pt_task_def_t *defs, uint32_t n, uint32_t k)
+{
+  uint32_t i, j, rank = 0u;
+  int      p;
+
+  for (i = 0; i < n; ++i) {
+    uint32_t seen = 0u;
+    if (defs[i].period_ms >= defs[k].period_ms) continue;
+    for (j = 0; j < i; ++j) {           /* count each shorter period once */
+      if (defs[j].period_ms == defs[i].period_ms) { seen = 1u; break; }
+    }
+    if (!seen) rank++;
+  }
+  p = (int)PT_PRIO_TOP - (int)rank;
+  if (p < (int)osPriorityLow) p = (int)osPriorityLow;
+  return (osPriority)p;
+}
+
+int pt_start(const pt_task_def_t *defs, uint32_t n, pt_policy_t policy)
+{
+  uint32_t i, step = 0u;
+
+  if (n == 0u || n > PT_MAX_TASKS || g_pt_active) return -1;
+  for (i = 0; i < n; ++i) {
+    const pt_task_def_t *d = &defs[i];
+    uint32_t dl = d->deadline_ms ? d->deadline_ms : d->period_ms;
+    if (!d->job || d->period_ms == 0u || dl > d->period_ms) return -1;
+    if ((d->period_ms * 1000u) % TU_TICK_US || (dl * 1000u) % TU_TICK_US) return -1;
+    step = gcd_u32(step, (d->period_ms * 1000u) / TU_TICK_US);
+  }
+
+  if (!pt_timer) pt_timer = osTimerCreate(osTimer(pt_timer), osTimerPeriodic, NULL);
+  if (!pt_timer) return -1;
+  if (policy == PT_EDF && edf_init() != 0) return -1;
+  pt_n      = 0u;                       /* timer ignores the table meanwhile */
+  pt_tick   = 0u;
+  pt_policy = policy;
+  memset(g_pt_task, 0, sizeof(g_pt_task));
+
+  for (i = 0; i < n; ++i) {
+    const pt_task_def_t *d = &defs[i];
+    pt_task_t *t = &g_pt_task[i];
+    uint32_t dl = d->deadline_ms ? d->deadline_ms : d->period_ms;
+
+    t->def            = d;
+    t->index          = (uint8_t)i;
+    t->period_ticks   = (d->period_ms * 1000u) / TU_TICK_US;
+    t->deadline_ticks = (dl * 1000u) / TU_TICK_US;
+    t->deadline_cyc   = t->deadline_ticks * TU_TICK_CYCLES;
+    t->wcet_cyc       = d->wcet_us * TU_CYCLES_PER_US;
+    t->next_tick      = 0u;             /* all released together at tick 0 */
+    t->heap_pos       = 0xFFu;
+    if (policy == PT_EDF)           t->prio = PT_EDF_LOW;
+    else if (policy == PT_RR)       t->prio = osPriorityNormal;
+    else if (d->prio == PT_PRIO_RM) t->prio = pt_rm_prio(defs, n, i);
+    else                            t->prio = d->prio;
+    t->tid = osThreadCreate(osThread(pt_thread), t);
+    if (!t->tid) return -1;
+    (void)osThreadSetPriority(t->tid, t->prio);
+    (void)trace_register(t->tid, d->name);
+  }
+  pt_n        = n;
+  pt_step     = step;
+  g_pt_active = n;
+  return (osTimerStart(pt_timer, TU_DELAY_TICKS(step)) == osOK) ? 0 : -1;
+}
+
+uint32_t pt_mean_jitter(const pt_task_t *t)
+{
+  return t->st.completed ? (uint32_t)(t->st.jitter_sum / t->st.completed) : 0u;
+}
+
+uint32_t pt_mean_resp(const pt_task_t *t)
+{
+  return t->st.completed ? (uint32_t)(t->st.resp_sum / t->st.completed) : 0u;
+}
@@ -0,0 +1,103 @@
+/* COE718 Lab 3a - rate-monotonic periodic tasks
+ *
+ * Each task is a job function run once per period on its own thread.
+ * pt_start() gives every task with prio == PT_PRIO_RM a rate-monotonic
+ * priority (shorter period -> higher, from PT_PRIO_TOP down), creates the
+ * threads and starts one periodic RTX timer at the gcd of the periods.
+ * The timer counts kernel ticks, so releases never drift; each job is
+ * released by setting PT_SIG_RELEASE on its thread.
+ *
+ * Every job is measured against its ideal release instant (first timer
+ * tick + k * period): release jitter (start - ideal), response time
+ * (finish - ideal) and execution time (finish - start, preemption
+ * included).  A job misses its deadline when the response exceeds the
+ * deadline, or when the next release finds it still running; that
+ * release is skipped.  All times are hrclock cycles.
+ *
+ * The policy passed to pt_start() picks how priorities are used:
+ *   PT_RM   fixed priorities: rate-monotonic for PT_PRIO_RM tasks
+ *   PT_EDF  earliest deadline first through edf.h, which keeps the
+ *           earliest-deadline job at PT_PRIO_TOP and the rest at
+ *           PT_EDF_LOW, remapped on every release and completion
+ *   PT_RR   every task at osPriorityNormal, sliced by OS_ROBIN
+ *
+ * Periods and deadlines must be whole kernel ticks (see time_units.h).
+ * The timer thread (OS_TIMERPRIO, High) must stay above PT_PRIO_TOP.
+ * pt_start() may be called again once g_pt_active has dropped to 0.
+ */
+#pragma once
+#include "cmsis_os.h"
+#include <stdint.h>
+
+#define PT_MAX_TASKS     4u
+#define PT_LOG_SLOTS     64u            /* per-job records, power of two */
+#define PT_SIG_RELEASE   (1 << 14)
+#define PT_PRIO_RM       osPriorityError     /* let pt_start() choose */
+#define PT_PRIO_TOP      osPriorityAboveNormal
+#define PT_EDF_LOW       osPriorityLow
+
+typedef enum { PT_RM = 0, PT_EDF, PT_RR } pt_policy_t;
+
+typedef void (*pt_job_fn_t)(void *ctx);
+
+typedef struct {
+  const char  *name;
+  pt_job_fn_t  job;
+  void        *ctx;
+  uint32_t     period_ms;
+  uint32_t     deadline_ms;             /* 0: deadline = period */
+  uint32_t     wcet_us;                 /* budget; exceeded jobs are counted */
+  osPriority   prio;                    /* PT_PRIO_RM or a fixed priority */
+  uint32_t     jobs;                    /* jobs to run, 0 = forever */
+} pt_task_def_t;
+
+typedef struct {
+  uint32_t released;
+  uint32_t completed;
+  uint32_t missed;                      /* late finish or skipped release */
+  uint32_t skipped;                     /* releases lost to an overrun */
+  uint32_t over_budget;                 /* exec > wcet */
+  uint32_t jitter_max;
+  uint32_t resp_max;
+  uint32_t exec_max;
+  uint64_t jitter_sum;
+  uint64_t resp_sum;
+} pt_stat_t;
+
+typedef struct {
+  const pt_task_def_t *def;
+  osThreadId     tid;
+  osPriority     prio;                  /* as assigned */
+  uint32_t       period_ticks;
+  uint32_t       deadline_cyc;
+  uint32_t       wcet_cyc;
+  uint32_t       next_tick;             /* next release, in timer ticks */
+  uint64_t       release_cyc;           /* ideal release of the current job */
+  uint32_t       deadline_ticks;        /* relative, kernel ticks */
+  uint32_t       abs_deadline;          /* EDF key, in kernel ticks */
+  uint8_t        heap_pos;              /* EDF ready-heap slot, 0xFF = none */
+  volatile uint8_t busy;                /* released and not yet finished */
+  volatile uint8_t done;
+  uint8_t        index;
+  pt_stat_t      st;
+} pt_task_t;
+
+typedef struct {
+  uint32_t release;                     /* low word of the ideal release */
+  uint32_t jitter;
+  uint32_t resp;
+  uint8_t  task;
+  uint8_t  missed;
+  uint16_t seq;
+} pt_job_rec_t;
+
+extern pt_task_t         g_pt_task[PT_MAX_TASKS];
+extern pt_job_rec_t      g_pt_log[PT_LOG_SLOTS];
+extern volatile uint32_t g_pt_log_head;
+extern volatile uint32_t g_pt_active;  /* tasks still running jobs */
+
+/* Returns -1 on a bad table (too many tasks, period not a whole tick,
+   deadline > period) or when an RTX object cannot be created. */
+int      pt_start(const pt_task_def_t *defs, uint32_t n, pt_policy_t policy);
+uint32_t pt_mean_jitter(const pt_task_t *t);
+uint32_t pt_mean_resp(const pt_task_t *t);
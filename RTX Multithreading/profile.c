@@ -0,0 +1,110 @@
+/* COE718 Lab 3a - statistical CPU profiler, see profile.h */
+
+#include "profile.h"
+
+#if PROFILE
+#include "time_units.h"
+#include "rtx_internal.h"
+#include "LPC17xx.h"
+#include <string.h>
+
+#define PF_TIMER_PER_US  (TU_TIMER3_HZ / 1000000uL)
+TU_STATIC_ASSERT(pf_timer_whole_mhz, TU_TIMER3_HZ % 1000000uL == 0uL);
+TU_STATIC_ASSERT(pf_dither_fits, PF_PERIOD_US * PF_TIMER_PER_US > 2uL * PF_DITHER);
+TU_STATIC_ASSERT(pf_other_is_no_thread, PF_CTX_OTHER == TRACE_NO_THREAD);
+
+pf_prof_t g_prof;
+
+static uint32_t pf_lfsr = 0xACE1u;
+
+/* ------------------- Sampling ISR ------------------- */
+static __inline uint32_t pf_hash(uint32_t pc, uint32_t lr, uint32_t ctx)
+{
+  uint32_t h = (pc >> 1) * 0x9E3779B1u ^ (lr >> 1) * 0x85EBCA6Bu ^ ctx;
+  return h ^ (h >> 15);
+}
+
+/* Called from TIMER3_IRQHandler with the interrupted context's exception
+   frame (r0-r3, r12, lr, pc, xPSR) and the handler's EXC_RETURN. */
+void pf_sample(const uint32_t *frame, uint32_t exc_return)
+{
+  uint32_t pc = frame[6] & ~1u, lr = frame[5], ctx, h, i;
+
+  LPC_TIM3->IR  = 1u;                   /* MR0 */
+  pf_lfsr = (pf_lfsr >> 1) ^ (-(pf_lfsr & 1u) & 0xB400u);
+  LPC_TIM3->MR0 = PF_PERIOD_US * PF_TIMER_PER_US - 1u - PF_DITHER + (pf_lfsr & (2u * PF_DITHER - 1u));
+
+  if (!(exc_return & 8u)) ctx = PF_CTX_ISR | (frame[7] & 0x1FFu);   /* back to handler mode */
+  else                    ctx = trace_slot((osThreadId)os_tsk.run);
+
+  g_prof.samples++;
+  h = pf_hash(pc, lr, ctx);
+  for (i = 0; i < PF_PROBES; ++i) {
+    pf_bin_t *b = &g_prof.bin[(h + i) & (PF_BINS - 1u)];
+    if (b->count == 0u) {
+      b->pc  = pc;
+      b->lr  = lr;
+      b->ctx = (uint16_t)ctx;
+    } else if (b->pc != pc || b->lr != lr || b->ctx != ctx) {
+      continue;
+    }
+    b->count++;
+    return;
+  }
+  g_prof.dropped++;
+}
+
+/* The stacked frame is on MSP or PSP depending on what was interrupted
+   (EXC_RETURN bit 2); pf_sample returns through the untouched LR. */
+__asm void TIMER3_IRQHandler(void)
+{
+        IMPORT  pf_sample
+        TST     LR, #4
+        ITE     EQ
+        MRSEQ   R0, MSP
+        MRSNE   R0, PSP
+        MOV     R1, LR
+        B       pf_sample
+}
+
+/* ------------------- API ------------------- */
+int pf_init(void)
+{
+  LPC_SC->PCONP |= 1u << 23;            /* PCTIM3 */
+  LPC_TIM3->TCR = 2u;
+  LPC_TIM3->PR  = 0u;
+  LPC_TIM3->MR0 = PF_PERIOD_US * PF_TIMER_PER_US - 1u;
+  LPC_TIM3->MCR = 3u;                   /* interrupt and reset on MR0 */
+  LPC_TIM3->IR  = 0x3Fu;
+  NVIC_SetPriority(TIMER3_IRQn, PF_IRQ_PRIO);
+  NVIC_EnableIRQ(TIMER3_IRQn);
+  pf_clear();
+  pf_start();
+  return 0;
+}
+
+void pf_start(void)
+{
+  LPC_TIM3->TCR = 1u;
+}
+
+void pf_stop(void)
+{
+  LPC_TIM3->TCR = 0u;
+  NVIC_ClearPendingIRQ(TIMER3_IRQn);
+  memcpy(g_prof.name, g_trace.name, sizeof(g_prof.name));
+}
+
+void pf_clear(void)
+{
+  uint32_t run = LPC_TIM3->TCR & 1u;
+
+  LPC_TIM3->TCR = 0u;                   /* the ISR is the only other writer */
+  memset(&g_prof, 0, sizeof(g_prof));
+  g_prof.magic     = PF_MAGIC;
+  g_prof.bins      = PF_BINS;
+  g_prof.bin_size  = sizeof(pf_bin_t);
+  g_prof.period_us = PF_PERIOD_US;
+  LPC_TIM3->TCR = run;
+}
+#endif /* PROFILE */
@@ -0,0 +1,72 @@
+/* COE718 Lab 3a - statistical CPU profiler
+ *
+ * TIMER3 interrupts every PF_PERIOD_US (dithered by up to PF_DITHER
+ * timer counts either way so the samples cannot lock onto the 5 ms tick
+ * or the other TIMERn samplers) at the highest NVIC priority, and its
+ * handler charges one sample to the interrupted
+ *
+ *   pc    stacked return address: the instruction that was running
+ *   lr    stacked LR: the caller when pc is in a leaf function, a stale
+ *         return address inside the same function otherwise
+ *   ctx   trace.h slot of the running thread, PF_CTX_OTHER for threads
+ *         that were never registered (the RTX idle demon), or
+ *         PF_CTX_ISR | exception number when another handler was
+ *         interrupted
+ *
+ * in g_prof, an open-addressed table of PF_BINS (pc, lr, ctx) bins.  A
+ * sample whose probe run finds no free bin is counted in g_prof.dropped.
+ * Code that runs with PRIMASK set (qs_snapshot's copy, hrclock) cannot be sampled and
+ * shows up at the instruction that unmasks.
+ *
+ * Build with PROFILE=1; main() calls pf_init(), which starts sampling.
+ * pf_stop() freezes the table and copies the thread names into it, so a
+ * dump of g_prof alone
+ *
+ *   SAVE prof.hex &g_prof, ((char*)&g_prof) + sizeof(g_prof) - 1
+ *
+ * is all tools/prof_report needs besides Objects/Lab3a_Demo.axf for the
+ * symbols.
+ */
+#pragma once
+#include <stdint.h>
+#include "trace.h"
+
+#ifndef PROFILE
+# define PROFILE         0
+#endif
+
+#define PF_MAGIC         0x31465250u    /* "PRF1" */
+#define PF_BINS          512u           /* power of two */
+#define PF_PROBES        16u            /* bins tried per sample */
+#define PF_PERIOD_US     97u            /* prime: no common period with the demos */
+#define PF_DITHER        64u            /* timer counts, power of two */
+#define PF_IRQ_PRIO      0u             /* TIMER3 NVIC priority: above every sampler */
+
+#define PF_CTX_OTHER     0x00FFu        /* = TRACE_NO_THREAD */
+#define PF_CTX_ISR       0x0200u        /* | exception number, 9 bits */
+
+typedef struct {
+  uint32_t pc;                          /* Thumb bit clear */
+  uint32_t lr;
+  uint32_t count;                       /* 0 = free */
+  uint16_t ctx;
+  uint16_t pad;
+} pf_bin_t;
+
+typedef struct {
+  uint32_t          magic;
+  uint32_t          bins;
+  uint32_t          bin_size;
+  uint32_t          period_us;
+  volatile uint32_t samples;            /* taken, dropped included */
+  volatile uint32_t dropped;            /* no free bin */
+  char              name[TRACE_MAX_THREADS][TRACE_NAME_LEN];
+  pf_bin_t          bin[PF_BINS];
+} pf_prof_t;
+
+extern pf_prof_t g_prof;
+
+int  pf_init(void);                     /* clears the table and starts */
+void pf_start(void);
+void pf_stop(void);                     /* also snapshots the thread names */
+void pf_clear(void);
@@ -0,0 +1,291 @@
+/* COE718 Lab 3a - streaming latency statistics, see qstat.h
+ *
+ * qs_update/qs_read are shared with tools/qstat_check.c, which builds
+ * this file with QS_HOST defined.
+ */
+
+#include "qstat.h"
+
+#define QS_ONE           (1uL << 24)    /* Q24 */
+#define QS_Q24(ppm)      ((uint32_t)(((uint64_t)(ppm) << 24) / 1000000u))
+
+static const uint32_t qs_ppm[QS_NQ] = QS_QUANTILES_PPM;
+static const uint32_t qs_p[QS_NQ] = {
+  QS_Q24(500000u), QS_Q24(900000u), QS_Q24(990000u), QS_Q24(999000u)
+};
+
+/* ------------------- P-square ------------------- */
+/* Heights are Q16: a marker moves by a small fraction of a cycle per
+   sample on a long run, which whole cycles would round away every time. */
+
+/* a * b / c without overflow for |b|, c < 2^31 */
+static int64_t qs_muldiv(int64_t a, int64_t b, int64_t c)
+{
+  return (a / c) * b + (a % c) * b / c;
+}
+
+static void p2_start(qs_p2_t *e, const int64_t *x, uint32_t p)
+{
+  uint32_t i;
+
+  for (i = 0; i < 5u; ++i) {
+    e->q[i] = x[i];
+    e->n[i] = (int32_t)i + 1;
+  }
+  e->d[0] = QS_ONE;
+  e->d[1] = QS_ONE + 2u * (uint64_t)p;
+  e->d[2] = QS_ONE + 4u * (uint64_t)p;
+  e->d[3] = 3u * (uint64_t)QS_ONE + 2u * (uint64_t)p;
+  e->d[4] = 5u * (uint64_t)QS_ONE;
+}
+
+static int64_t p2_parabolic(const qs_p2_t *e, int i, int s)
+{
+  int64_t nl = e->n[i] - e->n[i - 1], nr = e->n[i + 1] - e->n[i];
+  int64_t a  = qs_muldiv(e->q[i + 1] - e->q[i], nl + s, nr);
+  int64_t b  = qs_muldiv(e->q[i] - e->q[i - 1], nr - s, nl);
+  return e->q[i] + s * (a + b) / (nl + nr);
+}
+
+static int64_t p2_linear(const qs_p2_t *e, int i, int s)
+{
+  return e->q[i] + s * (e->q[i + s] - e->q[i]) / (e->n[i + s] - e->n[i]);
+}
+
+static void p2_add(qs_p2_t *e, uint32_t p, int64_t x)
+{
+  uint32_t dn[5];
+  int i, k;
+
+  dn[0] = 0u;
+  dn[1] = p / 2u;
+  dn[2] = p;
+  dn[3] = (QS_ONE + p) / 2u;
+  dn[4] = QS_ONE;
+
+  /* cell k holds x: q[k] <= x < q[k+1], extremes widened */
+  if (x < e->q[0]) {
+    e->q[0] = x;
+    k = 0;
+  } else if (x >= e->q[4]) {
+    e->q[4] = x;
+    k = 3;
+  } else {
+    for (k = 0; x >= e->q[k + 1]; ++k) {}
+  }
+  for (i = k + 1; i < 5; ++i) e->n[i]++;
+  for (i = 1; i < 5; ++i) e->d[i] += dn[i];
+
+  /* move each middle marker at most one position towards its desired one */
+  for (i = 1; i < 4; ++i) {
+    int64_t off = (int64_t)e->d[i] - ((int64_t)e->n[i] << 24);
+    if ((off >= (int64_t)QS_ONE && e->n[i + 1] - e->n[i] > 1) ||
+        (off <= -(int64_t)QS_ONE && e->n[i - 1] - e->n[i] < -1)) {
+      int s = (off > 0) ? 1 : -1;
+      int64_t q = p2_parabolic(e, i, s);
+      e->q[i] = (e->q[i - 1] < q && q < e->q[i + 1]) ? q : p2_linear(e, i, s);
+      e->n[i] += s;
+    }
+  }
+}
+
+/* ------------------- 128-bit helpers ------------------- */
+typedef struct { uint64_t hi, lo; } qs_u128_t;
+
+static qs_u128_t qs_mul64(uint64_t a, uint64_t b)
+{
+  qs_u128_t r;
+  uint64_t a0 = (uint32_t)a, a1 = a >> 32, b0 = (uint32_t)b, b1 = b >> 32;
+  uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0;
+  uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+
+  r.lo = (mid << 32) | (uint32_t)p00;
+  r.hi = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+  return r;
+}
+
+/* x / d, saturated to 64 bits */
+static uint64_t qs_div(qs_u128_t x, uint64_t d)
+{
+  uint64_t r = x.hi, q = 0u;
+  int i;
+
+  if (r >= d) return ~(uint64_t)0;
+  for (i = 63; i >= 0; --i) {
+    uint64_t top = r >> 63;
+    r = (r << 1) | ((x.lo >> i) & 1u);
+    q <<= 1;
+    if (top || r >= d) { r -= d; q |= 1u; }
+  }
+  return q;
+}
+
+static uint32_t qs_isqrt(uint64_t v)
+{
+  uint64_t r = 0u, bit = (uint64_t)1 << 62;
+
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+    else              r >>= 1;
+    bit >>= 2;
+  }
+  return (uint32_t)r;
+}
+
+/* ------------------- Metric ------------------- */
+void qs_update(qs_metric_t *m, uint32_t value)
+{
+  int32_t  x = (int32_t)(value > QS_VALUE_MAX ? QS_VALUE_MAX : value);
+  uint64_t sq = (uint64_t)x * (uint64_t)x;
+  int64_t  x16 = (int64_t)x << 16;
+  uint32_t n = m->count, j;
+
+  if (n == 0xFFFFFFFFu) return;
+  if (n == 0u || (uint32_t)x < m->min) m->min = (uint32_t)x;
+  if ((uint32_t)x > m->max) m->max = (uint32_t)x;
+  m->sum   += (uint32_t)x;
+  m->sq_lo += sq;
+  if (m->sq_lo < sq) m->sq_hi++;
+  m->count = n + 1u;
+
+  if (n < 5u) {                         /* insertion sort into the seed */
+    int64_t *b = m->p2[0].q;
+    for (j = n; j > 0u && b[j - 1u] > x16; --j) b[j] = b[j - 1u];
+    b[j] = x16;
+    if (n == 4u) {
+      int64_t seed[5];
+      for (j = 0; j < 5u; ++j) seed[j] = b[j];
+      for (j = 0; j < QS_NQ; ++j) p2_start(&m->p2[j], seed, qs_p[j]);
+    }
+  } else if (n < QS_COUNT_MAX) {
+    for (j = 0; j < QS_NQ; ++j) p2_add(&m->p2[j], qs_p[j], x16);
+  }
+}
+
+/* counts, extremes and quantiles into s, the sums into sum/sq; cheap
+   enough to run with interrupts masked */
+static void qs_take(const qs_metric_t *m, qs_snap_t *s, uint64_t *sum, qs_u128_t *sq)
+{
+  uint32_t n = m->count, j;
+
+  s->count = n;
+  s->min   = n ? m->min : 0u;
+  s->max   = m->max;
+  *sum     = m->sum;
+  sq->hi   = m->sq_hi;
+  sq->lo   = m->sq_lo;
+  for (j = 0; j < QS_NQ; ++j) {
+    if (n >= 5u) {
+      s->q[j] = (uint32_t)((m->p2[j].q[2] + 0x8000) >> 16);
+    } else if (n) {                     /* nearest rank over the seed */
+      uint32_t r = (uint32_t)(((uint64_t)qs_ppm[j] * n + 999999u) / 1000000u);
+      s->q[j] = (uint32_t)(m->p2[0].q[r - 1u] >> 16);
+    } else {
+      s->q[j] = 0u;
+    }
+  }
+}
+
+static void qs_moments(qs_snap_t *s, uint64_t sum, qs_u128_t sq)
+{
+  uint32_t n = s->count;
+
+  s->mean = n ? (uint32_t)(sum / n) : 0u;
+  s->var  = 0u;
+  if (n > 1u) {
+    /* (n * sum x^2 - (sum x)^2) / (n (n - 1)) */
+    qs_u128_t a = qs_mul64(sq.lo, n), b = qs_mul64(sum, sum);
+    a.hi += sq.hi * n;
+    a.hi -= b.hi + (a.lo < b.lo);
+    a.lo -= b.lo;
+    s->var = qs_div(a, (uint64_t)n * (n - 1u));
+  }
+  s->sd = qs_isqrt(s->var);
+}
+
+void qs_read(const qs_metric_t *m, qs_snap_t *s)
+{
+  uint64_t  sum;
+  qs_u128_t sq;
+
+  qs_take(m, s, &sum, &sq);
+  qs_moments(s, sum, sq);
+}
+
+#ifndef QS_HOST
+#include "LPC17xx.h"            /* __LDREXW/__STREXW, __disable_irq */
+#include <string.h>
+
+qs_metric_t       g_qs[QS_METRICS];
+qs_snap_t         g_qs_snap[QS_METRICS];
+volatile uint32_t g_qs_dropped[QS_METRICS];
+
+static volatile uint32_t qs_busy[QS_METRICS];   /* 1: g_qs[id] being written */
+
+/* ------------------- Per-metric try-lock ------------------- */
+static int qs_claim(uint32_t id)
+{
+  do {
+    if (__LDREXW(&qs_busy[id])) { __CLREX(); return 0; }
+  } while (__STREXW(1u, &qs_busy[id]));
+  __DMB();                      /* flag before the metric */
+  return 1;
+}
+
+static void qs_release(uint32_t id)
+{
+  __DMB();                      /* metric before the flag */
+  qs_busy[id] = 0u;
+}
+
+/* ------------------- API ------------------- */
+void qs_add(uint32_t id, uint32_t cycles)
+{
+  uint32_t v;
+
+  if (id >= QS_METRICS) return;
+  if (!qs_claim(id)) {
+    do {
+      v = __LDREXW(&g_qs_dropped[id]) + 1u;
+    } while (__STREXW(v, &g_qs_dropped[id]));
+    return;
+  }
+  qs_update(&g_qs[id], cycles);
+  qs_release(id);
+}
+
+int qs_snapshot(uint32_t id, qs_snap_t *s)
+{
+  uint64_t  sum;
+  qs_u128_t sq;
+  uint32_t  primask;
+
+  if (id >= QS_METRICS) return -1;
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (qs_busy[id]) {
+    __set_PRIMASK(primask);
+    return -1;
+  }
+  qs_take(&g_qs[id], s, &sum, &sq);
+  __set_PRIMASK(primask);
+  qs_moments(s, sum, sq);
+  return 0;
+}
+
+int qs_reset(uint32_t id)
+{
+  if (id >= QS_METRICS || !qs_claim(id)) return -1;
+  memset(&g_qs[id], 0, sizeof(g_qs[id]));
+  g_qs_dropped[id] = 0u;
+  qs_release(id);
+  return 0;
+}
+
+void qs_report(void)
+{
+  uint32_t k;
+  for (k = 0; k < QS_METRICS; ++k) (void)qs_snapshot(k, &g_qs_snap[k]);   /* busy: keeps the last one */
+}
+#endif /* QS_HOST */
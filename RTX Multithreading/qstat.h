@@ -0,0 +1,101 @@
+/* COE718 Lab 3a - streaming latency statistics with P-square quantiles
+ *
+ * Keeps, per metric and in constant memory (no sample is stored):
+ *
+ *   count, min, max, mean   exact
+ *   variance, sd            exact, from a 128-bit sum of squares
+ *   p50, p90, p99, p99.9    P-square estimates (Jain & Chlamtac 1985),
+ *                           five markers per quantile moved by parabolic
+ *                           interpolation as samples arrive
+ *
+ * in integer cycles throughout (marker heights carry 16 fraction bits),
+ * no floating point.  Samples above
+ * QS_VALUE_MAX are clamped to it, and the quantile markers freeze after
+ * QS_COUNT_MAX samples (min, max and mean keep counting).
+ *
+ * The hooks sit where each latency is already known:
+ *
+ *   QS_SIG_WAKE     TRACE_SIGNAL_SET to the receiver's TRACE_SIGNAL_WAIT
+ *                   return (trace.c)
+ *   QS_ACTIVATION   periodic release instant to job start (periodic.c)
+ *   QS_LCD_DRAW     one LCD line (thread2_demo.c)
+ *   QS_MUTEX_WAIT   contended mp_wait (mutex_probe.c, MUTEX_ANALYSIS=1)
+ *
+ * A sample costs up to a few thousand cycles when every marker moves
+ * (64-bit divisions), typically far less, so qs_add() does not mask
+ * interrupts: it takes a per-metric try-lock, and a sample that finds
+ * the metric busy (a preempted qs_add() or qs_reset() on it) is dropped
+ * and counted in g_qs_dropped[].  Any thread or ISR may feed any metric.
+ * qs_snapshot() copies the metric with interrupts masked, a few dozen
+ * cycles, and returns -1 instead while it is being written; qs_reset()
+ * returns -1 likewise.  qs_report() refreshes g_qs_snap[]
+ * for the Watch window; with TELEMETRY=1 the collector sends the same
+ * snapshots as TM_REC_QSTAT records.  Build with QSTAT=1 to enable the
+ * hooks.  qs_update/qs_read are plain C and build on the host with
+ * QS_HOST defined; tools/qstat_check checks them against exact quantiles
+ * of a recorded trace.
+ */
+#pragma once
+#include <stdint.h>
+
+#ifndef QSTAT
+# define QSTAT           0
+#endif
+
+#define QS_NQ            4u             /* quantiles per metric */
+#define QS_VALUE_MAX     0x7FFFFFFFu    /* cycles, ~21 s at 100 MHz */
+#define QS_COUNT_MAX     0x7FFFFFFFu
+
+/* metric ids; append only, tools/telem_rx.c prints QS_NAMES */
+enum {
+  QS_SIG_WAKE = 0,
+  QS_ACTIVATION,
+  QS_LCD_DRAW,
+  QS_MUTEX_WAIT,
+  QS_METRICS
+};
+#define QS_NAMES         { "sig_wake", "activate", "lcd_draw", "mtx_wait" }
+
+/* quantiles in parts per million, same order as qs_snap_t.q */
+#define QS_QUANTILES_PPM { 500000u, 900000u, 990000u, 999000u }
+
+typedef struct {
+  int64_t  q[5];                        /* marker heights, cycles Q16 */
+  int32_t  n[5];                        /* marker positions, from 1 */
+  uint64_t d[5];                        /* desired positions, Q24 */
+} qs_p2_t;
+
+typedef struct {
+  uint32_t count;
+  uint32_t min, max;
+  uint64_t sum;
+  uint64_t sq_hi, sq_lo;                /* sum of squares */
+  qs_p2_t  p2[QS_NQ];                   /* p2[0].q holds the first 5 samples */
+} qs_metric_t;
+
+typedef struct {
+  uint32_t count;
+  uint32_t min, max, mean, sd;          /* cycles */
+  uint64_t var;                         /* cycles squared */
+  uint32_t q[QS_NQ];                    /* p50, p90, p99, p99.9 */
+} qs_snap_t;
+
+void qs_update(qs_metric_t *m, uint32_t value);
+void qs_read(const qs_metric_t *m, qs_snap_t *s);
+
+#ifndef QS_HOST
+extern qs_metric_t g_qs[QS_METRICS];
+extern qs_snap_t   g_qs_snap[QS_METRICS];
+extern volatile uint32_t g_qs_dropped[QS_METRICS];   /* watch: samples lost to a busy metric */
+
+void qs_add(uint32_t id, uint32_t cycles);
+int  qs_snapshot(uint32_t id, qs_snap_t *s);
+int  qs_reset(uint32_t id);
+void qs_report(void);
+
+#if QSTAT
+# define QS_ADD(id, cycles)   qs_add((id), (cycles))
+#else
+# define QS_ADD(id, cycles)   ((void)0)
+#endif
+#endif /* QS_HOST */
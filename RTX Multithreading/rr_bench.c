@@ -0,0 +1,168 @@
+/* COE718 Lab 3a - round-robin quantum benchmark
+ *
+ * Build this file in place of thread_analysis.c / thread2_demo.c, with
+ * RR_SLICE defined (OS_ROBIN off, rr_slice.c slices).  Three threads at
+ * osPriorityNormal: Painter and Robot are CPU-bound and count the busy
+ * work they get through, Morse is interactive, woken every RB_MORSE_MS
+ * for a short burst, and measures its wake-up latency.  Each quantum mode
+ * runs for RB_RUN_MS:
+ *
+ *   RB_GLOBAL    every thread OS_ROBINTOUT ticks, as the kernel would
+ *   RB_FIXED     per-thread quanta RB_Q_PAINTER/MORSE/ROBOT_US
+ *   RB_ADAPTIVE  rs_set_adaptive() from RB_Q_START_US within min/max
+ *
+ * Watch: g_rb_switches[mode], g_rb_rotations[mode],
+ *        g_rb_work_us[mode][thread] (WL_COMPUTE work done, Morse included),
+ *        g_rb_lat_max_us[mode], g_rb_lat_mean_us[mode],
+ *        g_rb_quantum_us[thread] (adaptive result), g_rb_done.
+ */
+#include "cmsis_os.h"
+#include "rr_slice.h"
+#include "hrclock.h"
+#include "time_units.h"
+#include "trace.h"
+#include "workload.h"
+#include <stdint.h>
+
+#ifndef RR_SLICE
+# error "rr_bench.c needs RR_SLICE (rr_slice.c instead of OS_ROBIN)"
+#endif
+
+#define RB_MODES         3u
+#define RB_GLOBAL        0u
+#define RB_FIXED         1u
+#define RB_ADAPTIVE      2u
+#define RB_THREADS       3u             /* Painter, Morse, Robot */
+
+#define RB_RUN_MS        2000u
+#define RB_MORSE_MS      20u
+#define RB_CHUNK_US      100u           /* counted work chunk */
+#define RB_MORSE_US      300u           /* interactive burst */
+#define RB_ROBINTOUT     3u             /* RTX_Conf_CM.c default */
+#define RB_Q_PAINTER_US  5000u
+#define RB_Q_MORSE_US    1000u
+#define RB_Q_ROBOT_US    10000u
+#define RB_Q_START_US    5000u
+#define RB_Q_MIN_US      1000u
+#define RB_Q_MAX_US      40000u
+#define RB_SIG_WAKE      0x01
+TU_CHECK_MS(rb_run,   RB_RUN_MS);
+TU_CHECK_MS(rb_morse, RB_MORSE_MS);
+
+volatile uint32_t g_rb_switches[RB_MODES];
+volatile uint32_t g_rb_rotations[RB_MODES];
+volatile uint32_t g_rb_work_us[RB_MODES][RB_THREADS];
+volatile uint32_t g_rb_lat_max_us[RB_MODES];
+volatile uint32_t g_rb_lat_mean_us[RB_MODES];
+volatile uint32_t g_rb_quantum_us[RB_THREADS];
+volatile uint8_t  g_rb_done = 0;
+
+static volatile uint32_t rb_work_us[RB_THREADS];
+static volatile uint32_t rb_wake_cyc;
+static uint32_t          rb_lat_max, rb_lat_n;
+static uint64_t          rb_lat_sum;
+static osThreadId        rb_tid[RB_THREADS];
+static int               rb_slot[RB_THREADS];
+
+/* ------------------- Workload ------------------- */
+void Th_RbCpu(void const *arg)
+{
+  uint32_t k = (uint32_t)(uintptr_t)arg;
+  for (;;) {
+    wl_run_us(WL_COMPUTE, RB_CHUNK_US);
+    rb_work_us[k] += RB_CHUNK_US;
+  }
+}
+osThreadDef(Th_RbCpu, osPriorityNormal, 2, 0);
+
+void Th_RbMorse(void const *arg)
+{
+  (void)arg;
+  for (;;) {
+    uint32_t lat;
+    osSignalWait(RB_SIG_WAKE, osWaitForever);
+    lat = hrclock_cyc32() - rb_wake_cyc;
+    rb_lat_sum += lat;
+    rb_lat_n++;
+    if (lat > rb_lat_max) rb_lat_max = lat;
+    wl_run_us(WL_COMPUTE, RB_MORSE_US);
+    rb_work_us[1] += RB_MORSE_US;
+  }
+}
+osThreadDef(Th_RbMorse, osPriorityNormal, 1, 0);
+
+static void rb_wake(void const *arg)
+{
+  (void)arg;
+  rb_wake_cyc = hrclock_cyc32();
+  osSignalSet(rb_tid[1], RB_SIG_WAKE);
+}
+osTimerDef(rb_wake, rb_wake);
+
+/* ------------------- Controller ------------------- */
+static void rb_configure(uint32_t mode)
+{
+  static const uint32_t fixed_us[RB_THREADS] = { RB_Q_PAINTER_US, RB_Q_MORSE_US, RB_Q_ROBOT_US };
+  uint32_t k;
+
+  rs_set_adaptive(mode == RB_ADAPTIVE, RB_Q_MIN_US, RB_Q_MAX_US);
+  for (k = 0; k < RB_THREADS; ++k) {
+    uint32_t q = (mode == RB_GLOBAL) ? RB_ROBINTOUT * TU_TICK_US :
+                 (mode == RB_FIXED)  ? fixed_us[k] : RB_Q_START_US;
+    rs_set_quantum(rb_slot[k], q);
+  }
+}
+
+void Th_RrBench(void const *arg);
+osThreadDef(Th_RrBench, osPriorityHigh, 1, 0);
+
+void Th_RrBench(void const *arg)
+{
+  osTimerId wake = osTimerCreate(osTimer(rb_wake), osTimerPeriodic, NULL);
+  uint32_t m, k;
+  (void)arg;
+
+  if (!wake) osThreadTerminate(osThreadGetId());
+  (void)osTimerStart(wake, TU_DELAY_MS(RB_MORSE_MS));
+  for (m = 0; m < RB_MODES; ++m) {
+    rb_configure(m);
+    rs_reset_stats();
+    for (k = 0; k < RB_THREADS; ++k) rb_work_us[k] = 0u;
+    rb_lat_max = rb_lat_n = 0u;
+    rb_lat_sum = 0u;
+
+    osDelay(TU_DELAY_MS(RB_RUN_MS));
+
+    g_rb_switches[m]  = g_rs_switches;
+    g_rb_rotations[m] = g_rs_rotations;
+    for (k = 0; k < RB_THREADS; ++k) g_rb_work_us[m][k] = rb_work_us[k];
+    g_rb_lat_max_us[m]  = rb_lat_max / TU_CYCLES_PER_US;
+    g_rb_lat_mean_us[m] = rb_lat_n ? (uint32_t)(rb_lat_sum / rb_lat_n) / TU_CYCLES_PER_US : 0u;
+  }
+  for (k = 0; k < RB_THREADS; ++k) g_rb_quantum_us[k] = rs_get_quantum(rb_slot[k]);
+
+  (void)osTimerStop(wake);
+  for (k = 0; k < RB_THREADS; ++k) (void)osThreadTerminate(rb_tid[k]);
+  g_rb_done = 1u;
+  osThreadTerminate(osThreadGetId());
+}
+
+int Init_Thread(void)
+{
+  uint32_t k;
+
+  trace_init();
+  if (rs_init() != 0) return -1;
+  rb_tid[0] = osThreadCreate(osThread(Th_RbCpu), (void *)0);
+  rb_tid[1] = osThreadCreate(osThread(Th_RbMorse), NULL);
+  rb_tid[2] = osThreadCreate(osThread(Th_RbCpu), (void *)2);
+  for (k = 0; k < RB_THREADS; ++k) {
+    if (!rb_tid[k]) return -1;
+    rb_slot[k] = rs_attach(rb_tid[k], RB_Q_START_US);
+    if (rb_slot[k] < 0) return -1;
+  }
+  (void)trace_register(rb_tid[0], "painter");
+  (void)trace_register(rb_tid[1], "morse");
+  (void)trace_register(rb_tid[2], "robot");
+  return osThreadCreate(osThread(Th_RrBench), NULL) ? 0 : -1;
+}
@@ -0,0 +1,171 @@
+/* COE718 Lab 3a - fairness and throughput analyzer, see rr_fair.h
+ *
+ * The analysis (rf_reset .. rf_finish) is shared with tools/sched_sim.c,
+ * which builds this file with RF_HOST defined.
+ */
+
+#include "rr_fair.h"
+
+rf_state_t g_rf;
+
+/* ------------------- Analysis ------------------- */
+/* Jain's index of x[0..n), per mille; 1000 when nothing progressed */
+static uint32_t rf_jain_pm(uint64_t *x, uint32_t n)
+{
+  uint64_t max = 0u, sum = 0u, sq = 0u;
+  uint32_t i;
+
+  for (i = 0; i < n; ++i) if (x[i] > max) max = x[i];
+  if (n == 0u || max == 0u) return 1000u;
+  while (max >= (1u << 24)) {           /* keeps 1000 * sum^2 in 64 bits */
+    max >>= 1;
+    for (i = 0; i < n; ++i) x[i] >>= 1;
+  }
+  for (i = 0; i < n; ++i) { sum += x[i]; sq += x[i] * x[i]; }
+  return sq ? (uint32_t)((sum * sum * 1000u) / ((uint64_t)n * sq)) : 1000u;
+}
+
+void rf_reset(rf_state_t *s, uint32_t tick_us)
+{
+  uint32_t k;
+  uint8_t *p = (uint8_t *)s;
+  for (k = 0; k < sizeof(*s); ++k) p[k] = 0u;
+  s->magic       = RF_MAGIC;
+  s->thread_size = sizeof(rf_thread_t);
+  s->tick_us     = tick_us;
+  s->jain_min_pm = 1000u;
+}
+
+int rf_add(rf_state_t *s, const char *name, uint32_t period_us, uint32_t cost_us, uint32_t target)
+{
+  rf_thread_t *t;
+  uint32_t k;
+
+  if (s->threads >= RF_MAX_THREADS || period_us == 0u) return -1;
+  t = &s->t[s->threads];
+  for (k = 0; k < RF_NAME_LEN - 1u && name && name[k]; ++k) t->name[k] = name[k];
+  t->name[k]   = '\0';
+  t->period_us = period_us;
+  t->cost_us   = cost_us;
+  t->target    = target;
+  return (int)s->threads++;
+}
+
+int rf_step(rf_state_t *s, const uint32_t *progress)
+{
+  uint64_t x[RF_MAX_THREADS], mean = 0u;
+  uint32_t i, n = s->threads, active = 0u, targets = 0u, reached = 0u;
+
+  s->ticks++;
+  /* normalised service of the threads still running */
+  for (i = 0; i < n; ++i) {
+    rf_thread_t *t = &s->t[i];
+    if (t->done_tick) continue;
+    t->progress = progress[i];
+    x[i] = (uint64_t)t->progress * t->period_us;
+    mean += x[i];
+    active++;
+  }
+  if (active > 1u) {
+    mean /= active;
+    for (i = 0; i < n; ++i) {
+      rf_thread_t *t = &s->t[i];
+      if (!t->done_tick && mean > x[i]) {
+        uint64_t lag = mean - x[i];
+        if (lag > 0x7FFFFFFFu) lag = 0x7FFFFFFFu;
+        if ((int32_t)lag > t->lag_max_us) t->lag_max_us = (int32_t)lag;
+      }
+    }
+  }
+
+  /* windowed Jain over the threads that ran the whole window */
+  if (s->ticks % RF_WINDOW_TICKS == 0u) {
+    uint32_t m = 0u, pm;
+    uint64_t any = 0u;
+    for (i = 0; i < n; ++i) {
+      rf_thread_t *t = &s->t[i];
+      if (t->done_tick) continue;
+      x[m] = (uint64_t)(t->progress - t->win_start) * t->period_us;
+      any |= x[m++];
+      t->win_start = t->progress;
+    }
+    if (m > 1u && any) {
+      pm = rf_jain_pm(x, m);
+      if (pm < s->jain_min_pm) s->jain_min_pm = pm;
+      s->jain_sum_pm += pm;
+      s->windows++;
+    }
+  }
+
+  /* completions, after the lag so a thread finishing now still counts */
+  for (i = 0; i < n; ++i) {
+    rf_thread_t *t = &s->t[i];
+    if (!t->target) continue;
+    targets++;
+    if (!t->done_tick && t->progress >= t->target) t->done_tick = s->ticks;
+    if (t->done_tick) reached++;
+  }
+  return targets && reached == targets;
+}
+
+void rf_finish(rf_state_t *s)
+{
+  uint64_t x[RF_MAX_THREADS];
+  uint32_t i, n = s->threads;
+
+  for (i = 0; i < n; ++i) {
+    rf_thread_t *t = &s->t[i];
+    uint64_t life_us = (uint64_t)(t->done_tick ? t->done_tick : s->ticks) * s->tick_us;
+    t->thr_milli = life_us ? (uint32_t)(((uint64_t)t->progress * 1000000000u) / life_us) : 0u;
+    x[i] = (uint64_t)t->thr_milli * t->period_us;
+  }
+  s->jain_run_pm  = rf_jain_pm(x, n);
+  s->jain_mean_pm = s->windows ? s->jain_sum_pm / s->windows : 1000u;
+  s->done = 1u;
+}
+
+#ifndef RF_HOST
+/* ------------------- Tick sampler ------------------- */
+#include "cmsis_os.h"
+#include "time_units.h"
+
+static const volatile uint32_t *rf_src[RF_MAX_THREADS];
+static osTimerId                 rf_timer;
+
+static void rf_tick(void const *arg)
+{
+  uint32_t now[RF_MAX_THREADS], i;
+  (void)arg;
+
+  if (g_rf.done) return;
+  for (i = 0; i < g_rf.threads; ++i) now[i] = *rf_src[i];
+  if (rf_step(&g_rf, now)) rf_stop();
+}
+osTimerDef(rf_tick, rf_tick);
+
+int rf_attach(const char *name, const volatile uint32_t *progress,
+              uint32_t period_us, uint32_t cost_us, uint32_t target)
+{
+  int k;
+
+  if (!progress) return -1;
+  if (g_rf.magic != RF_MAGIC || g_rf.done) rf_reset(&g_rf, TU_TICK_US);
+  k = rf_add(&g_rf, name, period_us, cost_us, target);
+  if (k >= 0) rf_src[k] = progress;
+  return k;
+}
+
+int rf_start(void)
+{
+  if (g_rf.magic != RF_MAGIC || g_rf.threads == 0u) return -1;
+  if (!rf_timer) rf_timer = osTimerCreate(osTimer(rf_tick), osTimerPeriodic, NULL);
+  if (!rf_timer) return -1;
+  return (osTimerStart(rf_timer, TU_DELAY_TICKS(1u)) == osOK) ? 0 : -1;
+}
+
+void rf_stop(void)
+{
+  if (rf_timer) (void)osTimerStop(rf_timer);
+  if (!g_rf.done) rf_finish(&g_rf);
+}
+#endif /* RF_HOST */
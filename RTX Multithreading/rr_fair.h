@@ -0,0 +1,81 @@
+/* COE718 Lab 3a - fairness and throughput analyzer
+ *
+ * Samples a progress counter per thread (jobs done, work units, ...) at
+ * every kernel tick and keeps, per thread and in O(1) memory:
+ *
+ *   throughput   progress per 1000 s over the thread's lifetime
+ *   lag          worst shortfall of its normalised service behind the
+ *                mean of the threads still running, in us
+ *   completion   tick at which the counter reached its target
+ *
+ * and over the whole set Jain's fairness index (sum x)^2 / (n sum x^2)
+ * on normalised throughput, per RF_WINDOW_TICKS window (min and mean)
+ * and over the run.  A thread's progress is normalised by period_us, the
+ * time one unit should take when it gets its fair share, so a thread
+ * released every 10 ms and one released every 25 ms are both fair when
+ * they keep up with their releases.
+ *
+ * rf_start() samples from a periodic RTX timer; once every thread with a
+ * target has reached it the timer stops and the result is left in g_rf,
+ * self-describing for the host like g_trace and g_blog:
+ *
+ *   SAVE rf.hex &g_rf, ((char*)&g_rf) + sizeof(g_rf) - 1
+ *
+ * tools/sched_sim -f rf.hex replays the same task set in the simulator
+ * (cost_us per unit) and prints the prediction next to the measurement.
+ * rf_reset/rf_add/rf_step/rf_finish are plain C and build on the host
+ * with RF_HOST defined.
+ */
+#pragma once
+#include <stdint.h>
+
+#define RF_MAX_THREADS   6u
+#define RF_NAME_LEN      8u
+#define RF_WINDOW_TICKS  20u            /* windowed Jain index */
+#define RF_MAGIC         0x31524146u    /* "FAR1" */
+
+typedef struct {
+  char     name[RF_NAME_LEN];
+  uint32_t period_us;                   /* fair time per unit of progress */
+  uint32_t cost_us;                     /* CPU per unit, for the simulator */
+  uint32_t target;                      /* completion, 0 = none */
+  uint32_t progress;                    /* at the last sample */
+  uint32_t win_start;                   /* progress when the window opened */
+  uint32_t done_tick;                   /* 0 = not completed */
+  int32_t  lag_max_us;
+  uint32_t thr_milli;                   /* units per 1000 s, by rf_finish() */
+} rf_thread_t;
+
+typedef struct {
+  uint32_t    magic;
+  uint32_t    thread_size;              /* sizeof(rf_thread_t) */
+  uint32_t    threads;
+  uint32_t    tick_us;
+  uint32_t    ticks;                    /* samples taken */
+  uint32_t    windows;                  /* windows with any progress */
+  uint32_t    jain_min_pm;              /* per mille, 1000 = perfectly fair */
+  uint32_t    jain_sum_pm;
+  uint32_t    jain_mean_pm;             /* by rf_finish() */
+  uint32_t    jain_run_pm;              /* over lifetime throughput */
+  volatile uint32_t done;
+  rf_thread_t t[RF_MAX_THREADS];
+} rf_state_t;
+
+extern rf_state_t g_rf;
+
+void     rf_reset(rf_state_t *s, uint32_t tick_us);
+/* Returns the thread index or -1; period_us must not be 0. */
+int      rf_add(rf_state_t *s, const char *name, uint32_t period_us, uint32_t cost_us, uint32_t target);
+/* One tick with the current counters; returns 1 once every thread with a
+   target has completed (and there is at least one). */
+int      rf_step(rf_state_t *s, const uint32_t *progress);
+void     rf_finish(rf_state_t *s);
+
+#ifndef RF_HOST
+/* Samples *progress of each attached thread into g_rf from rf_start() on.
+   Call rf_attach() before rf_start(); returns the index or -1. */
+int      rf_attach(const char *name, const volatile uint32_t *progress,
+                   uint32_t period_us, uint32_t cost_us, uint32_t target);
+int      rf_start(void);
+void     rf_stop(void);                 /* finish early, e.g. no targets */
+#endif
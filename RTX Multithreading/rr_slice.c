@@ -0,0 +1,168 @@
+/* COE718 Lab 3a - per-thread round-robin time quanta, see rr_slice.h */
+
+#include "rr_slice.h"
+#include "time_units.h"
+#include "trace.h"
+#include "rtx_internal.h"
+#include "LPC17xx.h"
+
+#define RS_TIMER_PER_US  (TU_TIMER2_HZ / 1000000uL)
+TU_STATIC_ASSERT(rs_timer_whole_mhz, TU_TIMER2_HZ % 1000000uL == 0uL);
+
+rs_thread_t       g_rs[RS_MAX_THREADS];
+volatile uint32_t g_rs_switches  = 0;
+volatile uint32_t g_rs_rotations = 0;
+
+static volatile uint32_t rs_n;
+static void             *rs_last;       /* TCB seen at the previous sample */
+static int               rs_cur = -1;   /* its g_rs index, -1 if none */
+static volatile int      rs_victim = -1;
+static uint8_t           rs_adaptive;
+static uint32_t          rs_min_us, rs_max_us;
+static osThreadId        rs_tid;
+
+/* ------------------- Sampling ISR ------------------- */
+static int rs_slot(const void *tcb)
+{
+  uint32_t k, n = rs_n;
+  for (k = 0; k < n; ++k) if ((const void *)g_rs[k].tid == tcb) return (int)k;
+  return -1;
+}
+
+/* the thread left the CPU: blocked, or preempted while still ready */
+static void rs_leave(rs_thread_t *t, const void *tcb)
+{
+  if (RTX_TCB_STATE(tcb) == RTX_READY) return;   /* keeps its quantum */
+  t->st.blocks++;
+  if (rs_adaptive && t->used_us < t->quantum_us / 4u) {
+    uint32_t q = t->quantum_us / 2u;
+    t->quantum_us = (q < rs_min_us) ? rs_min_us : q;
+  }
+  t->used_us = 0u;
+}
+
+static void rs_expire(int k)
+{
+  rs_thread_t *t = &g_rs[k];
+
+  t->st.expiries++;
+  t->used_us = 0u;
+  if (rs_adaptive) {
+    uint32_t q = t->quantum_us * 2u;
+    t->quantum_us = (q > rs_max_us) ? rs_max_us : q;
+  }
+  rs_victim = k;
+  osSignalSet(rs_tid, RS_SIG_ROTATE);
+}
+
+void TIMER2_IRQHandler(void)
+{
+  void *run = os_tsk.run;
+
+  LPC_TIM2->IR = 1u;                    /* MR0 */
+  if (run != rs_last) {
+    int k = rs_slot(run);
+    if (rs_cur >= 0 && rs_last) rs_leave(&g_rs[rs_cur], rs_last);
+    if (k >= 0) {
+      g_rs[k].st.slices++;
+      if (rs_cur >= 0) g_rs_switches++;
+    }
+    rs_last = run;
+    rs_cur  = k;
+    return;
+  }
+  if (rs_cur >= 0 && rs_victim < 0) {
+    rs_thread_t *t = &g_rs[rs_cur];
+    t->used_us   += RS_SAMPLE_US;
+    t->st.run_us += RS_SAMPLE_US;
+    if (t->used_us >= t->quantum_us) rs_expire(rs_cur);
+  }
+}
+
+/* ------------------- Rotator ------------------- */
+void rs_rotate(void const *arg)
+{
+  (void)arg;
+  for (;;) {
+    osThreadId tid;
+    osPriority p, tmp;
+
+    osSignalWait(RS_SIG_ROTATE, osWaitForever);
+    if (rs_victim < 0) continue;
+    tid = g_rs[rs_victim].tid;
+    p   = osThreadGetPriority(tid);
+    tmp = (p > osPriorityIdle) ? (osPriority)(p - 1) : (osPriority)(p + 1);
+    /* re-queued at the tail of its priority on the way back */
+    (void)osThreadSetPriority(tid, tmp);
+    (void)osThreadSetPriority(tid, p);
+    g_rs_rotations++;
+    TRACE(TR_RR_ROTATE, rs_victim);
+    rs_victim = -1;
+  }
+}
+osThreadDef(rs_rotate, osPriorityRealtime, 1, 0);
+
+/* ------------------- API ------------------- */
+int rs_init(void)
+{
+  if (rs_tid) return 0;
+  rs_tid = osThreadCreate(osThread(rs_rotate), NULL);
+  if (!rs_tid) return -1;
+  (void)trace_register(rs_tid, "rrslice");
+
+  LPC_SC->PCONP |= 1u << 22;            /* PCTIM2 */
+  LPC_TIM2->TCR = 2u;
+  LPC_TIM2->PR  = 0u;
+  LPC_TIM2->MR0 = RS_SAMPLE_US * RS_TIMER_PER_US - 1u;
+  LPC_TIM2->MCR = 3u;                   /* interrupt and reset on MR0 */
+  LPC_TIM2->IR  = 0x3Fu;
+  NVIC_SetPriority(TIMER2_IRQn, RS_IRQ_PRIO);
+  NVIC_EnableIRQ(TIMER2_IRQn);
+  LPC_TIM2->TCR = 1u;
+  return 0;
+}
+
+int rs_attach(osThreadId tid, uint32_t quantum_us)
+{
+  uint32_t k = rs_n;
+  rs_thread_t *t;
+
+  if (!tid || k >= RS_MAX_THREADS || quantum_us < RS_SAMPLE_US) return -1;
+  t = &g_rs[k];
+  t->tid        = tid;
+  t->quantum_us = quantum_us;
+  t->used_us    = 0u;
+  t->st.slices  = t->st.expiries = t->st.blocks = t->st.run_us = 0u;
+  rs_n = k + 1u;                        /* publish to the ISR last */
+  return (int)k;
+}
+
+void rs_set_quantum(int k, uint32_t quantum_us)
+{
+  if (k < 0 || (uint32_t)k >= rs_n || quantum_us < RS_SAMPLE_US) return;
+  g_rs[k].quantum_us = quantum_us;
+}
+
+uint32_t rs_get_quantum(int k)
+{
+  return (k >= 0 && (uint32_t)k < rs_n) ? g_rs[k].quantum_us : 0u;
+}
+
+void rs_set_adaptive(int on, uint32_t min_us, uint32_t max_us)
+{
+  if (min_us < RS_SAMPLE_US) min_us = RS_SAMPLE_US;
+  if (max_us < min_us) max_us = min_us;
+  rs_min_us   = min_us;
+  rs_max_us   = max_us;
+  rs_adaptive = (uint8_t)(on != 0);
+}
+
+void rs_reset_stats(void)
+{
+  uint32_t k, n = rs_n;
+  for (k = 0; k < n; ++k) {
+    g_rs[k].st.slices = g_rs[k].st.expiries = g_rs[k].st.blocks = g_rs[k].st.run_us = 0u;
+  }
+  g_rs_switches  = 0u;
+  g_rs_rotations = 0u;
+}
@@ -0,0 +1,56 @@
+/* COE718 Lab 3a - per-thread round-robin time quanta
+ *
+ * OS_ROBINTOUT gives every equal-priority thread the same slice.  This
+ * module gives each attached thread its own quantum, changeable at run
+ * time.  Build with RR_SLICE defined, which turns OS_ROBIN off in
+ * RTX_Conf_CM.c so the kernel does not rotate on its own.
+ *
+ * TIMER2 samples the running thread every RS_SAMPLE_US.  Time a thread
+ * runs counts towards its quantum until it blocks; being preempted by a
+ * higher priority keeps the count.  When the quantum is used up, the
+ * rs_rotate thread (osPriorityRealtime) moves it behind its equal-priority
+ * peers by dropping and restoring its priority, which RTX re-queues at the
+ * tail of the ready list.
+ *
+ * Adaptive mode: a thread that uses up its quantum is CPU-bound and gets
+ * twice the quantum; one that blocks within a quarter of it is
+ * interactive and gets half, both within [min_us, max_us].
+ *
+ * Attached threads must keep their priority otherwise (not with budget.h
+ * or PT_EDF on the same thread).
+ */
+#pragma once
+#include "cmsis_os.h"
+#include <stdint.h>
+
+#define RS_MAX_THREADS   6u
+#define RS_SAMPLE_US     250u
+#define RS_SIG_ROTATE    (1 << 11)
+#define RS_IRQ_PRIO      2u             /* TIMER2 NVIC priority */
+
+typedef struct {
+  uint32_t slices;                      /* times the thread was switched in */
+  uint32_t expiries;                    /* quantum used up, rotated */
+  uint32_t blocks;                      /* gave the CPU up itself */
+  uint32_t run_us;
+} rs_stat_t;
+
+typedef struct {
+  osThreadId        tid;
+  volatile uint32_t quantum_us;
+  uint32_t          used_us;            /* of the current quantum */
+  rs_stat_t         st;
+} rs_thread_t;
+
+extern rs_thread_t       g_rs[RS_MAX_THREADS];
+extern volatile uint32_t g_rs_switches;  /* between attached threads */
+extern volatile uint32_t g_rs_rotations;
+
+int      rs_init(void);
+/* Returns the g_rs index or -1; quantum at least RS_SAMPLE_US. */
+int      rs_attach(osThreadId tid, uint32_t quantum_us);
+void     rs_set_quantum(int k, uint32_t quantum_us);
+uint32_t rs_get_quantum(int k);
+/* on != 0: adapt every quantum within [min_us, max_us] */
+void     rs_set_adaptive(int on, uint32_t min_us, uint32_t max_us);
+void     rs_reset_stats(void);
@@ -0,0 +1,18 @@
+/* COE718 Lab 3a - RTX4 kernel internals read by the sampling ISRs
+ *
+ * A timer ISR that charges or samples the running thread cannot ask the
+ * kernel, since osThreadGetId() is an SVC call.  RTX4 keeps the answer in
+ * os_tsk (rt_Task.c): run is the running TCB, the same pointer
+ * osThreadGetId() returns for it.  A TCB starts with cb_type, state
+ * (rt_TypeDef.h), which tells a preempted thread from one that blocked.
+ *
+ * None of this is CMSIS-RTOS API; recheck it against rt_Task.h and
+ * rt_TypeDef.h when the RTX library is updated.
+ */
+#pragma once
+#include <stdint.h>
+
+extern struct OS_TSK { void *run; void *new_tsk; } os_tsk;
+
+#define RTX_TCB_STATE(tcb)  (((const volatile uint8_t *)(tcb))[1])
+#define RTX_READY           1u          /* rt_Task.h: READY */
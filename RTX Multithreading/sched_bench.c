@@ -0,0 +1,109 @@
+/* COE718 Lab 3a - scheduling policy benchmark: RR vs RM vs EDF
+ *
+ * Build this file in place of thread_analysis.c / thread2_demo.c.  The
+ * same three periodic tasks (10, 20, 25 ms) are run under every policy of
+ * periodic.h at total utilisations SB_U_FIRST..SB_U_LAST percent, each run
+ * lasting SB_RUN_MS.  Job loads are WL_COMPUTE work from workload.h,
+ * calibrated at boot.  tools/sched_sim.c simulates the same sets on the
+ * host for comparison.
+ *
+ * Watch: g_sb_miss_pm[policy][level] (missed jobs per mille),
+ *        g_sb_resp_pct[policy][level] (worst response / deadline, %),
+ *        g_sb_remaps (EDF priority changes), g_sb_done.
+ */
+#include "cmsis_os.h"
+#include "periodic.h"
+#include "edf.h"
+#include "time_units.h"
+#include "trace.h"
+#include "workload.h"
+#include <stdint.h>
+
+#define SB_TASKS        3u
+#define SB_POLICIES     3u              /* PT_RM, PT_EDF, PT_RR */
+#define SB_U_FIRST      70u             /* percent */
+#define SB_U_STEP       5u
+#define SB_LEVELS       6u              /* 70 .. 95 % */
+#define SB_RUN_MS       2000u
+#define SB_POLL_MS      50u
+TU_CHECK_MS(sb_run,  SB_RUN_MS);
+TU_CHECK_MS(sb_poll, SB_POLL_MS);
+
+/* periods and each task's share of the total utilisation (per mille) */
+static const uint32_t sb_period_ms[SB_TASKS] = { 10u, 20u, 25u };
+static const uint32_t sb_share_pm[SB_TASKS]  = { 400u, 350u, 250u };
+
+volatile uint32_t g_sb_miss_pm[SB_POLICIES][SB_LEVELS];
+volatile uint32_t g_sb_resp_pct[SB_POLICIES][SB_LEVELS];
+volatile uint32_t g_sb_remaps       = 0;
+volatile uint8_t  g_sb_done         = 0;
+
+static pt_task_def_t sb_def[SB_TASKS];
+static uint32_t      sb_cycles[SB_TASKS];
+
+/* ------------------- Load ------------------- */
+static void sb_job(void *ctx)
+{
+  wl_run_cycles(WL_COMPUTE, *(const uint32_t *)ctx);
+}
+
+static void sb_setup(uint32_t u_pct)
+{
+  uint32_t i;
+  for (i = 0; i < SB_TASKS; ++i) {
+    /* C_i = U * share_i * T_i, in cycles */
+    uint64_t wcet_cyc = (uint64_t)u_pct * sb_share_pm[i] * sb_period_ms[i] *
+                        (TU_CCLK_HZ / 1000u) / (100u * 1000u);
+    sb_cycles[i] = (uint32_t)wcet_cyc;
+
+    sb_def[i].name        = (i == 0u) ? "sb10" : (i == 1u) ? "sb20" : "sb25";
+    sb_def[i].job         = sb_job;
+    sb_def[i].ctx         = &sb_cycles[i];
+    sb_def[i].period_ms   = sb_period_ms[i];
+    sb_def[i].deadline_ms = 0u;
+    sb_def[i].wcet_us     = (uint32_t)(wcet_cyc / TU_CYCLES_PER_US);
+    sb_def[i].prio        = PT_PRIO_RM;
+    sb_def[i].jobs        = SB_RUN_MS / sb_period_ms[i];
+  }
+}
+
+/* ------------------- Controller ------------------- */
+void Th_SchedBench(void const *arg);
+osThreadDef(Th_SchedBench, osPriorityHigh, 1, 0);
+
+void Th_SchedBench(void const *arg)
+{
+  static const pt_policy_t policy[SB_POLICIES] = { PT_RM, PT_EDF, PT_RR };
+  uint32_t p, l, i;
+  (void)arg;
+
+  for (l = 0; l < SB_LEVELS; ++l) {
+    sb_setup(SB_U_FIRST + l * SB_U_STEP);
+    for (p = 0; p < SB_POLICIES; ++p) {
+      uint32_t jobs = 0u, missed = 0u, worst = 0u;
+      uint32_t remaps0 = g_edf_remaps;
+
+      if (pt_start(sb_def, SB_TASKS, policy[p]) != 0) break;
+      while (g_pt_active) osDelay(TU_DELAY_MS(SB_POLL_MS));
+
+      for (i = 0; i < SB_TASKS; ++i) {
+        const pt_task_t *t = &g_pt_task[i];
+        uint32_t pct = (uint32_t)(((uint64_t)t->st.resp_max * 100u) / t->deadline_cyc);
+        jobs   += t->st.released + t->st.skipped;
+        missed += t->st.missed;
+        if (pct > worst) worst = pct;
+      }
+      g_sb_miss_pm[p][l]  = jobs ? (missed * 1000u) / jobs : 0u;
+      g_sb_resp_pct[p][l] = worst;
+      g_sb_remaps        += g_edf_remaps - remaps0;
+    }
+  }
+  g_sb_done = 1u;
+  osThreadTerminate(osThreadGetId());
+}
+
+int Init_Thread(void)
+{
+  trace_init();
+  return osThreadCreate(osThread(Th_SchedBench), NULL) ? 0 : -1;
+}
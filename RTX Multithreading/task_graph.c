@@ -0,0 +1,142 @@
+/* COE718 Lab 3a - dataflow task-graph executor, see task_graph.h */
+
+#include "task_graph.h"
+#include "LPC17xx.h"            /* __LDREXW/__STREXW */
+#include "hrclock.h"
+#include "trace.h"
+
+static uint32_t atomic_dec(volatile uint32_t *p)
+{
+  uint32_t v;
+  do {
+    v = __LDREXW(p) - 1u;
+  } while (__STREXW(v, p));
+  return v;
+}
+
+static void tg_node_job(wp_job_t *j);
+
+/* The pool queue is shared.  When it is full the node runs right here
+   instead of waiting for room: every worker could be inside a node
+   submitting successors, and none of them would drain the queue. */
+static void tg_submit(wp_job_t *j)
+{
+  tg_graph_t *g = (tg_graph_t *)j->ctx;
+  uint32_t v;
+
+  if (wp_submit(j) == 0) return;
+  do {
+    v = __LDREXW(&g->inline_runs) + 1u;
+  } while (__STREXW(v, &g->inline_runs));
+  TRACE(TR_JOB_START, j->id);
+  tg_node_job(j);
+}
+
+/* ------------------- Node job (runs on a pool worker) ------------------- */
+static void tg_node_job(wp_job_t *j)
+{
+  tg_graph_t *g = (tg_graph_t *)j->ctx;
+  uint32_t i = j->arg, s, t0, dt;
+  tg_node_stat_t *st;
+
+  t0 = hrclock_cyc32();
+  g->def[i].fn(g->def[i].ctx);
+  dt = hrclock_cyc32() - t0;
+
+  st = &g->stat[i];
+  st->runs++;
+  st->last = dt;
+  st->sum += dt;
+  if (dt > st->max) st->max = dt;
+  wp_job_done(j);                   /* before the owner can restart the graph */
+
+  /* release successors whose last dependency this was */
+  for (s = g->succ[i]; s; s &= s - 1u) {
+    uint32_t k = (uint32_t)__CLZ(__RBIT(s));
+    if (atomic_dec(&g->remaining[k]) == 0u) tg_submit(&g->job[k]);
+  }
+  if (atomic_dec(&g->done) == 0u) osSignalSet(g->owner, TG_SIG_DONE);
+}
+
+/* ------------------- Graph API ------------------- */
+int tg_init(tg_graph_t *g, const tg_node_def_t *def, uint32_t n)
+{
+  uint32_t i, d;
+
+  if (n == 0u || n > TG_MAX_NODES) return -1;
+  g->def = def;
+  g->n   = n;
+  g->iterations  = 0u;
+  g->inline_runs = 0u;
+  for (i = 0; i < n; ++i) {
+    g->succ[i] = 0u;
+    g->job[i].fn     = tg_node_job;
+    g->job[i].ctx    = g;
+    g->job[i].arg    = i;
+    g->job[i].prio   = def[i].prio;
+    g->job[i].id     = (uint16_t)i;
+    g->job[i].notify = 0;           /* completion is counted in g->done */
+    g->job[i].signal = 0;
+    g->job[i].self_done = 1u;
+    g->stat[i].runs = g->stat[i].last = g->stat[i].max = 0u;
+    g->stat[i].sum  = 0u;
+  }
+  for (i = 0; i < n; ++i) {
+    if (def[i].deps & ~(TG_DEP(i) - 1u)) return -1;   /* not topological */
+    for (d = 0; d < i; ++d) {
+      if (def[i].deps & TG_DEP(d)) g->succ[d] |= TG_DEP(i);
+    }
+  }
+  return 0;
+}
+
+static uint32_t popcount(uint32_t v)
+{
+  uint32_t c = 0;
+  while (v) { v &= v - 1u; c++; }
+  return c;
+}
+
+int tg_run(tg_graph_t *g)
+{
+  uint32_t i;
+
+  g->owner = osThreadGetId();
+  g->done  = g->n;
+  for (i = 0; i < g->n; ++i) g->remaining[i] = popcount(g->def[i].deps);
+
+  /* roots come from the table: remaining[] may already be changing */
+  for (i = 0; i < g->n; ++i) {
+    if (g->def[i].deps == 0u) tg_submit(&g->job[i]);
+  }
+  (void)osSignalWait(TG_SIG_DONE, osWaitForever);
+
+  g->iterations++;
+  return 0;
+}
+
+/* Longest path through the graph, weighting each node by its mean latency.
+   Table order is topological, so one forward pass is enough. */
+void tg_analyse(tg_graph_t *g)
+{
+  uint32_t fin[TG_MAX_NODES], via[TG_MAX_NODES];
+  uint32_t i, d, end = 0u;
+
+  fin[0] = 0u;
+  g->work_cycles = 0u;
+  for (i = 0; i < g->n; ++i) {
+    uint32_t mean = g->stat[i].runs ? (uint32_t)(g->stat[i].sum / g->stat[i].runs) : 0u;
+    uint32_t start = 0u;
+    via[i] = TG_MAX_NODES;
+    for (d = 0; d < i; ++d) {
+      if ((g->def[i].deps & TG_DEP(d)) && fin[d] >= start) { start = fin[d]; via[i] = d; }
+    }
+    fin[i] = start + mean;
+    g->work_cycles += mean;
+    if (fin[i] >= fin[end]) end = i;
+  }
+
+  g->crit_cycles = fin[end];
+  g->crit_mask   = 0u;
+  for (i = end; i < TG_MAX_NODES; i = via[i]) g->crit_mask |= TG_DEP(i);
+}
@@ -0,0 +1,62 @@
+/* COE718 Lab 3a - dataflow task-graph executor
+ *
+ * A graph is a const table of nodes; each node is a function plus a mask of
+ * the nodes it depends on.  tg_run() executes every node once, in
+ * dependency order, as jobs on the persistent worker pool (work_pool.h),
+ * and blocks the caller until the whole graph has finished.  Node
+ * functions must not wait on each other: ordering is expressed only by
+ * the edges.
+ *
+ * Nodes must be listed in topological order (deps only on lower indices);
+ * tg_init() rejects tables that are not.  wp_init() must have run first.
+ *
+ * A node that finds the pool queue full is run in place by whoever
+ * released it (a worker, or tg_run() for the roots) rather than retried,
+ * and counted in inline_runs.
+ */
+#pragma once
+#include "cmsis_os.h"
+#include "work_pool.h"
+#include <stdint.h>
+
+#define TG_MAX_NODES     16u
+#define TG_SIG_DONE      (1 << 15)      /* set on the caller of tg_run() */
+
+#define TG_DEP(i)        (1uL << (i))
+
+typedef void (*tg_fn_t)(void *ctx);
+
+typedef struct {
+  const char *name;
+  tg_fn_t     fn;
+  void       *ctx;
+  uint32_t    deps;                     /* TG_DEP() mask of predecessors */
+  uint8_t     prio;                     /* work_pool priority of the node job */
+} tg_node_def_t;
+
+typedef struct {
+  uint32_t runs;
+  uint32_t last;                        /* cycles */
+  uint32_t max;
+  uint64_t sum;
+} tg_node_stat_t;
+
+typedef struct {
+  const tg_node_def_t *def;
+  uint32_t             n;
+  uint32_t             succ[TG_MAX_NODES];       /* TG_DEP() mask of successors */
+  volatile uint32_t    remaining[TG_MAX_NODES];  /* unmet deps this iteration */
+  volatile uint32_t    done;
+  osThreadId           owner;
+  wp_job_t             job[TG_MAX_NODES];
+  uint32_t             iterations;
+  volatile uint32_t    inline_runs;     /* watch: nodes run in place, queue full */
+  tg_node_stat_t       stat[TG_MAX_NODES];
+  uint32_t             crit_mask;       /* nodes on the critical path */
+  uint32_t             crit_cycles;     /* its length from mean latencies */
+  uint32_t             work_cycles;     /* sum of mean latencies */
+} tg_graph_t;
+
+int  tg_init(tg_graph_t *g, const tg_node_def_t *def, uint32_t n);
+int  tg_run(tg_graph_t *g);
+void tg_analyse(tg_graph_t *g);
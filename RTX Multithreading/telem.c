@@ -0,0 +1,271 @@
+/* COE718 Lab 3a - UART telemetry over DMA, see telem.h */
+
+#include "telem.h"
+
+#if TELEMETRY
+
+#include "cmsis_os.h"
+#include "LPC17xx.h"
+#include "RTE_Device.h"
+#include "time_units.h"
+#include "hrclock.h"
+#include "trace.h"
+#include "qstat.h"
+
+TU_CHECK_MS(tm_period, TM_PERIOD_MS);
+TU_STATIC_ASSERT(tm_cmsis_usart_off, RTE_UART0 == 0);
+TU_STATIC_ASSERT(tm_ring_pow2, (TM_FRAMES & (TM_FRAMES - 1u)) == 0u);
+
+#define TM_DMA          ((LPC_GPDMACH_TypeDef *)(LPC_GPDMACH0_BASE + 0x20u * RTE_UART0_DMA_TX_CH))
+#define TM_DMA_MASK     (1u << RTE_UART0_DMA_TX_CH)
+#define TM_DMA_UART0_TX 8u              /* GPDMA request line, DMAREQSEL bit 8 = 0 */
+#define TM_IRQ_PRIO     4u              /* below the TIMERn samplers */
+
+tm_stat_t g_tm;
+
+static tm_frame_t        tm_ring[TM_FRAMES];
+static volatile uint32_t tm_wr;         /* frames sealed, thread only */
+static volatile uint32_t tm_rd;         /* frames done by the DMA, ISR only */
+static volatile uint8_t  tm_busy;       /* transfer in flight */
+static tm_frame_t       *tm_cur;        /* being filled, NULL = none */
+static uint8_t           tm_full;       /* no free buffer this period */
+static uint8_t           tm_seq;
+
+static const volatile uint32_t *tm_val[TM_MAX_COUNTERS];
+static char                     tm_name[TM_MAX_COUNTERS][TM_NAME_LEN];
+static uint32_t                 tm_ncounters;
+static uint32_t                 tm_trace_next;
+
+/* ------------------- DMA ------------------- */
+static void tm_dma_start(const tm_frame_t *f)
+{
+  LPC_GPDMA->IntTCClear = TM_DMA_MASK;
+  LPC_GPDMA->IntErrClr  = TM_DMA_MASK;
+  TM_DMA->CSrcAddr  = (uint32_t)f->buf;
+  TM_DMA->CDestAddr = (uint32_t)&LPC_UART0->THR;
+  TM_DMA->CLLI      = 0u;
+  /* bytes, bursts of 1, source increments, terminal count interrupt */
+  TM_DMA->CControl  = (uint32_t)f->len | (1u << 26) | (1u << 31);
+  /* enable, memory to UART0 TX, error and terminal count interrupts */
+  TM_DMA->CConfig   = 1u | (TM_DMA_UART0_TX << 6) | (1u << 11) | (1u << 14) | (1u << 15);
+  tm_busy = 1u;
+}
+
+void DMA_IRQHandler(void)
+{
+  uint32_t err = LPC_GPDMA->IntErrorStat & TM_DMA_MASK;
+
+  if (!((LPC_GPDMA->IntTCStat & TM_DMA_MASK) | err)) return;
+  LPC_GPDMA->IntTCClear = TM_DMA_MASK;
+  LPC_GPDMA->IntErrClr  = TM_DMA_MASK;
+  if (err) {
+    g_tm.dma_errors++;
+  } else {
+    g_tm.frames_sent++;
+    g_tm.bytes_sent += tm_ring[tm_rd & (TM_FRAMES - 1u)].len;
+  }
+  tm_rd++;
+  if (tm_rd != tm_wr) tm_dma_start(&tm_ring[tm_rd & (TM_FRAMES - 1u)]);
+  else                tm_busy = 0u;
+}
+
+/* ------------------- Framing ------------------- */
+static void tm_kick(void)
+{
+  NVIC_DisableIRQ(DMA_IRQn);
+  if (!tm_busy && tm_rd != tm_wr) tm_dma_start(&tm_ring[tm_rd & (TM_FRAMES - 1u)]);
+  NVIC_EnableIRQ(DMA_IRQn);
+}
+
+static void tm_seal(void)
+{
+  if (tm_cur && tm_cur->len > TM_HDR_BYTES) {
+    (void)tm_frame_end(tm_cur);
+    tm_wr++;
+    tm_kick();
+  }
+  tm_cur = NULL;
+}
+
+static void tm_open(void)
+{
+  if (tm_wr - tm_rd >= TM_FRAMES) {     /* every buffer queued for the DMA */
+    tm_full = 1u;
+    g_tm.frames_dropped++;
+    return;
+  }
+  tm_cur = &tm_ring[tm_wr & (TM_FRAMES - 1u)];
+  tm_frame_begin(tm_cur, tm_seq++);
+}
+
+static void tm_rec(uint8_t type, const uint8_t *body, uint32_t len)
+{
+  if (tm_cur && tm_frame_add(tm_cur, type, body, len) == 0) return;
+  tm_seal();
+  if (!tm_full) tm_open();
+  if (tm_cur && tm_frame_add(tm_cur, type, body, len) == 0) return;
+  g_tm.records_dropped++;
+}
+
+static void tm_put16(uint8_t *p, uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static void tm_put32(uint8_t *p, uint32_t v) { tm_put16(p, v); tm_put16(p + 2, v >> 16); }
+
+static void tm_name_rec(uint8_t kind, uint32_t index, const char *name)
+{
+  uint8_t b[2u + TM_NAME_LEN];
+  uint32_t i;
+
+  b[0] = kind;
+  b[1] = (uint8_t)index;
+  for (i = 0; i < TM_NAME_LEN; ++i) b[2u + i] = (uint8_t)name[i];
+  tm_rec(TM_REC_NAME, b, sizeof(b));
+}
+
+#if QSTAT
+static void tm_qstat_rec(uint32_t id)
+{
+  uint8_t   b[1u + 4u * (5u + QS_NQ)];
+  qs_snap_t s;
+  uint32_t  j;
+
+  if (qs_snapshot(id, &s) != 0) return;   /* being written: next round */
+  b[0] = (uint8_t)id;
+  tm_put32(b + 1,  s.count);
+  tm_put32(b + 5,  s.min);
+  tm_put32(b + 9,  s.max);
+  tm_put32(b + 13, s.mean);
+  tm_put32(b + 17, s.sd);
+  for (j = 0; j < QS_NQ; ++j) tm_put32(b + 21 + 4u * j, s.q[j]);
+  tm_rec(TM_REC_QSTAT, b, sizeof(b));
+}
+#endif
+
+/* ------------------- Collector ------------------- */
+static void tm_sample(void)
+{
+  static uint32_t periods, last_cyc, last_idle;
+  uint8_t  b[16];
+  uint32_t k, head, now, idle, win;
+
+  tm_full = 0u;
+  if (periods++ % TM_NAME_EVERY == 0u) {
+    for (k = 0; k < TRACE_MAX_THREADS && g_trace.name[k][0]; ++k) tm_name_rec(0u, k, g_trace.name[k]);
+    for (k = 0; k < tm_ncounters; ++k) tm_name_rec(1u, k, tm_name[k]);
+#if QSTAT
+    for (k = 0; k < QS_METRICS; ++k) tm_qstat_rec(k);
+#endif
+  }
+
+  /* utilisation since the last period */
+  now  = hrclock_cyc32();
+  idle = g_idle_cyc;
+  win  = now - last_cyc;
+  if (periods > 1u && win) {
+    uint32_t idle_pm = (uint32_t)(((uint64_t)(idle - last_idle) * 1000u) / win);
+    g_tm.busy_pm = (idle_pm < 1000u) ? 1000u - idle_pm : 0u;
+    tm_put16(b, g_tm.busy_pm);
+    tm_put32(b + 2, win);
+    tm_rec(TM_REC_UTIL, b, 6u);
+  }
+  last_cyc  = now;
+  last_idle = idle;
+
+  for (k = 0; k < tm_ncounters; ++k) {
+    b[0] = (uint8_t)k;
+    tm_put32(b + 1, *tm_val[k]);
+    tm_rec(TM_REC_COUNTER, b, 5u);
+  }
+
+  /* trace events recorded since the last period, oldest first; a writer
+     preempted between claiming and filling its slot holds the rest back
+     to the next period */
+  head = g_trace.head;
+  if (head - tm_trace_next > TRACE_SLOTS) {
+    g_tm.trace_lost += head - tm_trace_next - TRACE_SLOTS;
+    tm_trace_next = head - TRACE_SLOTS;
+  }
+  for (; tm_trace_next != head && trace_filled(tm_trace_next); ++tm_trace_next) {
+    const trace_rec_t *r = &g_trace.rec[tm_trace_next & (TRACE_SLOTS - 1u)];
+    tm_put32(b, r->ts);
+    b[4] = r->ev;
+    b[5] = r->thread;
+    tm_put16(b + 6, r->arg);
+    tm_rec(TM_REC_TRACE, b, 8u);
+  }
+
+  tm_put32(b,      g_tm.frames_dropped);
+  tm_put32(b + 4,  g_tm.records_dropped);
+  tm_put32(b + 8,  g_tm.trace_lost);
+  tm_put32(b + 12, g_tm.dma_errors);
+  tm_rec(TM_REC_DROP, b, 16u);
+  tm_seal();
+}
+
+void tm_collect(void const *arg)
+{
+  (void)arg;
+  for (;;) {
+    osDelay(TU_DELAY_MS(TM_PERIOD_MS));
+    tm_sample();
+  }
+}
+osThreadDef(tm_collect, osPriorityHigh, 1, 0);
+
+/* ------------------- API ------------------- */
+/* DL and fractional divider closest to TM_BAUD: pclk * mul / (16 * dl * (mul + add)) */
+static void tm_uart_init(void)
+{
+  uint32_t mul, add, best_err = 0xFFFFFFFFu, best_dl = 1u, best_fdr = 0x10u;
+
+  for (mul = 1u; mul <= 15u; ++mul) {
+    for (add = 0u; add < mul; ++add) {
+      uint64_t den = 16u * (uint64_t)TM_BAUD * (mul + add);
+      uint32_t dl  = (uint32_t)(((uint64_t)TU_UART0_HZ * mul + den / 2u) / den);
+      uint32_t baud, err;
+      if (dl == 0u || dl > 0xFFFFu || (add && dl < 3u)) continue;
+      baud = (uint32_t)(((uint64_t)TU_UART0_HZ * mul) / (16u * (uint64_t)dl * (mul + add)));
+      err  = (baud > TM_BAUD) ? baud - TM_BAUD : TM_BAUD - baud;
+      if (err < best_err) { best_err = err; best_dl = dl; best_fdr = (mul << 4) | add; }
+    }
+  }
+
+  LPC_SC->PCONP |= (1u << 3) | (1u << 29);                           /* PCUART0, PCGPDMA */
+  LPC_PINCON->PINSEL0 = (LPC_PINCON->PINSEL0 & ~(3u << 4)) | (1u << 4); /* P0.2 = TXD0 */
+  LPC_UART0->LCR = 0x83u;               /* 8N1, divisor latch open */
+  LPC_UART0->DLL = (uint8_t)best_dl;
+  LPC_UART0->DLM = (uint8_t)(best_dl >> 8);
+  LPC_UART0->LCR = 0x03u;
+  LPC_UART0->FDR = (uint8_t)best_fdr;
+  LPC_UART0->FCR = 0x0Fu;               /* FIFOs on and reset, DMA mode */
+  LPC_UART0->TER = 0x80u;
+}
+
+int tm_init(void)
+{
+  static osThreadId tid;
+
+  if (tid) return 0;
+  tm_uart_init();
+  LPC_GPDMA->Config = 1u;               /* little-endian AHB master */
+  NVIC_SetPriority(DMA_IRQn, TM_IRQ_PRIO);
+  NVIC_EnableIRQ(DMA_IRQn);
+  tm_trace_next = g_trace.head;
+  tid = osThreadCreate(osThread(tm_collect), NULL);
+  if (!tid) return -1;
+  (void)trace_register(tid, "telem");
+  return 0;
+}
+
+int tm_counter(const char *name, const volatile uint32_t *value)
+{
+  uint32_t k = tm_ncounters, i;
+
+  if (!value || k >= TM_MAX_COUNTERS) return -1;
+  for (i = 0; i < TM_NAME_LEN - 1u && name && name[i]; ++i) tm_name[k][i] = name[i];
+  tm_name[k][i] = '\0';
+  tm_val[k] = value;
+  tm_ncounters = k + 1u;                /* publish after the name is in place */
+  return (int)k;
+}
+
+#endif /* TELEMETRY */
@@ -0,0 +1,91 @@
+/* COE718 Lab 3a - UART telemetry over DMA
+ *
+ * Streams what the watch windows show without halting the core.  Every
+ * TM_PERIOD_MS the tm_collect thread batches
+ *
+ *   trace events   new g_trace records since the last period
+ *   counters       registered with tm_counter()
+ *   utilisation    CPU busy per mille, from the idle loop (g_idle_cyc)
+ *   drops          cumulative loss counters, so the host sees backpressure
+ *   names          thread and counter names, every TM_NAME_EVERY periods
+ *   statistics     qstat.h snapshots with QSTAT=1, as often as the names
+ *
+ * into frames that GPDMA channel RTE_UART0_DMA_TX_CH (RTE_Device.h) feeds
+ * to UART0 TX (P0.2) at TM_BAUD, 8N1.  The register-level driver owns
+ * UART0, so the CMSIS USART driver must stay disabled (RTE_UART0 0).
+ *
+ * Frame, little-endian:
+ *
+ *   0xA5 0x5A | seq | len | records[len] | crc16
+ *
+ * seq counts frames handed to the DMA, so a gap on the host means frames
+ * lost on the wire; crc16 is CCITT (0x1021, init 0xFFFF) over seq, len and
+ * the records.  A record is type | len | body.  While all TM_FRAMES
+ * buffers wait for the DMA, new records are dropped and counted in
+ * g_tm (and in the next TM_REC_DROP), never blocked on.
+ *
+ * The encoder (tm_crc16, tm_frame_*) is plain C and is shared with the
+ * host receiver, tools/telem_rx.c.  Build with TELEMETRY=1 to include the
+ * transport; main() starts it after Init_Thread().
+ */
+#pragma once
+#include <stdint.h>
+
+#ifndef TELEMETRY
+# define TELEMETRY       0
+#endif
+
+#define TM_SYNC0         0xA5u
+#define TM_SYNC1         0x5Au
+#define TM_HDR_BYTES     4u
+#define TM_PAYLOAD_MAX   240u
+#define TM_FRAME_BYTES   (TM_HDR_BYTES + TM_PAYLOAD_MAX + 2u)
+#define TM_FRAMES        4u             /* power of two */
+#define TM_BAUD          115200u
+#define TM_PERIOD_MS     50u
+#define TM_NAME_EVERY    20u            /* periods between name records */
+#define TM_MAX_COUNTERS  8u
+#define TM_NAME_LEN      8u
+
+/* record types and body layouts; append only */
+enum {
+  TM_REC_NAME = 1,    /* kind u8 (0 thread, 1 counter), index u8, name[TM_NAME_LEN] */
+  TM_REC_TRACE,       /* trace_rec_t: ts u32, ev u8, thread u8, arg u16 */
+  TM_REC_COUNTER,     /* index u8, value u32 */
+  TM_REC_UTIL,        /* busy per mille u16, window in cycles u32 */
+  TM_REC_DROP,        /* frames u32, records u32, trace events u32, DMA errors u32 */
+  TM_REC_QSTAT        /* qstat.h metric u8, count, min, max, mean, sd, q[QS_NQ] u32 */
+};
+
+typedef struct {
+  uint8_t  buf[TM_FRAME_BYTES];
+  uint16_t len;                         /* bytes used, header included */
+} tm_frame_t;
+
+typedef struct {
+  uint32_t frames_sent;
+  uint32_t bytes_sent;
+  uint32_t frames_dropped;              /* no free buffer when sealing */
+  uint32_t records_dropped;
+  uint32_t trace_lost;                  /* overwritten in g_trace before sent */
+  uint32_t dma_errors;
+  uint32_t busy_pm;                     /* last utilisation sample */
+} tm_stat_t;
+
+extern tm_stat_t g_tm;
+
+/* Core cycles spent in os_idle_demon (RTX_Conf_CM.c), wrapping. */
+extern volatile uint32_t g_idle_cyc;
+
+uint16_t tm_crc16(const uint8_t *p, uint32_t n);
+void     tm_frame_begin(tm_frame_t *f, uint8_t seq);
+/* Returns -1 (frame unchanged) when the record does not fit. */
+int      tm_frame_add(tm_frame_t *f, uint8_t type, const uint8_t *body, uint32_t len);
+/* Appends the CRC; returns the frame length in bytes. */
+uint32_t tm_frame_end(tm_frame_t *f);
+
+#if TELEMETRY
+int      tm_init(void);                 /* UART0, DMA and the collector thread */
+/* Samples *value every period; returns the counter index or -1. */
+int      tm_counter(const char *name, const volatile uint32_t *value);
+#endif
@@ -0,0 +1,46 @@
+/* COE718 Lab 3a - telemetry frame encoder (target + host receiver), see telem.h */
+
+#include "telem.h"
+
+uint16_t tm_crc16(const uint8_t *p, uint32_t n)
+{
+  uint16_t crc = 0xFFFFu;
+  uint32_t i;
+
+  while (n--) {
+    crc ^= (uint16_t)(*p++ << 8);
+    for (i = 0; i < 8u; ++i) crc = (uint16_t)((crc & 0x8000u) ? (crc << 1) ^ 0x1021u : (uint32_t)crc << 1);
+  }
+  return crc;
+}
+
+void tm_frame_begin(tm_frame_t *f, uint8_t seq)
+{
+  f->buf[0] = TM_SYNC0;
+  f->buf[1] = TM_SYNC1;
+  f->buf[2] = seq;
+  f->buf[3] = 0u;
+  f->len    = TM_HDR_BYTES;
+}
+
+int tm_frame_add(tm_frame_t *f, uint8_t type, const uint8_t *body, uint32_t len)
+{
+  uint32_t i;
+
+  if (f->len + 2u + len > TM_HDR_BYTES + TM_PAYLOAD_MAX) return -1;
+  f->buf[f->len++] = type;
+  f->buf[f->len++] = (uint8_t)len;
+  for (i = 0; i < len; ++i) f->buf[f->len++] = body[i];
+  return 0;
+}
+
+uint32_t tm_frame_end(tm_frame_t *f)
+{
+  uint16_t crc;
+
+  f->buf[3] = (uint8_t)(f->len - TM_HDR_BYTES);
+  crc = tm_crc16(&f->buf[2], f->len - 2u);
+  f->buf[f->len++] = (uint8_t)crc;
+  f->buf[f->len++] = (uint8_t)(crc >> 8);
+  return f->len;
+}
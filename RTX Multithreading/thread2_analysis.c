@@ -1,4 +1,12 @@
 #include "cmsis_os.h"
+#include "LPC17xx.h"
+#include "msg_ring.h"
+#include "task_graph.h"
+#include "work_pool.h"
+#include "trace.h"
+#include "mutex_probe.h"
+#include "time_units.h"
+#include "hrclock.h"
 #include <stdint.h>
 #include <string.h>
 
@@ -16,34 +24,51 @@ volatile uint32_t bb_word = 0;
 volatile char     logger[128] = {0};
 
 volatile const char *logger_str   = logger;
+
+// ------------------- Logger hand-off benchmark -----------------
+/* Same App->Device traffic pushed LOG_BENCH_RECORDS times, first through the
+   original mutex + strcpy/strcat + signal-pair scheme, then through the
+   zero-copy ring committed every LOG_BENCH_BATCH records. Cycles come from
+   hrclock_cyc32(), which counts core clocks. */
+#define LOG_BENCH_RECORDS  2000u
+#define LOG_BENCH_BATCH    8u
+
+volatile uint32_t g_bench_mutex_cycles = 0;   /* per record */
+volatile uint32_t g_bench_ring_cycles  = 0;   /* per record */
+volatile uint32_t g_bench_mutex_rps    = 0;   /* records per second */
+volatile uint32_t g_bench_ring_rps     = 0;
+volatile uint32_t g_bench_ring_wakeups = 0;   /* consumer signals issued */
+volatile uint32_t g_bench_sink_records = 0;
+volatile uint8_t  g_bench_done         = 0;
+
+static msg_ring_t app_to_dev, bench_ring;
 // ------------------- Timeline monitor -------------
 static char timeline[128];
 static volatile uint32_t tl_head = 0;
 osMutexDef(tl_mutex);
-static osMutexId tl_mutex;
+static mp_mutex_t tl_mutex;
 
 volatile const char *timeline_str = timeline;
 
 static __inline void tl_mark(char tag) {
-  osMutexWait(tl_mutex, osWaitForever);
+  mp_wait(&tl_mutex, osWaitForever);
   if (tl_head < sizeof(timeline) - 1) {
     if (tl_head == 0 || timeline[tl_head - 1] != tag) {
       timeline[tl_head++] = tag;
       timeline[tl_head]   = '\0';
     }
   }
-  osMutexRelease(tl_mutex);
+  mp_release(&tl_mutex);
 }
 
 // ------------------- Signals -------------------
-#define SIG_MM_TO_CPU   (1U << 0)
-#define SIG_CPU_TO_MM   (1U << 1)
-#define SIG_APP_READY   (1U << 2)
-#define SIG_DEV_DONE    (1U << 3)
+#define SIG_BENCH_DATA  (1U << 0)
+#define SIG_BENCH_ACK   (1U << 1)
+#define SIG_JOB_DONE    (1U << 2)
 
 // ------------------- Single global mutex for logger ------------
 osMutexDef(log_mutex);
-static osMutexId log_mutex;
+static mp_mutex_t log_mutex;
 
 // ------------------- Bit-band helpers (SRAM) -------------------
 #define BB_SRAM_REF   (0x20000000UL)
@@ -71,42 +96,153 @@ static __inline uint32_t ror32(uint32_t x, unsigned n)
   return (x >> n) | (x << (32U - n));
 }
 
+// ------------------- Roles as a task graph --------------------
+/* Memory -> CPU and App -> Device -> AppDone <- UI, expressed as edges
+   instead of SIG_MM_TO_CPU / SIG_APP_READY / SIG_DEV_DONE hand-offs. The
+   graph runs GRAPH_ITERATIONS times as jobs on the persistent work pool. */
+#define GRAPH_ITERATIONS   10000u
+
+enum { N_MEM, N_CPU, N_APP, N_DEV, N_UI, N_APP_DONE, N_ROLES };
+
+static void role_memory(void *ctx);
+static void role_cpu(void *ctx);
+static void role_app(void *ctx);
+static void role_device(void *ctx);
+static void role_ui(void *ctx);
+static void role_app_done(void *ctx);
+
+static const tg_node_def_t roles_graph[N_ROLES] = {
+  /* name       function        ctx   depends on                    prio */
+  { "Memory",   role_memory,    0,    0,                             0 },
+  { "CPU",      role_cpu,       0,    TG_DEP(N_MEM),                 0 },
+  { "App",      role_app,       0,    0,                             0 },
+  { "Device",   role_device,    0,    TG_DEP(N_APP),                 0 },
+  { "UI",       role_ui,        0,    0,                             0 },
+  { "AppDone",  role_app_done,  0,    TG_DEP(N_DEV) | TG_DEP(N_UI),  0 },
+};
+static tg_graph_t roles;
+
+volatile uint32_t g_graph_iters       = 0;
+volatile uint32_t g_graph_ips         = 0;   /* graph iterations per second */
+volatile uint32_t g_graph_iter_cycles = 0;   /* mean wall cycles per iteration */
+volatile uint32_t g_graph_crit_mask   = 0;   /* TG_DEP() bits of critical path */
+volatile uint32_t g_graph_crit_cycles = 0;
+volatile uint32_t g_graph_node_mean[N_ROLES];
+volatile uint32_t g_graph_node_max[N_ROLES];
+volatile uint8_t  g_graph_done        = 0;
+
+// ------------------- Pool vs create/terminate benchmark ---------
+/* POOL_BENCH_JOBS identical jobs, first each on a freshly created thread
+   that terminates when done (the old one-shot role pattern), then on the
+   work pool. Latencies are paired from the trace ring: create/submit ->
+   job start (dispatch) and -> job end (round trip). Kept below
+   TRACE_SLOTS/3 so one phase fits in the ring. */
+#define POOL_BENCH_JOBS    64u
+TU_STATIC_ASSERT(pb_ids_pair, POOL_BENCH_JOBS <= TRACE_PAIR_IDS);
+
+volatile uint32_t g_oneshot_dispatch = 0;    /* cycles, mean */
+volatile uint32_t g_oneshot_dispatch_max = 0;
+volatile uint32_t g_oneshot_roundtrip = 0;
+volatile uint32_t g_pool_dispatch    = 0;
+volatile uint32_t g_pool_dispatch_max = 0;
+volatile uint32_t g_pool_roundtrip   = 0;
+volatile uint32_t g_pool_threads     = WP_WORKERS;   /* constant */
+volatile uint8_t  g_pool_bench_done  = 0;
+
 // ------------------- Thread IDs & defs -------------------------
-static osThreadId tid_mem, tid_cpu, tid_app, tid_dev, tid_ui, tid_mon;
+static osThreadId tid_graph, tid_mon;
+static osThreadId tid_bench, tid_sink, tid_poolbench;
 
-void Th_MemoryManagement(const void *arg);
-void Th_CPUManagement(const void *arg);
-void Th_ApplicationInterface(const void *arg);
-void Th_DeviceManagement(const void *arg);
-void Th_UserInterface(const void *arg);
+void Th_RolesGraph(const void *arg);
 void Monitor(const void *arg);
+void Th_LogBench(const void *arg);
+void Th_LogSink(const void *arg);
+void Th_PoolBench(const void *arg);
+void Th_OneShotJob(const void *arg);
 
 /* Explicit stacks */
-osThreadDef(Th_MemoryManagement,    osPriorityNormal, 1, 0);
-osThreadDef(Th_CPUManagement,       osPriorityNormal, 1, 0);
-osThreadDef(Th_ApplicationInterface,osPriorityNormal, 1, 0);
-osThreadDef(Th_DeviceManagement,    osPriorityNormal, 1, 0);
-osThreadDef(Th_UserInterface,       osPriorityNormal, 1, 0);
+osThreadDef(Th_RolesGraph,          osPriorityNormal, 1, 0);
 osThreadDef(Monitor,                osPriorityLow,    1, 0);
+/* MUTEX_ANALYSIS: spread the pool workers (they run the roles and contend
+   on tl_mutex) and the logger pair over distinct priorities so blocking
+   and priority inheritance become visible. The sink sits above the bench
+   because the bench spins on osThreadYield() until the sink drains. */
+#if MUTEX_ANALYSIS
+# define PRIO_SINK  osPriorityAboveNormal
+#else
+# define PRIO_SINK  osPriorityNormal
+#endif
+
+osThreadDef(Th_LogBench,            osPriorityNormal, 1, 0);
+osThreadDef(Th_LogSink,             PRIO_SINK,        1, 0);
+osThreadDef(Th_PoolBench,           osPriorityNormal, 1, 0);
+osThreadDef(Th_OneShotJob,          osPriorityNormal, 1, 0);
 
 int Init_Thread (void) {
-  tl_mutex  = osMutexCreate(osMutex(tl_mutex));
-  log_mutex = osMutexCreate(osMutex(log_mutex));
-
-  tid_mem = osThreadCreate(osThread(Th_MemoryManagement),    NULL);
-  tid_cpu = osThreadCreate(osThread(Th_CPUManagement),       NULL);
-  tid_app = osThreadCreate(osThread(Th_ApplicationInterface),NULL);
-  tid_dev = osThreadCreate(osThread(Th_DeviceManagement),    NULL);
-  tid_ui  = osThreadCreate(osThread(Th_UserInterface),       NULL);
-  if (!tid_mem || !tid_cpu || !tid_app || !tid_dev || !tid_ui) return -1;
+  trace_init();
+  if (mp_create(&tl_mutex,  osMutex(tl_mutex),  "tl")  != 0) return -1;
+  if (mp_create(&log_mutex, osMutex(log_mutex), "log") != 0) return -1;
+  if (msg_pool_init() != 0) return -1;
+
+  /* App and Device are ordered by the graph edge, so no wake-up signal */
+  msg_ring_init(&app_to_dev, NULL, 0);
+  if (wp_init() != 0) return -1;
+#if MUTEX_ANALYSIS
+  {
+    static const osPriority wp_prio[3] = { osPriorityBelowNormal, osPriorityNormal, osPriorityAboveNormal };
+    uint32_t k;
+    for (k = 0; k < WP_WORKERS; ++k) (void)osThreadSetPriority(wp_worker_tid(k), wp_prio[k % 3u]);
+  }
+#endif
+  if (tg_init(&roles, roles_graph, N_ROLES) != 0) return -1;
+  tid_graph = osThreadCreate(osThread(Th_RolesGraph), NULL);
+  if (!tid_graph) return -1;
+  (void)trace_register(tid_graph, "graph");
 
   /* Finite monitor */
   tid_mon = osThreadCreate(osThread(Monitor), NULL);
+
+  /* Logger benchmark pair */
+  tid_sink  = osThreadCreate(osThread(Th_LogSink),  NULL);
+  tid_bench = osThreadCreate(osThread(Th_LogBench), NULL);
+  if (!tid_sink || !tid_bench) return -1;
+  (void)trace_register(tid_sink,  "logsink");
+  (void)trace_register(tid_bench, "logbnch");
+  msg_ring_init(&bench_ring, tid_sink, SIG_BENCH_DATA);
+
+  tid_poolbench = osThreadCreate(osThread(Th_PoolBench), NULL);
+  if (!tid_poolbench) return -1;
+  (void)trace_register(tid_poolbench, "poolbnch");
   return 0;
 }
 
 // ------------------- Implementations --------------------------
-void Th_MemoryManagement(const void *arg)
+void Th_RolesGraph(const void *arg)
+{
+  uint64_t total = 0u;
+  uint32_t i, t0;
+
+  for (i = 0; i < GRAPH_ITERATIONS; ++i) {
+    t0 = hrclock_cyc32();
+    (void)tg_run(&roles);
+    total += hrclock_cyc32() - t0;
+    g_graph_iters = i + 1u;
+  }
+
+  tg_analyse(&roles);
+  g_graph_iter_cycles = (uint32_t)(total / GRAPH_ITERATIONS);
+  g_graph_ips = total ? (uint32_t)(((uint64_t)GRAPH_ITERATIONS * SystemCoreClock) / total) : 0u;
+  g_graph_crit_mask   = roles.crit_mask;
+  g_graph_crit_cycles = roles.crit_cycles;
+  for (i = 0; i < N_ROLES; ++i) {
+    g_graph_node_mean[i] = roles.stat[i].runs ? (uint32_t)(roles.stat[i].sum / roles.stat[i].runs) : 0u;
+    g_graph_node_max[i]  = roles.stat[i].max;
+  }
+  g_graph_done = 1u;
+  osThreadTerminate(osThreadGetId());
+}
+
+static void role_memory(void *ctx)
 {
   uint32_t b0;
   mem_access_counter++;
@@ -117,86 +253,224 @@ void Th_MemoryManagement(const void *arg)
   bb_write_bit((void*)&bb_word, 2U, 0U);
   b0 = bb_read_bit((void*)&bb_word, 0U);
   bb_write_bit((void*)&bb_word, 0U, b0 ^ 1U);
-
-  /* Signal CPU and wait for response */
-  osSignalSet(tid_cpu, SIG_MM_TO_CPU);
-  (void)osSignalWait(SIG_CPU_TO_MM, osWaitForever);
-
-  osDelay(1);
-  osThreadTerminate(osThreadGetId());
 }
 
-void Th_CPUManagement(const void *arg)
+static void role_cpu(void *ctx)
 {
   uint32_t x;
   unsigned rot;
 
-  (void)osSignalWait(SIG_MM_TO_CPU, osWaitForever);
   tl_mark('C');
-
   cpu_access_counter++;
 
   /* Conditional rotate: if bit3 set in bb_word, rotate by 7 else by 3 */
   x = (uint32_t)bb_word;
   rot = bb_read_bit((void*)&bb_word, 3U) ? 7U : 3U;
   x = ror32(x ^ 0xA5A5A5A5UL, rot);
-
-  osSignalSet(tid_mem, SIG_CPU_TO_MM);
-  osThreadTerminate(osThreadGetId());
+  (void)x;
 }
 
-void Th_ApplicationInterface(const void *arg)
+static void role_app(void *ctx)
 {
+  char *rec;
   tl_mark('A');
 
-  osMutexWait(log_mutex, osWaitForever);
-  strcpy((char*)logger, "App: begin write -> ");
-  osMutexRelease(log_mutex);
-
-  osSignalSet(tid_dev, SIG_APP_READY);
-  (void)osSignalWait(SIG_DEV_DONE, osWaitForever);
-
-  app_counter++;
-  osDelay(1);
-  osThreadTerminate(osThreadGetId());
+  /* Zero-copy: fill a pooled record and pass the pointer to Device */
+  rec = msg_buf_alloc();
+  if (!rec) return;
+  (void)msg_ring_push(&app_to_dev, rec, msg_buf_append(rec, 0u, "App: begin write -> "), 0u);
+  msg_ring_commit(&app_to_dev);
 }
 
-void Th_DeviceManagement(const void *arg)
+static void role_device(void *ctx)
 {
-  (void)osSignalWait(SIG_APP_READY, osWaitForever);
+  static char *shown = 0;        /* record currently behind logger_str */
+  msg_desc_t d;
   tl_mark('D');
 
-  osMutexWait(log_mutex, osWaitForever);
-  strcat((char*)logger, "Device: append + close.");
-  osMutexRelease(log_mutex);
-
-  osSignalSet(tid_app, SIG_DEV_DONE);
-
+  /* Device owns the record now: append in place and publish it for the
+     Watch window via logger_str; the previous one goes back to the pool */
+  while (msg_ring_pop(&app_to_dev, &d)) {
+    (void)msg_buf_append(d.data, d.len, "Device: append + close.");
+    logger_str = d.data;
+    msg_buf_free(shown);
+    shown = d.data;
+  }
   dev_counter++;
-  osDelay(1);
-  osThreadTerminate(osThreadGetId());
 }
 
-void Th_UserInterface(const void *arg)
+static void role_ui(void *ctx)
 {
   tl_mark('U');
   ui_user_count++;
-  //osDelay(1);
-  osThreadTerminate(osThreadGetId());
+}
+
+static void role_app_done(void *ctx)
+{
+  app_counter++;
 }
 
 /* Finite Monitor: terminates after ~2s */
+#define MON_PERIOD_MS   50u
+#define POLL_MS         10u
+TU_CHECK_MS(mon_period, MON_PERIOD_MS);
+TU_CHECK_MS(poll, POLL_MS);
+
 void Monitor(const void *arg)
 {
   static volatile uint32_t hb = 0;
   uint32_t i;
-  for (i = 0; i < 40U; ++i) {  /* 40 * 50 ms = ~2 seconds */
+  for (i = 0; i < 2000U / MON_PERIOD_MS; ++i) {
     hb++;
-    osDelay(50);
+    osDelay(TU_DELAY_MS(MON_PERIOD_MS));
   }
   osThreadTerminate(osThreadGetId());
 }
 
+/* ------------------- Logger benchmark ------------------------- */
+static uint32_t bench_rps(uint32_t cycles)
+{
+  if (cycles == 0u) return 0u;
+  return (uint32_t)(((uint64_t)LOG_BENCH_RECORDS * SystemCoreClock) / cycles);
+}
+
+void Th_LogBench(const void *arg)
+{
+  uint32_t i, t0, dt;
+  char *rec;
+
+  while (!g_graph_done) osDelay(TU_DELAY_MS(POLL_MS));  /* keep the roles graph run undisturbed */
+
+  /* A: original scheme, one mutex section + signal round trip per record.
+     Signals go through the same traced wrappers msg_ring_commit uses, so
+     both phases pay the same per-signal cost. */
+  t0 = hrclock_cyc32();
+  for (i = 0; i < LOG_BENCH_RECORDS; ++i) {
+    mp_wait(&log_mutex, osWaitForever);
+    strcpy((char*)logger, "App: begin write -> ");
+    mp_release(&log_mutex);
+    TRACE_SIGNAL_SET(tid_sink, SIG_BENCH_DATA);
+    (void)TRACE_SIGNAL_WAIT(SIG_BENCH_ACK, osWaitForever);
+  }
+  dt = hrclock_cyc32() - t0;
+  g_bench_mutex_cycles = dt / LOG_BENCH_RECORDS;
+  g_bench_mutex_rps    = bench_rps(dt);
+
+  /* B: zero-copy ring, one consumer wake-up per LOG_BENCH_BATCH records */
+  osSignalSet(tid_sink, SIG_BENCH_ACK);        /* sink: switch to ring mode */
+  (void)osSignalWait(SIG_BENCH_ACK, osWaitForever);
+  t0 = hrclock_cyc32();
+  for (i = 0; i < LOG_BENCH_RECORDS; ++i) {
+    while ((rec = msg_buf_alloc()) == NULL) {  /* pool dry: flush and let sink run */
+      msg_ring_commit(&bench_ring);
+      osThreadYield();
+    }
+    while (msg_ring_push(&bench_ring, rec, msg_buf_append(rec, 0u, "App: begin write -> "), 0u) != 0) {
+      msg_ring_commit(&bench_ring);
+      osThreadYield();
+    }
+    if (((i + 1u) % LOG_BENCH_BATCH) == 0u) msg_ring_commit(&bench_ring);
+  }
+  msg_ring_commit(&bench_ring);
+  while (g_bench_sink_records < LOG_BENCH_RECORDS) osThreadYield();
+  dt = hrclock_cyc32() - t0;
+  g_bench_ring_cycles  = dt / LOG_BENCH_RECORDS;
+  g_bench_ring_rps     = bench_rps(dt);
+  g_bench_ring_wakeups = bench_ring.commits;
+
+  g_bench_done = 1u;
+  osThreadTerminate(osThreadGetId());
+}
+
+void Th_LogSink(const void *arg)
+{
+  uint32_t i;
+  msg_desc_t d;
+
+  for (i = 0; i < LOG_BENCH_RECORDS; ++i) {
+    (void)TRACE_SIGNAL_WAIT(SIG_BENCH_DATA, osWaitForever);
+    mp_wait(&log_mutex, osWaitForever);
+    strcat((char*)logger, "Device: append + close.");
+    mp_release(&log_mutex);
+    TRACE_SIGNAL_SET(tid_bench, SIG_BENCH_ACK);
+  }
+
+  (void)osSignalWait(SIG_BENCH_ACK, osWaitForever);
+  osSignalSet(tid_bench, SIG_BENCH_ACK);
+  while (g_bench_sink_records < LOG_BENCH_RECORDS) {
+    (void)TRACE_SIGNAL_WAIT(SIG_BENCH_DATA, osWaitForever);
+    while (msg_ring_pop(&bench_ring, &d)) {
+      (void)msg_buf_append(d.data, d.len, "Device: append + close.");
+      msg_buf_free(d.data);
+      g_bench_sink_records++;
+    }
+  }
+  osThreadTerminate(osThreadGetId());
+}
+
+/* ------------------- Pool benchmark -------------------------- */
+static void bench_job_work(uint32_t seed)
+{
+  volatile uint32_t acc = seed;
+  uint32_t n;
+  for (n = 0; n < 200u; ++n) acc = ror32(acc ^ n, 3U);
+}
+
+void Th_OneShotJob(const void *arg)
+{
+  uint16_t id = (uint16_t)(uint32_t)arg;
+  TRACE(TR_JOB_START, id);
+  bench_job_work(id);
+  TRACE(TR_JOB_END, id);
+  osSignalSet(tid_poolbench, SIG_JOB_DONE);
+  osThreadTerminate(osThreadGetId());
+}
+
+static void pool_job(wp_job_t *j)
+{
+  bench_job_work(j->arg);
+}
+
+void Th_PoolBench(const void *arg)
+{
+  static wp_job_t job;
+  uint32_t j, mean, max;
+
+  while (!g_bench_done) osDelay(TU_DELAY_MS(POLL_MS));   /* after the logger benchmark */
+
+  /* A: create + terminate a thread per job */
+  trace_clear();
+  for (j = 0; j < POOL_BENCH_JOBS; ++j) {
+    TRACE(TR_THREAD_CREATE, j);
+    if (!osThreadCreate(osThread(Th_OneShotJob), (void *)j)) break;
+    (void)osSignalWait(SIG_JOB_DONE, osWaitForever);
+  }
+  (void)trace_pair_stats(TR_THREAD_CREATE, TR_JOB_START, &mean, &max);
+  g_oneshot_dispatch = mean; g_oneshot_dispatch_max = max;
+  (void)trace_pair_stats(TR_THREAD_CREATE, TR_JOB_END, &mean, 0);
+  g_oneshot_roundtrip = mean;
+
+  /* B: same jobs dispatched to the persistent pool */
+  trace_clear();
+  job.fn     = pool_job;
+  job.notify = osThreadGetId();
+  job.signal = SIG_JOB_DONE;
+  for (j = 0; j < POOL_BENCH_JOBS; ++j) {
+    job.arg = j;
+    job.id  = (uint16_t)j;
+    while (wp_submit(&job) != 0) osThreadYield();
+    wp_wait(&job);
+  }
+  (void)trace_pair_stats(TR_JOB_SUBMIT, TR_JOB_START, &mean, &max);
+  g_pool_dispatch = mean; g_pool_dispatch_max = max;
+  (void)trace_pair_stats(TR_JOB_SUBMIT, TR_JOB_END, &mean, 0);
+  g_pool_roundtrip = mean;
+
+  mp_report();                        /* last benchmark: blocking report */
+  g_pool_bench_done = 1u;
+  osThreadTerminate(osThreadGetId());
+}
+
 /* Dummy template symbols (not used) */
 void Thread1 (void const *argument) { for(;;) { osDelay(1000); } }
 void Thread2 (void const *argument) { for(;;) { osDelay(1000); } }
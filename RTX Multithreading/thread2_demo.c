@@ -1,16 +1,22 @@
 #include "cmsis_os.h"
 #include "LPC17xx.h"
 #include "GLCD.h"
+#include "msg_ring.h"
+#include "blog.h"
+#include "mutex_probe.h"
+#include "time_units.h"
+#include "trace.h"
+#include "qstat.h"
+#include "profile.h"
+#include "hrclock.h"
 #include <stdint.h>
-#include <string.h>
 
-/* ===== ~3-second window per task (RTX tick = 5 ms) ===== */
-#ifndef RTX_TICK_US
-# define RTX_TICK_US         5000u
-#endif
-#ifndef WINDOW_TICKS
-# define WINDOW_TICKS        600u   /* 600 * 5 ms  3.0 s */
+/* ===== ~3-second window per task ===== */
+#ifndef WINDOW_MS
+# define WINDOW_MS           3000u
 #endif
+#define WINDOW_TICKS         TU_MS_TO_TICKS(WINDOW_MS)
+TU_CHECK_MS(window, WINDOW_MS);
 
 /* ------------------- Shared demo/analysis state ------------------- */
 volatile uint32_t mem_access_counter = 0;
@@ -19,9 +25,13 @@ volatile uint32_t app_counter        = 0;
 volatile uint32_t dev_counter        = 0;
 volatile uint32_t ui_user_count      = 0;
 
-/* Bit-band demo target and shared logger */
+/* Bit-band demo target; logger_str tracks the record currently in flight */
 volatile uint32_t bb_word = 0;
-volatile char     logger[128] = {0};
+volatile const char *logger_str = 0;
+
+/* App -> Device and Device -> App descriptor rings (zero-copy hand-off) */
+static msg_ring_t app_to_dev, dev_to_app;
+#define LOG_TAG_APP     1u
 
 /* ------------------- Signals ------------------- */
 #define SIG_MM_TO_CPU   (1u << 0)
@@ -31,11 +41,8 @@ volatile char     logger[128] = {0};
 #define SIG_UI_DONE     (1u << 4)  // Added signal for UI done
 
 /* ------------------- Mutexes ------------------- */
-osMutexDef(log_mutex);
-static osMutexId log_mutex;
-
 osMutexDef(lcd_mutex);
-static osMutexId lcd_mutex;
+static mp_mutex_t lcd_mutex;          /* probed when MUTEX_ANALYSIS=1 */
 
 /* ------------------- Bit-band helpers (SRAM) ------------------- */
 #define BB_SRAM_REF   (0x20000000UL)
@@ -103,32 +110,37 @@ static void pad_copy(unsigned char *dst, unsigned int maxw, const char *src)
 static void lcd_line(unsigned int line, const char *txt)
 {
   static unsigned char buf[LCD_W+1];
+#if QSTAT
+  uint32_t t0;
+#endif
   pad_copy(buf, LCD_W, txt);
+#if QSTAT
+  t0 = hrclock_cyc32();
+#endif
+  TRACE(TR_LCD_BEGIN, line);
   GLCD_DisplayString(line, 0, 1, buf);
+  TRACE(TR_LCD_END, line);
+#if QSTAT
+  QS_ADD(QS_LCD_DRAW, hrclock_cyc32() - t0);
+#endif
 }
 
 static void lcd_title(const char *msg)            { lcd_line(0, msg); }
-static void lcd_active_text(const char *tn)
-{
-  static char tmp[32];
-  unsigned int i = 0;
-  const char *prefix = "Active: ";
-  while (prefix[i]) { tmp[i] = prefix[i]; i++; }
-  while (tn && *tn && i < sizeof(tmp)-1) { tmp[i++] = *tn++; }
-  tmp[i] = 0;
-  lcd_line(1, tmp);
-}
-static void lcd_status_line2(const char *txt)     { lcd_line(2, txt); }
 static void lcd_line3(const char *txt)            { lcd_line(3, txt); }
 
+/* status text goes through the binary log; BLOG_LCD renders it to a line */
+#define LN_ACTIVE   1u
+#define LN_STATUS   2u
+#define LN_DETAIL   3u
+
 /* ------------------- LCD lock + window --------------- */
-static void lcd_lock(void)   { osMutexWait(lcd_mutex, osWaitForever); }
-static void lcd_unlock(void) { osMutexRelease(lcd_mutex); }
+static void lcd_lock(void)   { mp_wait(&lcd_mutex, osWaitForever); }
+static void lcd_unlock(void) { mp_release(&lcd_mutex); }
 
 static void hold_window(void)
 {
   uint32_t t;
-  for (t = 0; t < WINDOW_TICKS; ++t) { osDelay(1); }
+  for (t = 0; t < WINDOW_TICKS; ++t) { osDelay(TU_DELAY_TICKS(1)); }
 }
 
 /* ------------------- Threads & defs ------------------------------- */
@@ -140,11 +152,28 @@ void Th_ApplicationInterface (void const *arg);
 void Th_DeviceManagement     (void const *arg);
 void Th_UserInterface        (void const *arg);
 
-osThreadDef(Th_MemoryManagement,     osPriorityNormal, 1, 0);
-osThreadDef(Th_CPUManagement,        osPriorityNormal, 1, 0);
-osThreadDef(Th_ApplicationInterface, osPriorityNormal, 1, 0);
-osThreadDef(Th_DeviceManagement,     osPriorityNormal, 1, 0);
-osThreadDef(Th_UserInterface,        osPriorityNormal, 1, 0);
+/* MUTEX_ANALYSIS: distinct priorities so lcd_mutex contention shows up as
+   blocking (and priority inheritance) instead of being hidden by RR.
+   UI must stay above App: App waits SIG_UI_DONE while holding the LCD. */
+#if MUTEX_ANALYSIS
+# define PRIO_MEM   osPriorityNormal
+# define PRIO_CPU   osPriorityHigh
+# define PRIO_APP   osPriorityLow
+# define PRIO_DEV   osPriorityBelowNormal
+# define PRIO_UI    osPriorityAboveNormal
+#else
+# define PRIO_MEM   osPriorityNormal
+# define PRIO_CPU   osPriorityNormal
+# define PRIO_APP   osPriorityNormal
+# define PRIO_DEV   osPriorityNormal
+# define PRIO_UI    osPriorityNormal
+#endif
+
+osThreadDef(Th_MemoryManagement,     PRIO_MEM, 1, 0);
+osThreadDef(Th_CPUManagement,        PRIO_CPU, 1, 0);
+osThreadDef(Th_ApplicationInterface, PRIO_APP, 1, 0);
+osThreadDef(Th_DeviceManagement,     PRIO_DEV, 1, 0);
+osThreadDef(Th_UserInterface,        PRIO_UI,  1, 0);
 
 /* ------------------- Init: LEDs/LCD + threads --------------------- */
 int Init_Thread (void)
@@ -157,17 +186,26 @@ int Init_Thread (void)
   GLCD_SetBackColor(Black);
   GLCD_Clear(Black);
 
-  /* create mutexes before any thread can draw */
-  log_mutex = osMutexCreate(osMutex(log_mutex));
-  lcd_mutex = osMutexCreate(osMutex(lcd_mutex));
+  /* create mutex and message pool before any thread can draw */
+  trace_init();
+  if (mp_create(&lcd_mutex, osMutex(lcd_mutex), "lcd") != 0) return -1;
+  if (msg_pool_init() != 0) return -1;
+
+  blog_init();
+  blog_set_lcd_sink(lcd_line);
 
   lcd_lock();
   lcd_title("Q2 Demo: OS Roles");
-  lcd_active_text("(waiting)");
-  lcd_status_line2("logger ready");
+  BLOG0(LN_ACTIVE, BLOG_ACTIVE_WAITING);
+  BLOG0(LN_STATUS, BLOG_LOGGER_READY);
   lcd_line3("                    ");
   lcd_unlock();
 
+  /* each ring has one producer and one consumer; commit wakes the
+     consumer, which binds itself when it starts */
+  msg_ring_init(&app_to_dev, 0, SIG_APP_READY);
+  msg_ring_init(&dev_to_app, 0, SIG_DEV_DONE);
+
   /* Create all roles; RR equal priorities; ordering via signals */
   tid_mem = osThreadCreate(osThread(Th_MemoryManagement),     NULL);
   tid_cpu = osThreadCreate(osThread(Th_CPUManagement),        NULL);
@@ -176,9 +214,15 @@ int Init_Thread (void)
   tid_ui  = osThreadCreate(osThread(Th_UserInterface),        NULL);
 
   if (!tid_mem || !tid_cpu || !tid_app || !tid_dev || !tid_ui) {
-    lcd_lock(); lcd_status_line2("ERR: thread create"); lcd_unlock();
+    lcd_lock(); BLOG0(LN_STATUS, BLOG_ERR_CREATE); lcd_unlock();
     return -1;
   }
+
+  (void)trace_register(tid_mem, "Memory");
+  (void)trace_register(tid_cpu, "CPU");
+  (void)trace_register(tid_app, "App");
+  (void)trace_register(tid_dev, "Device");
+  (void)trace_register(tid_ui,  "UI");
   return 0;
 }
 
@@ -192,8 +236,8 @@ void Th_MemoryManagement(const void *arg)
 
   led_show(0);
   lcd_lock();
-  lcd_active_text("Memory");
-  lcd_status_line2("bit-band ops...");
+  BLOG0(LN_ACTIVE, BLOG_ACTIVE_MEMORY);
+  BLOG0(LN_STATUS, BLOG_MEM_BITBAND);
 
   /* Bit-band demo: set bit3, clear bit2, toggle bit0 */
   bb_write_bit((void*)&bb_word, 3u, 1u);
@@ -202,28 +246,17 @@ void Th_MemoryManagement(const void *arg)
   bb_write_bit((void*)&bb_word, 0u, b0 ^ 1u);
 
   /* show bb_word hex */
-  {
-    char line[32];
-    unsigned int i = 0;
-    static const char H[16] = "0123456789ABCDEF";
-    uint32_t v = bb_word;
-    line[i++] = H[(v>>28)&0xF]; line[i++] = H[(v>>24)&0xF];
-    line[i++] = H[(v>>20)&0xF]; line[i++] = H[(v>>16)&0xF];
-    line[i++] = H[(v>>12)&0xF]; line[i++] = H[(v>>8)&0xF];
-    line[i++] = H[(v>>4)&0xF];  line[i++] = H[(v>>0)&0xF];
-    line[i]=0;
-    lcd_line3(line);
-  }
+  BLOG1(LN_DETAIL, BLOG_MEM_WORD, bb_word);
 
   hold_window();                 /* ~3 s spotlight (LCD locked) */
-  lcd_status_line2("Memory done");
+  BLOG0(LN_STATUS, BLOG_MEM_DONE);
   lcd_unlock();
 
   /* hand off to CPU and wait the reply so ordering is visible */
-  osSignalSet(tid_cpu, SIG_MM_TO_CPU);
-  (void)osSignalWait(SIG_CPU_TO_MM, osWaitForever);
+  TRACE_SIGNAL_SET(tid_cpu, SIG_MM_TO_CPU);
+  (void)TRACE_SIGNAL_WAIT(SIG_CPU_TO_MM, osWaitForever);
 
-  osDelay(1);                    /* 1 tick per spec */
+  osDelay(TU_DELAY_TICKS(1));    /* 1 tick per spec */
   osThreadTerminate(osThreadGetId());
 }
 
@@ -231,14 +264,14 @@ void Th_CPUManagement(const void *arg)
 {
   uint32_t x; unsigned rot; (void)arg;
 
-  (void)osSignalWait(SIG_MM_TO_CPU, osWaitForever);
+  (void)TRACE_SIGNAL_WAIT(SIG_MM_TO_CPU, osWaitForever);
 
   cpu_access_counter++;
 
   led_show(1);
   lcd_lock();
-  lcd_active_text("CPU");
-  lcd_status_line2("rotate & reply");
+  BLOG0(LN_ACTIVE, BLOG_ACTIVE_CPU);
+  BLOG0(LN_STATUS, BLOG_CPU_ROTATE);
 
   /* conditional rotate based on bb_word bit3 */
   x = (uint32_t)bb_word;
@@ -247,76 +280,101 @@ void Th_CPUManagement(const void *arg)
   (void)x;
 
   hold_window();
-  lcd_status_line2("CPU done");
+  BLOG0(LN_STATUS, BLOG_CPU_DONE);
   lcd_unlock();
 
-  osSignalSet(tid_mem, SIG_CPU_TO_MM);
+  TRACE_SIGNAL_SET(tid_mem, SIG_CPU_TO_MM);
   osThreadTerminate(osThreadGetId());
 }
 
 void Th_ApplicationInterface(const void *arg)
 {
+  char *rec;
+  uint16_t len;
+  msg_desc_t d;
   (void)arg;
 
-  /* Phase 1: present and write prefix (no waiting while locked) */
+  msg_ring_bind(&dev_to_app);
+
+  /* Phase 1: present and write prefix into a pooled record */
   led_show(2);
   lcd_lock();
-  lcd_active_text("App");
-  lcd_status_line2("write prefix...");
-  osMutexWait(log_mutex, osWaitForever);
-  strcpy((char*)logger, "App: begin -> ");
-  osMutexRelease(log_mutex);
-  lcd_line3((const char*)logger);
+  BLOG0(LN_ACTIVE, BLOG_ACTIVE_APP);
+  BLOG0(LN_STATUS, BLOG_APP_PREFIX);
+  rec = msg_buf_alloc();
+  if (!rec) {                        /* Device stays parked */
+    BLOG0(LN_STATUS, BLOG_ERR_POOL);
+    lcd_unlock();
+    osThreadTerminate(osThreadGetId());
+    return;
+  }
+  len = msg_buf_append(rec, 0u, "App: begin -> ");
+  logger_str = rec;
+  lcd_line3(rec);
   lcd_unlock();
 
-  /* Phase 2: coordinate with Device (no LCD lock held during wait) */
-  osSignalSet(tid_dev, SIG_APP_READY);
-  (void)osSignalWait(SIG_DEV_DONE, osWaitForever);
+  /* Phase 2: hand the record to Device (commit sets SIG_APP_READY) and
+     wait for it to come back on the reply ring; no LCD lock held */
+  (void)msg_ring_push(&app_to_dev, rec, len, LOG_TAG_APP);
+  msg_ring_commit(&app_to_dev);
+  (void)TRACE_SIGNAL_WAIT(SIG_DEV_DONE, osWaitForever);
+  rec = msg_ring_pop(&dev_to_app, &d) ? d.data : 0;
 
   /* Phase 3: show combined result and finish */
   app_counter++;
   led_show(2);
   lcd_lock();
-  lcd_active_text("App");
+  BLOG0(LN_ACTIVE, BLOG_ACTIVE_APP);
 
   /* Wait for UI to finish before printing "App done" */
-  (void)osSignalWait(SIG_UI_DONE, osWaitForever);
+  (void)TRACE_SIGNAL_WAIT(SIG_UI_DONE, osWaitForever);
 
-  lcd_line3((const char*)logger);    /* now contains both parts */
+  lcd_line3(rec);                    /* now contains both parts */
   hold_window();
-  lcd_status_line2("App done");
+  BLOG0(LN_STATUS, BLOG_APP_DONE);
   lcd_unlock();
 
-  osDelay(1);
+  logger_str = 0;
+  msg_buf_free(rec);
+  mp_report();                       /* App finishes last: blocking report */
+  qs_report();
+#if PROFILE
+  pf_stop();                         /* freeze g_prof for the dump */
+#endif
+
+  osDelay(TU_DELAY_TICKS(1));
   osThreadTerminate(osThreadGetId());
 }
 
 void Th_DeviceManagement(const void *arg)
 {
+  msg_desc_t d;
   (void)arg;
 
-  (void)osSignalWait(SIG_APP_READY, osWaitForever);
+  msg_ring_bind(&app_to_dev);
+  (void)TRACE_SIGNAL_WAIT(SIG_APP_READY, osWaitForever);
 
-  /* Device presents, appends, and signals back.
-     It does not wait after signaling, so holding the LCD lock is safe. */
+  /* Device owns each popped record: append in place, show it, then pass
+     it back.  It does not wait after committing, so holding the LCD lock
+     is safe. */
   led_show(3);
   lcd_lock();
-  lcd_active_text("Device");
-  lcd_status_line2("append & signal");
+  BLOG0(LN_ACTIVE, BLOG_ACTIVE_DEVICE);
+  BLOG0(LN_STATUS, BLOG_DEV_APPEND);
 
-  osMutexWait(log_mutex, osWaitForever);
-  strcat((char*)logger, "Device: close.");
-  osMutexRelease(log_mutex);
-
-  osSignalSet(tid_app, SIG_DEV_DONE);
+  while (msg_ring_pop(&app_to_dev, &d)) {
+    d.len = msg_buf_append(d.data, d.len, "Device: close.");
+    lcd_line3(d.data);
+    (void)msg_ring_push(&dev_to_app, d.data, d.len, d.tag);
+  }
+  msg_ring_commit(&dev_to_app);      /* ownership back to App, one wake-up */
 
   dev_counter++;
-  lcd_line3((const char*)logger);
   hold_window();
-  lcd_status_line2("Device done");
+  BLOG0(LN_STATUS, BLOG_DEV_DONE);
   lcd_unlock();
 
-  osDelay(1);
+  osDelay(TU_DELAY_TICKS(1));
   osThreadTerminate(osThreadGetId());
 }
 
@@ -326,17 +384,17 @@ void Th_UserInterface(const void *arg)
 
   led_show(4);
   lcd_lock();
-  lcd_active_text("User IF");
-  lcd_status_line2("one-shot task");
+  BLOG0(LN_ACTIVE, BLOG_ACTIVE_UI);
+  BLOG0(LN_STATUS, BLOG_UI_ONESHOT);
 
   ui_user_count++;
   hold_window();
-  lcd_status_line2("UI done");
+  BLOG0(LN_STATUS, BLOG_UI_DONE);
   lcd_unlock();
 
   // Signal App to proceed
-  osSignalSet(tid_app, SIG_UI_DONE);
+  TRACE_SIGNAL_SET(tid_app, SIG_UI_DONE);
 
-  osDelay(1);
+  osDelay(TU_DELAY_TICKS(1));
   osThreadTerminate(osThreadGetId());
 }
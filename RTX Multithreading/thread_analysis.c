@@ -1,13 +1,64 @@
 /* COE718 Lab 3a  ANALYSIS VERSION*/
 
 #include "cmsis_os.h"
+#include "periodic.h"
+#include "cyclic.h"
+#include "budget.h"
+#include "time_units.h"
+#include "trace.h"
+#include "workload.h"
+#include "rr_fair.h"
+#include "telem.h"
 #include <stdint.h>
 
-/* ===== RR proof knobs ===== */
+/* ===== Workload knobs ===== */
 #define ACTIVATIONS_PER_TASK   150u   /* keep all three alive ~few seconds */
-#define WORK_UNITS_PAINTER     28000u /* per-activation busy work */
-#define WORK_UNITS_MORSE       28000u
-#define WORK_UNITS_ROBOT       28000u
+#define WORK_PAINTER_US        2800u  /* per-activation load, calibrated */
+#define WORK_PAINTER_KIND      WL_SRAM
+#define WORK_MORSE_US          2800u  /* dash: +1/8 */
+#define WORK_MORSE_KIND        WL_FLASH
+#define WORK_ROBOT_US          2800u
+#define WORK_ROBOT_KIND        WL_BRANCH
+
+/* ===== Periodic timing (rate-monotonic priorities) =====
+   Each activation is 2.8 ms of work (3.15 ms for a dash), so
+   U = 2.8/10 + 3.15/20 + 2.8/25 = 0.55, under the 3-task RM bound 0.78. */
+#define PERIOD_PAINTER_MS      10u
+#define PERIOD_MORSE_MS        20u
+#define PERIOD_ROBOT_MS        25u
+#define WCET_PAINTER_US        3500u
+#define WCET_MORSE_US          4000u
+#define WCET_ROBOT_US          3500u
+TU_CHECK_MS(period_painter, PERIOD_PAINTER_MS);
+TU_CHECK_MS(period_morse,   PERIOD_MORSE_MS);
+TU_CHECK_MS(period_robot,   PERIOD_ROBOT_MS);
+
+/* ===== Cyclic executive instead of RM threads =====
+   1: run the jobs from the static table in cyclic_table.c, regenerated with
+      tools/cyclic_gen -o cyclic_table.c Painter:10:3500 Morse:20:4000 Robot:25:3500
+   Per-frame slack/overruns: g_ce_stat[], g_ce_overruns, g_ce_lost. */
+#ifndef ANALYSIS_CYCLIC
+# define ANALYSIS_CYCLIC       0
+#endif
+
+/* ===== CPU budgets =====
+   1: all three tasks round-robin at one priority (PT_RR), each limited to
+      its WCET_*_US per period; an overrunning task drops to osPriorityIdle
+      until replenished.  Per-thread use and overruns: g_bg[], g_bg_log[].
+   ROBOT_HOG_EVERY > 0 makes every n-th Robot job do 4x its work, to show
+   the peers keep their throughput (g_t1_acts, g_t2_acts, g_pt_task[]). */
+#ifndef ANALYSIS_BUDGET
+# define ANALYSIS_BUDGET       0
+#endif
+#ifndef ROBOT_HOG_EVERY
+# define ROBOT_HOG_EVERY       0u
+#endif
+
+/* ===== Fairness analyzer =====
+   g_t1/2/3_acts are sampled every tick by rr_fair.c; when all three reach
+   ACTIVATIONS_PER_TASK, g_rf holds Jain's index, throughput, worst lag and
+   completion tick per task (g_rf.done = 1).  Compare with the simulator:
+   tools/sched_sim -f rf.hex [-p rr|rm|edf]. */
 
 /* ===== Painter parameters ===== */
 #ifndef LCD_TOTAL_COLUMNS
@@ -38,122 +89,130 @@ volatile int8_t   g_robot_x    = 0, g_robot_y = 0;
 volatile uint32_t g_robot_wp_index = 0;
 volatile uint8_t  g_t1_done    = 0, g_t2_done = 0, g_t3_done = 0;
 
-/* ===== Threads ===== */
-void Thread_Painter (void const *argument);
-void Thread_Morse   (void const *argument);
-void Thread_Robot   (void const *argument);
-
-osThreadId tid_painter, tid_morse, tid_robot;
-osThreadDef(Thread_Painter, osPriorityNormal, 1, 0);
-osThreadDef(Thread_Morse,   osPriorityNormal, 1, 0);
-osThreadDef(Thread_Robot,   osPriorityNormal, 1, 0);
-
-static void do_busy_work(uint32_t units){
-  volatile uint32_t acc = 0u;
-  while (units--) {           
-    acc ^= units;
-    acc = (acc << 1) | (acc >> 31);
-  }
+/* ===== Periodic tasks: one job = one former loop iteration ===== */
+static void Job_Painter(void *ctx);
+static void Job_Morse  (void *ctx);
+static void Job_Robot  (void *ctx);
+
+static const pt_task_def_t analysis_tasks[] = {
+  /* name       job          ctx  period             deadline  wcet_us          prio        jobs */
+  { "Painter",  Job_Painter, 0,   PERIOD_PAINTER_MS, 0,        WCET_PAINTER_US, PT_PRIO_RM, ACTIVATIONS_PER_TASK },
+  { "Morse",    Job_Morse,   0,   PERIOD_MORSE_MS,   0,        WCET_MORSE_US,   PT_PRIO_RM, ACTIVATIONS_PER_TASK },
+  { "Robot",    Job_Robot,   0,   PERIOD_ROBOT_MS,   0,        WCET_ROBOT_US,   PT_PRIO_RM, ACTIVATIONS_PER_TASK },
+};
+#define N_TASKS  (sizeof(analysis_tasks) / sizeof(analysis_tasks[0]))
+
+#if ANALYSIS_CYCLIC
+/* same order as the tasks given to cyclic_gen */
+static const ce_job_fn_t analysis_jobs[] = { Job_Painter, Job_Morse, Job_Robot };
+#endif
+
+static int analysis_fair(void) {
+  if (rf_attach("Painter", &g_t1_acts, PERIOD_PAINTER_MS * 1000u, WORK_PAINTER_US, ACTIVATIONS_PER_TASK) < 0 ||
+      rf_attach("Morse",   &g_t2_acts, PERIOD_MORSE_MS * 1000u,
+                WORK_MORSE_US + (WORK_MORSE_US >> 3), ACTIVATIONS_PER_TASK) < 0 ||
+      rf_attach("Robot",   &g_t3_acts, PERIOD_ROBOT_MS * 1000u, WORK_ROBOT_US, ACTIVATIONS_PER_TASK) < 0) return -1;
+  return rf_start();
 }
 
 int Init_Thread(void) {
-  int ok = 1;
-  tid_painter = osThreadCreate(osThread(Thread_Painter), NULL); if (!tid_painter) ok = 0;
-  tid_morse   = osThreadCreate(osThread(Thread_Morse),   NULL); if (!tid_morse)   ok = 0;
-  tid_robot   = osThreadCreate(osThread(Thread_Robot),   NULL); if (!tid_robot)   ok = 0;
-  return ok ? 0 : -1;
+  trace_init();
+  if (analysis_fair() != 0) return -1;
+#if TELEMETRY
+  (void)tm_counter("painter", &g_t1_acts);
+  (void)tm_counter("morse",   &g_t2_acts);
+  (void)tm_counter("robot",   &g_t3_acts);
+#endif
+#if ANALYSIS_CYCLIC
+  {
+    /* enough major frames for the slowest task to reach ACTIVATIONS_PER_TASK */
+    uint32_t major_us = g_ce_table.minor_us * g_ce_table.frames;
+    uint32_t majors   = (ACTIVATIONS_PER_TASK * PERIOD_ROBOT_MS * 1000u + major_us - 1u) / major_us;
+    return ce_start(&g_ce_table, analysis_jobs, 0, N_TASKS, majors);
+  }
+#elif ANALYSIS_BUDGET
+  {
+    uint32_t i;
+    if (pt_start(analysis_tasks, N_TASKS, PT_RR) != 0 || bg_init() != 0) return -1;
+    for (i = 0; i < N_TASKS; ++i) {
+      if (bg_attach(g_pt_task[i].tid, analysis_tasks[i].wcet_us,
+                    analysis_tasks[i].period_ms * 1000u, BG_SUSPEND) < 0) return -1;
+    }
+    return 0;
+  }
+#else
+  return pt_start(analysis_tasks, N_TASKS, PT_RM);  /* per-job stats: g_pt_task[], g_pt_log[] */
+#endif
 }
 
 /* --------------- Task A: Slice-Programmable Painter --------------- */
-void Thread_Painter (void const *argument) {
-  uint32_t act = 0;
-  uint32_t col = 0;
-  (void)argument;
-
-  while (act < ACTIVATIONS_PER_TASK) {
-    uint32_t i;
-    g_active_tid = 1u;
+static void Job_Painter(void *ctx) {
+  static uint32_t col = 0;
+  uint32_t i;
+  (void)ctx;
 
-    /* mark a few columns per activation */
-    for (i = 0; i < 3u; ++i) {
-      g_t1_bitmap |= (1u << (col & 31u));
-      col++;
-    }
+  g_active_tid = 1u;
 
-    do_busy_work(WORK_UNITS_PAINTER);   /* keep READY; let RR do the preemption */
-    g_t1_acts++;
-    act++;
+  /* mark a few columns per activation */
+  for (i = 0; i < 3u; ++i) {
+    g_t1_bitmap |= (1u << (col & 31u));
+    col++;
   }
 
-  g_t1_done = 1u;
-  osThreadTerminate(osThreadGetId());
+  wl_run_us(WORK_PAINTER_KIND, WORK_PAINTER_US);   /* execution load of one job */
+  if (++g_t1_acts >= ACTIVATIONS_PER_TASK) g_t1_done = 1u;
 }
 
 /* -------------------- Task B: Morse TMU ------------------------- */
-void Thread_Morse (void const *argument) {
+static void Job_Morse(void *ctx) {
   const char *msg = MORSE_TMU;
-  uint32_t act = 0;
   uint32_t mlen = 0;
-  (void)argument;
+  char c;
+  (void)ctx;
 
-  /* compute length once */
   { const char *p = msg; while (*p) { mlen++; p++; } if (mlen == 0) mlen = 1; }
 
-  while (act < ACTIVATIONS_PER_TASK) {
-    char c;
-    g_active_tid = 2u;
+  g_active_tid = 2u;
 
-    c = msg[g_t2_idx];
-    g_t2_idx++;
-    if (g_t2_idx >= mlen) g_t2_idx = 0;
+  c = msg[g_t2_idx];
+  g_t2_idx++;
+  if (g_t2_idx >= mlen) g_t2_idx = 0;
 
-    if (c == '-')      do_busy_work(WORK_UNITS_MORSE + (WORK_UNITS_MORSE>>3));
-    else               do_busy_work(WORK_UNITS_MORSE);
+  if (c == '-')      wl_run_us(WORK_MORSE_KIND, WORK_MORSE_US + (WORK_MORSE_US>>3));
+  else               wl_run_us(WORK_MORSE_KIND, WORK_MORSE_US);
 
-    g_t2_acts++;
-    act++;
-  }
-
-  g_t2_done = 1u;
-  osThreadTerminate(osThreadGetId());
+  if (++g_t2_acts >= ACTIVATIONS_PER_TASK) g_t2_done = 1u;
 }
 
 /* --------------- Task C: Differential-Drive Waypoint Tracker ---------------- */
 static int8_t sgn_i8(int8_t v){ return (int8_t)((v > 0) - (v < 0)); }
 
-void Thread_Robot (void const *argument) {
-  uint32_t act = 0;
-  (void)argument;
-
-  g_robot_x = 0; g_robot_y = 0; g_robot_wp_index = 0;
-
-  while (act < ACTIVATIONS_PER_TASK) {
-    int8_t tx, ty, dx, dy;
+static void Job_Robot(void *ctx) {
+  int8_t tx, ty, dx, dy;
+  (void)ctx;
 
-    g_active_tid = 3u;
+  g_active_tid = 3u;
 
-    tx = WAYPOINTS[g_robot_wp_index % WP_COUNT].x;
-    ty = WAYPOINTS[g_robot_wp_index % WP_COUNT].y;
+  tx = WAYPOINTS[g_robot_wp_index % WP_COUNT].x;
+  ty = WAYPOINTS[g_robot_wp_index % WP_COUNT].y;
 
-    dx = (int8_t)(tx - g_robot_x);
-    dy = (int8_t)(ty - g_robot_y);
+  dx = (int8_t)(tx - g_robot_x);
+  dy = (int8_t)(ty - g_robot_y);
 
-    if (dx == 0 && dy == 0) {
-      g_robot_wp_index++; /* reached this waypoint; move to next (wraps) */
+  if (dx == 0 && dy == 0) {
+    g_robot_wp_index++; /* reached this waypoint; move to next (wraps) */
+  } else {
+    if ((int16_t)dx * (int16_t)dx >= (int16_t)dy * (int16_t)dy) {
+      g_robot_x = (int8_t)(g_robot_x + sgn_i8(dx));
     } else {
-      if ((int16_t)dx * (int16_t)dx >= (int16_t)dy * (int16_t)dy) {
-        g_robot_x = (int8_t)(g_robot_x + sgn_i8(dx));
-      } else {
-        g_robot_y = (int8_t)(g_robot_y + sgn_i8(dy));
-      }
+      g_robot_y = (int8_t)(g_robot_y + sgn_i8(dy));
     }
-
-    do_busy_work(WORK_UNITS_ROBOT);
-    g_t3_acts++;
-    act++;
   }
 
-  g_t3_done = 1u;
-  osThreadTerminate(osThreadGetId());
+#if ROBOT_HOG_EVERY
+  if ((g_t3_acts % ROBOT_HOG_EVERY) == ROBOT_HOG_EVERY - 1u) wl_run_us(WORK_ROBOT_KIND, 3u * WORK_ROBOT_US);
+#endif
+  wl_run_us(WORK_ROBOT_KIND, WORK_ROBOT_US);
+  if (++g_t3_acts >= ACTIVATIONS_PER_TASK) g_t3_done = 1u;
 }
 
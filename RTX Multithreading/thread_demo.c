@@ -2,13 +2,20 @@
 #include "cmsis_os.h"
 #include "LPC17xx.h"
 #include "GLCD.h"
+#include "blog.h"
+#include "time_units.h"
 #include <stdint.h>
 
-/* ====== 2-second window per thread (RTX tick = 5 ms) ====== */
-#ifndef RTX_TICK_US
-# define RTX_TICK_US         5000u
-#endif
-#define WINDOW_TICKS         400u   /* 400 * 5 ms = 2000 ms = 2 s */
+/* ====== 2-second window per thread ====== */
+#define WINDOW_MS            2000u
+#define WINDOW_TICKS         TU_MS_TO_TICKS(WINDOW_MS)
+TU_CHECK_MS(window, WINDOW_MS);
+
+/* Morse symbol timing (real time, whatever the kernel tick) */
+#define MORSE_DOT_MS         60u
+#define MORSE_DASH_MS        120u
+TU_CHECK_MS(morse_dot,  MORSE_DOT_MS);
+TU_CHECK_MS(morse_dash, MORSE_DASH_MS);
 
 /* ---------- Fallback waypoints ---------- */
 #ifndef WP_COUNT
@@ -51,16 +58,10 @@ static void lcd_line(unsigned int line, const char *txt){
   GLCD_DisplayString(line, 0, 1, buf);
 }
 static void lcd_title(const char *msg){ lcd_line(0, msg); }
-static void lcd_active_text(const char *tn){
-  /* prints "Active: <name>" padded */
-  static char tmp[32];
-  unsigned int i = 0;
-  const char *prefix = "Active: ";
-  while (prefix[i]) { tmp[i] = prefix[i]; i++; }
-  while (tn && *tn && i < sizeof(tmp)-1) { tmp[i++] = *tn++; }
-  tmp[i] = 0;
-  lcd_line(1, tmp);
-}
+
+/* status text goes through the binary log; BLOG_LCD renders it to a line */
+#define LN_ACTIVE   1u
+#define LN_STATUS   2u
 
 /* progress bar to line 3, exact width */
 static void lcd_bar_line3(unsigned int filled, unsigned int total){
@@ -78,9 +79,6 @@ static void lcd_bar_line3(unsigned int filled, unsigned int total){
   lcd_line(3, bar);
 }
 
-/* show small status on line 2, padded */
-static void lcd_status_line2(const char *txt){ lcd_line(2, txt); }
-
 /* plot dot for robot on text grid (lines 5..) */
 static void lcd_plot_dot(uint32_t ln, uint32_t col){
   if (col < LCD_W) {
@@ -133,18 +131,21 @@ int Init_Thread(void) {
 
   t1_done = t2_done = t3_done = 0;
 
+  blog_init();
+  blog_set_lcd_sink(lcd_line);
+
   lcd_title("Round-Robin Demo");
-  lcd_active_text("(waiting)");
-  lcd_status_line2("                   ");
+  BLOG0(LN_ACTIVE, BLOG_ACTIVE_WAITING);
+  lcd_line(LN_STATUS, "");
   lcd_bar_line3(0, 1);
 
   tid_painter = osThreadCreate(osThread(Thread_Painter), NULL);
   tid_morse   = osThreadCreate(osThread(Thread_Morse),   NULL);
   tid_robot   = osThreadCreate(osThread(Thread_Robot),   NULL);
 
-  if (!tid_painter) lcd_status_line2("ERR: T1 create");
-  if (!tid_morse)   lcd_status_line2("ERR: T2 create");
-  if (!tid_robot)   lcd_status_line2("ERR: T3 create");
+  if (!tid_painter) BLOG1(LN_STATUS, BLOG_ERR_CREATE_T, 1);
+  if (!tid_morse)   BLOG1(LN_STATUS, BLOG_ERR_CREATE_T, 2);
+  if (!tid_robot)   BLOG1(LN_STATUS, BLOG_ERR_CREATE_T, 3);
 
   if (tid_painter && tid_morse && tid_robot) {
     osSignalSet(tid_painter, SIG_TOKEN);   /* start with T1 */
@@ -177,28 +178,19 @@ void Thread_Painter (void const *argument) {
 
     if (painted >= LCD_TOTAL_COLUMNS) {
       t1_done = 1u;
-      lcd_status_line2("T1 Done");
+      BLOG1(LN_STATUS, BLOG_T_DONE, 1);
       pass_token_from(1u);
       osThreadTerminate(osThreadGetId());
     }
 
     /* do one chunk */
     {
-      uint32_t todo = per_activation, i;
-      char label[24];
+      uint32_t todo = per_activation;
       if (painted + todo > LCD_TOTAL_COLUMNS) todo = LCD_TOTAL_COLUMNS - painted;
 
       led_show(0);
-      lcd_active_text("T1");
-
-      {
-        unsigned int k = (painted + todo);
-        unsigned int N = LCD_TOTAL_COLUMNS;
-        label[0]='P';label[1]='a';label[2]='i';label[3]='n';label[4]='t';label[5]='e';label[6]='r';label[7]=':';label[8]=' ';
-        label[9]  = (char)('0' + ((k*10u)/N));
-        label[10] = (char)('/'); label[11]='1'; label[12]='0'; label[13]=0;
-      }
-      lcd_status_line2(label);
+      BLOG1(LN_ACTIVE, BLOG_ACTIVE_T, 1);
+      BLOG1(LN_STATUS, BLOG_PAINTER, ((painted + todo) * 10u) / LCD_TOTAL_COLUMNS);
 
       /* show bar progress */
       lcd_bar_line3(painted + todo, LCD_TOTAL_COLUMNS);
@@ -209,7 +201,7 @@ void Thread_Painter (void const *argument) {
     /* hold token ~2s */
     {
       uint32_t t;
-      for (t = 0; t < WINDOW_TICKS; t++) { osDelay(1); }
+      for (t = 0; t < WINDOW_TICKS; t++) { osDelay(TU_DELAY_TICKS(1)); }
     }
 
     pass_token_from(1u);
@@ -221,9 +213,9 @@ void Thread_Painter (void const *argument) {
    One symbol per 2-second window;
    ========================================================= */
 static void morse_symbol_consume(char c){
-  if (c == '.')      osDelay(12);  /* ~60 ms */
-  else if (c == '-') osDelay(24);  /* ~120 ms */
-  else               osDelay(12);
+  if (c == '.')      osDelay(TU_DELAY_MS(MORSE_DOT_MS));
+  else if (c == '-') osDelay(TU_DELAY_MS(MORSE_DASH_MS));
+  else               osDelay(TU_DELAY_MS(MORSE_DOT_MS));
 }
 static unsigned int morse_len(const char *s){
   unsigned int n=0; while (s && s[n]) n++; return n;
@@ -242,31 +234,15 @@ void Thread_Morse (void const *argument) {
 
     if (idx >= total) {
       t2_done = 1u;
-      lcd_status_line2("T2 Done");
+      BLOG1(LN_STATUS, BLOG_T_DONE, 2);
       pass_token_from(2u);
       osThreadTerminate(osThreadGetId());
     }
 
     led_show(1);
-    lcd_active_text("T2");
-
-    {
-      char l2[32];
-      const char *kind = (p[idx]=='.') ? "dot" : (p[idx]=='-') ? "dash" : "gap";
-      l2[0]='M';l2[1]='o';l2[2]='r';l2[3]='s';l2[4]='e';l2[5]=':';l2[6]=' ';l2[7]=0;
-      {
-        unsigned int j=7, k=0;
-        while (kind[k] && j<31){ l2[j++] = kind[k++]; }
-        l2[j++]=' '; l2[j++]='(';
-        l2[j++] = (char)('0' + ((idx+1)/10u));
-        l2[j++] = (char)('0' + ((idx+1)%10u));
-        l2[j++] = '/';
-        l2[j++] = (char)('0' + (total/10u));
-        l2[j++] = (char)('0' + (total%10u));
-        l2[j++]=')'; l2[j]=0;
-      }
-      lcd_status_line2(l2);
-    }
+    BLOG1(LN_ACTIVE, BLOG_ACTIVE_T, 2);
+    BLOG2(LN_STATUS, (p[idx]=='.') ? BLOG_MORSE_DOT : (p[idx]=='-') ? BLOG_MORSE_DASH : BLOG_MORSE_GAP,
+          idx + 1u, total);
 
     /* line 3: progress bar over total symbols */
     lcd_bar_line3(idx+1, total);
@@ -277,7 +253,7 @@ void Thread_Morse (void const *argument) {
     /* hold token ~2s */
     {
       uint32_t t;
-      for (t = 0; t < WINDOW_TICKS; t++) { osDelay(1); }
+      for (t = 0; t < WINDOW_TICKS; t++) { osDelay(TU_DELAY_TICKS(1)); }
     }
 
     pass_token_from(2u);
@@ -297,13 +273,13 @@ void Thread_Robot (void const *argument) {
 
     if (i >= WP_COUNT) {
       t3_done = 1u;
-      lcd_status_line2("T3 Done");
+      BLOG1(LN_STATUS, BLOG_T_DONE, 3);
       pass_token_from(3u);
       osThreadTerminate(osThreadGetId());
     }
 
     led_show(2);
-    lcd_active_text("T3");
+    BLOG1(LN_ACTIVE, BLOG_ACTIVE_T, 3);
 
     /* one step toward current waypoint */
     {
@@ -317,35 +293,8 @@ void Thread_Robot (void const *argument) {
         else                    y = (int8_t)(y + sgn(dy));
       }
 
-      {
-        char l2[32];
-        int xi = (int)x, yi = (int)y;
-        l2[0]='R';l2[1]='o';l2[2]='b';l2[3]='o';l2[4]='t';l2[5]=':';l2[6]=' ';l2[7]=0;
-        {
-          unsigned int j=7;
-          l2[j++]='(';
-          if (xi<0){ l2[j++]='-'; xi=-xi; }
-          l2[j++] = (char)('0' + (xi/10)%10);
-          l2[j++] = (char)('0' + (xi%10));
-          l2[j++]=','; l2[j++]=' ';
-          if (yi<0){ l2[j++]='-'; yi=-yi; }
-          l2[j++] = (char)('0' + (yi/10)%10);
-          l2[j++] = (char)('0' + (yi%10));
-          l2[j++]=')'; l2[j++]=' ';
-          /* "i/N" */
-          {
-            unsigned int ii = (i<100)? i:99;
-            unsigned int NN = (WP_COUNT<100)? WP_COUNT:99;
-            l2[j++] = (char)('0' + (ii/10));
-            l2[j++] = (char)('0' + (ii%10));
-            l2[j++] = '/';
-            l2[j++] = (char)('0' + (NN/10));
-            l2[j++] = (char)('0' + (NN%10));
-            l2[j]=0;
-          }
-        }
-        lcd_status_line2(l2);
-      }
+      BLOG4(LN_STATUS, BLOG_ROBOT, (int32_t)x, (int32_t)y,
+            (i < 100u) ? i : 99u, (WP_COUNT < 100u) ? WP_COUNT : 99u);
 
       /* plot dot for current pose */
       lcd_plot_dot((uint32_t)((y >= 0) ? y : 0), (uint32_t)((x >= 0) ? x : 0));
@@ -357,7 +306,7 @@ void Thread_Robot (void const *argument) {
     /* hold token ~2s */
     {
       uint32_t t;
-      for (t = 0; t < WINDOW_TICKS; t++) { osDelay(1); }
+      for (t = 0; t < WINDOW_TICKS; t++) { osDelay(TU_DELAY_TICKS(1)); }
     }
 
     pass_token_from(3u);
@@ -0,0 +1,82 @@
+/* COE718 Lab 3a - compile-time tick / time-unit layer
+ *
+ * RTX converts every osDelay()/osSignalWait()/osTimerStart() argument with
+ * its *configured* tick, OS_TICK us, but the SysTick reload it programs is
+ * OS_CLOCK * OS_TICK / 1e6 cycles of the *real* core clock. This project
+ * sets OS_CLOCK = 10 MHz while system_LPC17xx.c runs the core at 100 MHz,
+ * so the kernel believes in a 50 ms tick and the hardware ticks every 5 ms.
+ *
+ *   TU_TICK_US          real tick period in microseconds
+ *   TU_MS_TO_TICKS(ms)  real duration -> ticks (rounded up)
+ *   TU_DELAY_MS(ms)     real duration -> argument for osDelay() & co.
+ *   TU_DELAY_TICKS(t)   whole ticks   -> argument for osDelay() & co.
+ *   TU_CHECK_MS(n, ms)  file-scope static assert: ms is a whole number of
+ *                       ticks and fits the kernel's 16-bit delay counter
+ *
+ * The TU_* mirrors below must match RTX_Conf_CM.c and system_LPC17xx.c;
+ * both files include this header and fail to compile if they do not.
+ */
+#pragma once
+#include <stdint.h>
+
+/* ------------------- Mirrors of the clock configuration ------------------- */
+#define TU_XTAL_HZ        12000000uL    /* system_LPC17xx.c: XTAL */
+#define TU_CLKSRCSEL      0x00000001uL  /* system_LPC17xx.c: CLKSRCSEL_Val (main osc) */
+#define TU_PLL0CFG        0x00050063uL  /* system_LPC17xx.c: PLL0CFG_Val */
+#define TU_CCLKCFG        0x00000003uL  /* system_LPC17xx.c: CCLKCFG_Val */
+#define TU_OS_CLOCK       10000000uL    /* RTX_Conf_CM.c: OS_CLOCK */
+#define TU_OS_TICK        50000uL       /* RTX_Conf_CM.c: OS_TICK [us] */
+#define TU_PCLKSEL0       0x00000000uL  /* system_LPC17xx.c: PCLKSEL0_Val */
+#define TU_PCLKSEL1       0x00000000uL  /* system_LPC17xx.c: PCLKSEL1_Val */
+
+#define TU_STATIC_ASSERT(name, cond)  typedef char tu_assert_##name[(cond) ? 1 : -1]
+
+/* ------------------- Derived clocks ------------------- */
+#define TU_PLL_M          ((TU_PLL0CFG & 0x7FFFuL) + 1uL)
+#define TU_PLL_N          (((TU_PLL0CFG >> 16) & 0xFFuL) + 1uL)
+/* Fcco = 2 * M * Fin / N, cclk = Fcco / (CCLKSEL + 1) */
+#define TU_CCLK_HZ        (((TU_XTAL_HZ / TU_PLL_N) * 2uL * TU_PLL_M) / (TU_CCLKCFG + 1uL))
+#define TU_CYCLES_PER_US  (TU_CCLK_HZ / 1000000uL)
+
+/* peripheral clock: PCLKSEL field 0..3 -> cclk / 4, 1, 2, 8 */
+#define TU_PCLK_DIV(sel)  ((sel) == 0uL ? 4uL : (sel) == 1uL ? 1uL : (sel) == 2uL ? 2uL : 8uL)
+#define TU_TIMER0_HZ      (TU_CCLK_HZ / TU_PCLK_DIV((TU_PCLKSEL0 >> 2) & 3uL))
+#define TU_TIMER1_HZ      (TU_CCLK_HZ / TU_PCLK_DIV((TU_PCLKSEL0 >> 4) & 3uL))
+#define TU_TIMER2_HZ      (TU_CCLK_HZ / TU_PCLK_DIV((TU_PCLKSEL1 >> 12) & 3uL))
+#define TU_TIMER3_HZ      (TU_CCLK_HZ / TU_PCLK_DIV((TU_PCLKSEL1 >> 14) & 3uL))
+#define TU_UART0_HZ       (TU_CCLK_HZ / TU_PCLK_DIV((TU_PCLKSEL0 >> 6) & 3uL))
+
+/* SysTick reload as RTX computes it, in real core cycles */
+#define TU_TICK_CYCLES    ((TU_OS_CLOCK / 1000uL) * (TU_OS_TICK / 1000uL))
+#define TU_TICK_US        (TU_TICK_CYCLES / TU_CYCLES_PER_US)
+
+/* kernel milliseconds the CMSIS wrapper counts per tick */
+#define TU_KMS_PER_TICK   (TU_OS_TICK / 1000uL)
+#define TU_MAX_TICKS      0xFFFEuL      /* rt_ms2tick() clamps above this */
+
+/* ------------------- Conversions (constant expressions) ------------------- */
+#define TU_US_TO_TICKS(us)  (((us) + TU_TICK_US - 1uL) / TU_TICK_US)
+#define TU_MS_TO_TICKS(ms)  TU_US_TO_TICKS((ms) * 1000uL)
+#define TU_TICKS_TO_US(t)   ((t) * TU_TICK_US)
+#define TU_TICKS_TO_MS(t)   (((t) * TU_TICK_US) / 1000uL)
+
+#define TU_DELAY_TICKS(t)   ((uint32_t)((t) * TU_KMS_PER_TICK))
+#define TU_DELAY_MS(ms)     TU_DELAY_TICKS(TU_MS_TO_TICKS(ms))
+#define TU_DELAY_US(us)     TU_DELAY_TICKS(TU_US_TO_TICKS(us))
+
+#define TU_CHECK_MS(name, ms)                                             \
+  TU_STATIC_ASSERT(name##_whole_ticks, ((ms) * 1000uL) % TU_TICK_US == 0uL); \
+  TU_STATIC_ASSERT(name##_in_range,                                       \
+                   (ms) > 0uL && TU_MS_TO_TICKS(ms) <= TU_MAX_TICKS)
+
+/* ------------------- Configuration sanity ------------------- */
+TU_STATIC_ASSERT(main_osc,        TU_CLKSRCSEL == 1uL);
+TU_STATIC_ASSERT(pll_in_exact,    TU_XTAL_HZ % TU_PLL_N == 0uL);
+TU_STATIC_ASSERT(fcco_range,      (TU_XTAL_HZ / TU_PLL_N) * 2uL * TU_PLL_M >= 275000000uL &&
+                                  (TU_XTAL_HZ / TU_PLL_N) * 2uL * TU_PLL_M <= 550000000uL);
+TU_STATIC_ASSERT(cclk_whole_mhz,  TU_CCLK_HZ % 1000000uL == 0uL);
+TU_STATIC_ASSERT(os_clock_khz,    TU_OS_CLOCK % 1000uL == 0uL);
+/* osDelay() takes milliseconds: a tick must be a whole kernel ms */
+TU_STATIC_ASSERT(os_tick_ms,      TU_OS_TICK % 1000uL == 0uL);
+TU_STATIC_ASSERT(tick_whole_us,   TU_TICK_CYCLES % TU_CYCLES_PER_US == 0uL);
+TU_STATIC_ASSERT(systick_24bit,   TU_TICK_CYCLES - 1uL <= 0xFFFFFFuL);
@@ -0,0 +1,56 @@
+/* COE718 Lab 3a - host decoder for the binary log ring (blog.h)
+ *
+ * Build:  cc -std=c99 -O2 -DBLOG_HOST -I.. -o blog_decode blog_decode.c ../blog_fmt.c
+ * Usage:  blog_decode [-c core_hz] dump.{hex,bin}
+ *
+ * The dump is g_blog saved from the debugger, either as Intel HEX (uVision
+ * SAVE) or as a raw binary image starting at &g_blog.  Records are printed
+ * oldest first with their timestamp, LCD line and reconstructed text.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "blog.h"
+#include "dump_image.h"
+
+int main(int argc, char **argv)
+{
+  double hz = 100e6;
+  const char *path = NULL;
+  uint8_t *img;
+  size_t len = 0;
+  uint32_t slots, rsz, head, first, k;
+  int i;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-c") && i + 1 < argc) hz = atof(argv[++i]);
+    else path = argv[i];
+  }
+  if (!path) { fprintf(stderr, "usage: %s [-c core_hz] dump.{hex,bin}\n", argv[0]); return 2; }
+  img = load_dump(path, &len);
+  if (!img || len < 16 || rd32(img) != BLOG_MAGIC) { fprintf(stderr, "%s: not a blog ring dump\n", path); return 1; }
+
+  slots = rd32(img + 4);
+  rsz   = rd32(img + 8);
+  head  = rd32(img + 12);
+  if (rsz < 24 || 16 + (size_t)slots * rsz > len) { fprintf(stderr, "%s: truncated dump\n", path); return 1; }
+
+  first = (head > slots) ? head - slots : 0;
+  printf("# %u records emitted, %u kept\n", head, head - first);
+  for (k = first; k < head; ++k) {
+    const uint8_t *p = img + 16 + (size_t)(k % slots) * rsz;
+    blog_rec_t r;
+    char txt[128];
+    unsigned a;
+    r.ts = rd32(p);
+    r.id = rd16(p + 4);
+    r.lcd_line = p[6];
+    r.nargs = p[7];
+    for (a = 0; a < BLOG_MAX_ARGS; ++a) r.arg[a] = rd32(p + 8 + 4 * a);
+    blog_format(txt, sizeof txt, &r);
+    if (r.lcd_line == BLOG_NO_LCD) printf("%6u %12.1f us  --  %s\n", k, r.ts / hz * 1e6, txt);
+    else                           printf("%6u %12.1f us  L%u  %s\n", k, r.ts / hz * 1e6, r.lcd_line, txt);
+  }
+  free(img);
+  return 0;
+}
@@ -0,0 +1,234 @@
+/* COE718 Lab 3a - offline schedule table generator for cyclic.h
+ *
+ * Build:  cc -std=c99 -O2 -o cyclic_gen cyclic_gen.c
+ * Usage:  cyclic_gen [-k cycles_per_unit] [-c core_mhz] [-f minor_us] [-o out.c]
+ *                    name:period_ms:wcet[:deadline_ms] ...
+ *
+ * wcet is in microseconds, or in busy-work units with a 'u' suffix
+ * (28000u = do_busy_work(28000), -k cycles per unit, default 10, at -c MHz,
+ * default 100).  The major frame is the lcm of the periods.  The minor frame
+ * is the largest divisor of it that holds the longest job, satisfies
+ * 2f - gcd(f, T) <= D for every task (a full frame between release and
+ * deadline) and gives at most MAX_FRAMES frames, unless -f forces one.
+ * Jobs are then placed earliest deadline first into the earliest frame
+ * that starts after their release, ends before their deadline and still
+ * has room; jobs are never split across frames.  If that fails the next
+ * smaller frame is tried.
+ *
+ * The output is the C source of g_ce_table (cyclic_table.c); a frame
+ * summary goes to stderr.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_TASKS    8          /* cyclic.h: CE_MAX_TASKS */
+#define MAX_FRAMES   64         /* cyclic.h: CE_MAX_FRAMES */
+#define MAX_JOBS     4096
+
+typedef struct {
+  char     name[32];
+  uint64_t T, D, C;             /* us */
+} task_t;
+
+typedef struct {
+  uint64_t rel, dl;
+  int      task;
+  int      frame;
+} job_t;
+
+static task_t   task[MAX_TASKS];
+static int      n_tasks;
+static job_t    job[MAX_JOBS];
+static int      n_jobs;
+static uint64_t used[MAX_FRAMES];
+
+static uint64_t gcd_u64(uint64_t a, uint64_t b)
+{
+  while (b) { uint64_t r = a % b; a = b; b = r; }
+  return a;
+}
+
+/* ------------------- Input ------------------- */
+static int parse_task(const char *arg, double us_per_unit, task_t *t)
+{
+  char buf[128], *name, *per, *wcet, *dl, *end;
+  double w;
+
+  if (strlen(arg) >= sizeof buf) return -1;
+  strcpy(buf, arg);
+  name = strtok(buf, ":");
+  per  = strtok(NULL, ":");
+  wcet = strtok(NULL, ":");
+  dl   = strtok(NULL, ":");
+  if (!name || !per || !wcet || strlen(name) >= sizeof t->name) return -1;
+
+  strcpy(t->name, name);
+  t->T = strtoull(per, &end, 0) * 1000u;
+  if (*end || t->T == 0u) return -1;
+  w = strtod(wcet, &end);
+  if (*end == 'u' && end[1] == '\0') w *= us_per_unit;
+  else if (*end) return -1;
+  t->C = (uint64_t)(w + 0.999);
+  t->D = dl ? strtoull(dl, &end, 0) * 1000u : t->T;
+  if ((dl && *end) || t->C == 0u || t->D == 0u || t->D > t->T || t->C > t->D) return -1;
+  return 0;
+}
+
+/* ------------------- Frame search ------------------- */
+static int frame_ok(uint64_t f, uint64_t H, uint64_t cmax)
+{
+  int i;
+  if (H % f || f < cmax || H / f > MAX_FRAMES) return 0;
+  for (i = 0; i < n_tasks; ++i) {
+    if (2u * f - gcd_u64(f, task[i].T) > task[i].D) return 0;
+  }
+  return 1;
+}
+
+static int by_deadline(const void *a, const void *b)
+{
+  const job_t *x = a, *y = b;
+  if (x->dl != y->dl)   return x->dl < y->dl ? -1 : 1;
+  if (x->rel != y->rel) return x->rel < y->rel ? -1 : 1;
+  return x->task - y->task;
+}
+
+static int place(uint64_t f, uint64_t H)
+{
+  int i, j, frames = (int)(H / f);
+
+  memset(used, 0, sizeof used);
+  for (i = 0; i < n_jobs; ++i) {
+    job_t *jb = &job[i];
+    uint64_t c = task[jb->task].C;
+    jb->frame = -1;
+    for (j = (int)((jb->rel + f - 1u) / f); j < frames && (uint64_t)(j + 1) * f <= jb->dl; ++j) {
+      if (used[j] + c <= f) { used[j] += c; jb->frame = j; break; }
+    }
+    if (jb->frame < 0) return -1;
+  }
+  return 0;
+}
+
+/* ------------------- Output ------------------- */
+static void emit(FILE *o, int argc, char **argv, uint64_t f, uint64_t H)
+{
+  int frames = (int)(H / f), i, j, k, first = 0;
+  uint64_t load = 0;
+
+  for (i = 0; i < n_tasks; ++i) load += task[i].C * (H / task[i].T);
+
+  fprintf(o, "/* COE718 Lab 3a - cyclic executive schedule table\n *\n");
+  fprintf(o, " * Generated by tools/cyclic_gen.c, do not edit:\n *  ");
+  for (i = 0; i < argc; ++i) fprintf(o, " %s", i ? argv[i] : "cyclic_gen");
+  fprintf(o, "\n *\n * major %llu us, minor %llu us, %d frames, planned load %.1f %%\n */\n",
+          (unsigned long long)H, (unsigned long long)f, frames, 100.0 * (double)load / (double)H);
+  fprintf(o, "#include \"cyclic.h\"\n\n");
+
+  fprintf(o, "static const ce_task_info_t ce_tasks[%d] = {\n", n_tasks);
+  for (i = 0; i < n_tasks; ++i)
+    fprintf(o, "  { \"%s\", %lluu, %lluu },\n", task[i].name,
+            (unsigned long long)task[i].T, (unsigned long long)task[i].C);
+  fprintf(o, "};\n\n");
+
+  fprintf(o, "static const uint8_t ce_entry[%d] = {\n", n_jobs);
+  for (j = 0; j < frames; ++j) {
+    fprintf(o, "  /* %2d */", j);
+    for (k = 0; k < n_jobs; ++k) if (job[k].frame == j) fprintf(o, " %d,", job[k].task);
+    fprintf(o, "\n");
+  }
+  fprintf(o, "};\n\n");
+
+  fprintf(o, "static const uint16_t ce_first[%d] = {", frames + 1);
+  for (j = 0; j < frames; ++j) {
+    fprintf(o, "%s%d,", (j % 12) ? " " : "\n  ", first);
+    for (k = 0; k < n_jobs; ++k) first += job[k].frame == j;
+  }
+  fprintf(o, " %d\n};\n\n", first);
+
+  fprintf(o, "static const uint32_t ce_planned_us[%d] = {", frames);
+  for (j = 0; j < frames; ++j)
+    fprintf(o, "%s%lluu,", (j % 8) ? " " : "\n  ", (unsigned long long)used[j]);
+  fprintf(o, "\n};\n\n");
+
+  fprintf(o, "const ce_table_t g_ce_table = {\n");
+  fprintf(o, "  %lluu, %du, %du, ce_tasks, ce_first, ce_entry, ce_planned_us\n};\n",
+          (unsigned long long)f, frames, n_tasks);
+}
+
+static void summary(uint64_t f, uint64_t H)
+{
+  int j, k, frames = (int)(H / f);
+  fprintf(stderr, "major %llu us, minor %llu us, %d frames\n",
+          (unsigned long long)H, (unsigned long long)f, frames);
+  for (j = 0; j < frames; ++j) {
+    fprintf(stderr, "  frame %2d  load %6llu us  slack %6llu us :", j,
+            (unsigned long long)used[j], (unsigned long long)(f - used[j]));
+    for (k = 0; k < n_jobs; ++k) if (job[k].frame == j) fprintf(stderr, " %s", task[job[k].task].name);
+    fprintf(stderr, "\n");
+  }
+}
+
+static int usage(const char *prog)
+{
+  fprintf(stderr, "usage: %s [-k cycles_per_unit] [-c core_mhz] [-f minor_us] [-o out.c]\n"
+                  "          name:period_ms:wcet[u][:deadline_ms] ...\n", prog);
+  return 2;
+}
+
+int main(int argc, char **argv)
+{
+  double   cyc_per_unit = 10.0, core_mhz = 100.0;
+  uint64_t H = 1u, f, force = 0u, cmax = 0u, dmin = UINT64_MAX;
+  const char *out = NULL;
+  FILE *o = stdout;
+  int i, k;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; ++i) {
+    if (i + 1 >= argc) return usage(argv[0]);
+    if (!strcmp(argv[i], "-k"))      cyc_per_unit = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-c")) core_mhz     = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-f")) force        = strtoull(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-o")) out          = argv[++i];
+    else return usage(argv[0]);
+  }
+  if (i == argc || core_mhz <= 0.0) return usage(argv[0]);
+
+  for (; i < argc; ++i) {
+    if (n_tasks == MAX_TASKS) { fprintf(stderr, "at most %d tasks\n", MAX_TASKS); return 2; }
+    if (parse_task(argv[i], cyc_per_unit / core_mhz, &task[n_tasks])) {
+      fprintf(stderr, "bad task '%s'\n", argv[i]);
+      return 2;
+    }
+    H = H / gcd_u64(H, task[n_tasks].T) * task[n_tasks].T;
+    if (task[n_tasks].C > cmax) cmax = task[n_tasks].C;
+    if (task[n_tasks].D < dmin) dmin = task[n_tasks].D;
+    n_tasks++;
+  }
+
+  for (i = 0; i < n_tasks; ++i) {
+    for (k = 0; (uint64_t)k < H / task[i].T; ++k) {
+      if (n_jobs == MAX_JOBS) { fprintf(stderr, "major frame too long\n"); return 1; }
+      job[n_jobs].rel  = (uint64_t)k * task[i].T;
+      job[n_jobs].dl   = job[n_jobs].rel + task[i].D;
+      job[n_jobs].task = i;
+      n_jobs++;
+    }
+  }
+  qsort(job, (size_t)n_jobs, sizeof job[0], by_deadline);
+
+  for (f = force ? force : dmin; f >= 1u; --f) {
+    if (force && f != force) break;
+    if (!frame_ok(f, H, cmax) || place(f, H)) continue;
+
+    if (out && !(o = fopen(out, "w"))) { perror(out); return 1; }
+    emit(o, argc, argv, f, H);
+    if (o != stdout) fclose(o);
+    summary(f, H);
+    return 0;
+  }
+  fprintf(stderr, "no feasible minor frame\n");
+  return 1;
+}
@@ -0,0 +1,89 @@
+/* COE718 Lab 3a - debugger dump loader for the host tools
+ *
+ * A RAM dump is either Intel HEX (uVision SAVE) or a raw binary image;
+ * load_dump() tells them apart by the leading ':' and returns a flat,
+ * malloc'ed image based at the lowest address saved.  Header-only so each
+ * tool stays a single cc command.
+ */
+#pragma once
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+static inline uint32_t rd32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static inline uint16_t rd16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+static inline int hexval(int c)
+{
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+/* Intel HEX -> flat image based at the lowest data address */
+static inline uint8_t *load_ihex(FILE *f, size_t *len)
+{
+  char line[600];
+  uint32_t upper = 0, base = 0xFFFFFFFFu, top = 0;
+  uint8_t *img = NULL;
+  int pass;
+
+  for (pass = 0; pass < 2; ++pass) {
+    rewind(f);
+    upper = 0;
+    while (fgets(line, sizeof line, f)) {
+      int n, type, i;
+      uint32_t addr;
+      if (line[0] != ':' || strlen(line) < 11) continue;
+      n    = hexval(line[1]) << 4 | hexval(line[2]);
+      addr = (uint32_t)(hexval(line[3]) << 12 | hexval(line[4]) << 8 | hexval(line[5]) << 4 | hexval(line[6]));
+      type = hexval(line[7]) << 4 | hexval(line[8]);
+      if (type == 4) { upper = (uint32_t)(hexval(line[9]) << 12 | hexval(line[10]) << 8 | hexval(line[11]) << 4 | hexval(line[12])) << 16; continue; }
+      if (type == 1) break;
+      if (type != 0) continue;
+      addr |= upper;
+      if (pass == 0) {
+        if (addr < base) base = addr;
+        if (addr + (uint32_t)n > top) top = addr + (uint32_t)n;
+      } else {
+        for (i = 0; i < n; ++i)
+          img[addr - base + (uint32_t)i] = (uint8_t)(hexval(line[9 + 2 * i]) << 4 | hexval(line[10 + 2 * i]));
+      }
+    }
+    if (pass == 0) {
+      if (top <= base) return NULL;
+      *len = top - base;
+      img = calloc(1, *len);
+      if (!img) return NULL;
+    }
+  }
+  return img;
+}
+
+static inline uint8_t *load_bin(FILE *f, size_t *len)
+{
+  uint8_t *img;
+  long n;
+  fseek(f, 0, SEEK_END);
+  n = ftell(f);
+  rewind(f);
+  if (n <= 0 || !(img = malloc((size_t)n))) return NULL;
+  *len = fread(img, 1, (size_t)n, f);
+  return img;
+}
+
+static inline uint8_t *load_dump(const char *path, size_t *len)
+{
+  uint8_t *img;
+  FILE *f;
+  int c;
+
+  if (!(f = fopen(path, "rb"))) { perror(path); return NULL; }
+  c = fgetc(f);
+  rewind(f);
+  img = (c == ':') ? load_ihex(f, len) : load_bin(f, len);
+  fclose(f);
+  return img;
+}
@@ -0,0 +1,259 @@
+/* COE718 Lab 3a - build-time font subsetting for font_subset.h
+ *
+ * Build:  cc -std=c99 -O2 -I.. -o font_gen font_gen.c
+ * Usage:  font_gen [-a chars] [-o font_subset.c] source...
+ *
+ * Collects every character the given sources can put on the LCD: the
+ * contents of string and character literals, outside comments and
+ * #include lines, with C escapes decoded.  Inside strings, printf-style
+ * conversions stand for what they can print: %u the digits, %d the
+ * digits and '-', %X/%x the hex digits, %% a '%'; %c and %s cannot be
+ * known here and are reported, add their characters with -a (C escapes
+ * allowed, e.g. -a '\x8D').  ' ' (GLCD_ClearLn) and FONT_FALLBACK are
+ * always kept, the fallback in slot 0.
+ *
+ * Writes font_subset.c with the glyphs copied from Font_6x8_h.h and
+ * Font_16x24_h.h and the slot map; the glyph list and the flash saved
+ * go to its header comment and to stderr.  The 16x24 glyphs are written
+ * twice, raw and as glcd_rle.h streams with their offsets, and FONT_RLE
+ * picks one at compile time; every stream is decoded back and compared
+ * before the file is written.  The 6x8 glyphs stay raw: at 8 bytes a
+ * glyph the offset table alone costs more than coding saves.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "font_subset.h"
+#include "Font_6x8_h.h"
+#include "Font_16x24_h.h"
+#include "rle_codec.h"
+
+#define G24_PIX          (16u * 24u)
+
+static uint8_t used[256];
+static int     warnings;
+
+static void use(unsigned c) { used[c & 0xFFu] = 1u; }
+
+static void use_range(const char *s) { while (*s) use((unsigned char)*s++); }
+
+/* one C escape after the backslash; *p advanced past it */
+static unsigned unescape(const char **p)
+{
+  const char *s = *p;
+  unsigned v = 0;
+  int n;
+
+  switch (*s) {
+    case 'n': *p = s + 1; return '\n';
+    case 't': *p = s + 1; return '\t';
+    case 'r': *p = s + 1; return '\r';
+    case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7':
+      for (n = 0; n < 3 && *s >= '0' && *s <= '7'; ++n) v = v * 8u + (unsigned)(*s++ - '0');
+      *p = s;
+      return v;
+    case 'x':
+      for (++s; (*s >= '0' && *s <= '9') || (*s >= 'a' && *s <= 'f') || (*s >= 'A' && *s <= 'F'); ++s)
+        v = v * 16u + (unsigned)(*s <= '9' ? *s - '0' : (*s | 0x20) - 'a' + 10);
+      *p = s;
+      return v;
+    default:  *p = s + 1; return (unsigned char)*s;
+  }
+}
+
+/* literal body from s to the closing quote q; returns past it */
+static const char *literal(const char *s, char q, const char *file, int line)
+{
+  char buf[1024];
+  size_t n = 0, i;
+
+  while (*s && *s != q && *s != '\n') {
+    unsigned c = (*s == '\\') ? (++s, unescape(&s)) : (unsigned char)*s++;
+    if (n < sizeof buf - 1u) buf[n++] = (char)c;
+  }
+  buf[n] = '\0';
+  if (q == '\'') { for (i = 0; i < n; ++i) use((unsigned char)buf[i]); return *s ? s + 1 : s; }
+
+  for (i = 0; i < n; ++i) {
+    size_t j = i + 1;
+    if (buf[i] != '%') { use((unsigned char)buf[i]); continue; }
+    while (j < n && strchr("0123456789-+ #.lh", buf[j])) ++j;     /* flags, width, length */
+    if (j >= n) { use('%'); continue; }
+    switch (buf[j]) {
+      case '%': use('%'); break;
+      case 'u': use_range("0123456789"); break;
+      case 'd': case 'i': use_range("-0123456789"); break;
+      case 'X': use_range("0123456789ABCDEF"); break;
+      case 'x': use_range("0123456789abcdef"); break;
+      case 'c': case 's':
+        fprintf(stderr, "%s:%d: %%%c in \"%s\": add its characters with -a\n", file, line, buf[j], buf);
+        warnings++;
+        break;
+      default:  use('%'); continue;                               /* not a conversion */
+    }
+    i = j;
+  }
+  return *s ? s + 1 : s;
+}
+
+static int scan(const char *path)
+{
+  long len;
+  char *text;
+  const char *s;
+  int line = 1, bol = 1;
+  FILE *f = fopen(path, "rb");
+
+  if (!f) { perror(path); return -1; }
+  fseek(f, 0, SEEK_END);
+  len = ftell(f);
+  rewind(f);
+  text = malloc((size_t)len + 1u);
+  if (!text || fread(text, 1, (size_t)len, f) != (size_t)len) { fclose(f); return -1; }
+  fclose(f);
+  text[len] = '\0';
+
+  for (s = text; *s; ) {
+    if (*s == '\n') { ++line; bol = 1; ++s; continue; }
+    if (*s == ' ' || *s == '\t' || *s == '\r') { ++s; continue; }
+    if (bol && *s == '#') {                                       /* skip #include "x" */
+      const char *t = s + 1;
+      while (*t == ' ' || *t == '\t') ++t;
+      if (!strncmp(t, "include", 7)) { while (*s && *s != '\n') ++s; continue; }
+    }
+    bol = 0;
+    if (s[0] == '/' && s[1] == '/') { while (*s && *s != '\n') ++s; continue; }
+    if (s[0] == '/' && s[1] == '*') {
+      for (s += 2; *s && !(s[0] == '*' && s[1] == '/'); ++s) if (*s == '\n') ++line;
+      if (*s) s += 2;
+      continue;
+    }
+    if (*s == '"' || *s == '\'') { s = literal(s + 1, *s, path, line); continue; }
+    ++s;
+  }
+  free(text);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  const char *out = "font_subset.c";
+  uint8_t map[FONT_CHARS], order[FONT_CHARS];
+  unsigned c, n = 0, k;
+  size_t full, sub, sub_rle, rle_len = 0;
+  uint16_t off[FONT_CHARS];
+  uint8_t *rle;
+  char list[FONT_CHARS * 4 + 1];
+  FILE *f;
+  int i, files = 0;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc) out = argv[++i];
+    else if (!strcmp(argv[i], "-a") && i + 1 < argc) {
+      const char *a = argv[++i];
+      while (*a) use(*a == '\\' ? (++a, unescape(&a)) : (unsigned char)*a++);
+    } else if (argv[i][0] != '-') {
+      if (scan(argv[i]) != 0) return 1;
+      files++;
+    } else {
+      files = 0;
+      break;
+    }
+  }
+  if (!files) {
+    fprintf(stderr, "usage: %s [-a chars] [-o font_subset.c] source...\n", argv[0]);
+    return 2;
+  }
+
+  /* slot 0 is the fallback, then ascending codes */
+  use(' ');
+  use(FONT_FALLBACK);
+  memset(map, 0, sizeof map);
+  order[n++] = FONT_FALLBACK - FONT_FIRST;
+  list[0] = '\0';
+  for (c = FONT_FIRST; c < FONT_FIRST + FONT_CHARS; ++c) {
+    char one[8];
+    if (!used[c]) continue;
+    if (c != FONT_FALLBACK) { map[c - FONT_FIRST] = (uint8_t)n; order[n++] = (uint8_t)(c - FONT_FIRST); }
+    snprintf(one, sizeof one, (c >= 0x7Fu || c == '\\') ? "\\x%02X" : "%c", c);
+    strcat(list, one);
+  }
+  for (c = 0; c < 256u; ++c)
+    if (used[c] && (c < FONT_FIRST || c >= FONT_FIRST + FONT_CHARS) && c != '\n' && c != '\r' && c != '\t')
+      fprintf(stderr, "character 0x%02X has no glyph, drawn as '%c'\n", c, FONT_FALLBACK);
+
+  /* 16x24 glyphs as RLE streams, each checked by decoding it back */
+  rle = malloc(n * RLE_G_BOUND(G24_PIX));
+  if (!rle) { fprintf(stderr, "out of memory\n"); return 1; }
+  for (k = 0; k < n; ++k) {
+    uint8_t pix[G24_PIX], back[G24_PIX];
+    unsigned j, g = order[k];
+    size_t len;
+    for (j = 0; j < G24_PIX; ++j) pix[j] = (Font_16x24_h[g * 24u + j / 16u] >> (j % 16u)) & 1u;
+    off[k] = (uint16_t)rle_len;
+    len = rle_glyph_encode(pix, G24_PIX, rle + rle_len);
+    if (!len || rle_glyph_decode(rle + rle_len, len, back, G24_PIX) != len || memcmp(pix, back, G24_PIX)) {
+      fprintf(stderr, "glyph 0x%02X: RLE round trip failed\n", g + FONT_FIRST);
+      return 1;
+    }
+    rle_len += len;
+  }
+
+  full    = sizeof Font_6x8_h + sizeof Font_16x24_h;
+  sub     = n * (8u + 48u) + FONT_CHARS + sizeof(uint32_t);
+  sub_rle = sub - n * 48u + n * sizeof off[0] + rle_len;
+
+  f = fopen(out, "w");
+  if (!f) { perror(out); return 1; }
+  fprintf(f, "/* COE718 Lab 3a - subset fonts, see font_subset.h\n *\n");
+  fprintf(f, " * Generated by tools/font_gen.c, do not edit:\n *   font_gen");
+  for (i = 1; i < argc; ++i) fprintf(f, " %s", argv[i]);
+  fprintf(f, "\n *\n * %u glyphs: %s\n", n, list);
+  fprintf(f, " * %u bytes instead of %u for the full fonts, %u saved\n", (unsigned)sub, (unsigned)full, (unsigned)(full - sub));
+  fprintf(f, " * FONT_RLE=1: %u bytes, 16x24 glyphs %u instead of %u with offsets\n */\n",
+          (unsigned)sub_rle, (unsigned)(rle_len + n * sizeof off[0]), n * 48u);
+  fprintf(f, "#include \"font_subset.h\"\n\n#if FONT_SUBSET\n\n");
+
+  fprintf(f, "const uint32_t font_sub_count = %uu;\n\n", n);
+  fprintf(f, "/* character code - FONT_FIRST -> slot */\nconst uint8_t font_sub_map[FONT_CHARS] = {");
+  for (k = 0; k < FONT_CHARS; ++k) fprintf(f, "%s%2u,", k % 16u ? " " : "\n  ", map[k]);
+  fprintf(f, "\n};\n\n");
+
+  fprintf(f, "const uint8_t font_sub_6x8[%u] = {\n", n * 8u);
+  for (k = 0; k < n; ++k) {
+    unsigned j, g = order[k];
+    fprintf(f, "  /* %2u: 0x%02X */\n ", k, g + FONT_FIRST);
+    for (j = 0; j < 8u; ++j) fprintf(f, " 0x%02X,", Font_6x8_h[g * 8u + j]);
+    fprintf(f, "\n");
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "#if !FONT_RLE\n\nconst uint16_t font_sub_16x24[%u] = {\n", n * 24u);
+  for (k = 0; k < n; ++k) {
+    unsigned j, g = order[k];
+    fprintf(f, "  /* %2u: 0x%02X */", k, g + FONT_FIRST);
+    for (j = 0; j < 24u; ++j) fprintf(f, "%s 0x%04X,", j % 8u ? "" : "\n ", Font_16x24_h[g * 24u + j]);
+    fprintf(f, "\n");
+  }
+  fprintf(f, "};\n\n#else\n\n");
+
+  fprintf(f, "/* slot -> start of its stream in font_sub_16x24_rle */\nconst uint16_t font_sub_16x24_off[%u] = {", n);
+  for (k = 0; k < n; ++k) fprintf(f, "%s%5u,", k % 10u ? " " : "\n  ", off[k]);
+  fprintf(f, "\n};\n\n");
+
+  fprintf(f, "const uint8_t font_sub_16x24_rle[%u] = {\n", (unsigned)rle_len);
+  for (k = 0; k < n; ++k) {
+    size_t j, end = k + 1u < n ? off[k + 1u] : rle_len;
+    fprintf(f, "  /* %2u: 0x%02X */", k, order[k] + FONT_FIRST);
+    for (j = off[k]; j < end; ++j) fprintf(f, "%s 0x%02X,", (j - off[k]) % 12u ? "" : "\n ", rle[j]);
+    fprintf(f, "\n");
+  }
+  fprintf(f, "};\n\n#endif /* FONT_RLE */\n\n#endif /* FONT_SUBSET */\n");
+  if (fclose(f) != 0) { perror(out); return 1; }
+
+  fprintf(stderr, "%u glyphs: %s\n%u bytes instead of %u, %u saved; %u with FONT_RLE=1\n", n, list,
+          (unsigned)sub, (unsigned)full, (unsigned)(full - sub), (unsigned)sub_rle);
+  free(rle);
+  return warnings ? 3 : 0;
+}
@@ -0,0 +1,74 @@
+/* COE718 Lab 3a - host run of the OS-roles task graph (task_graph.c)
+ *
+ * Build:  cc -std=gnu99 -O2 -Ihost -I.. -o graph_bench graph_bench.c ../task_graph.c \
+ *             ../work_pool.c ../trace.c ../hrclock.c host/host_os.c -lpthread
+ * Usage:  graph_bench [iterations]        (default 10000)
+ *
+ * Same topology as thread2_analysis.c (Memory -> CPU, App -> Device ->
+ * AppDone <- UI), run as jobs on the work pool with each role reduced to
+ * its register-level work.
+ * Prints graph iterations per second, per-node latency and the critical
+ * path, in cycles of the nominal SystemCoreClock of the host shim.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "cmsis_os.h"
+#include "LPC17xx.h"
+#include "task_graph.h"
+#include "trace.h"
+#include "hrclock.h"
+
+enum { N_MEM, N_CPU, N_APP, N_DEV, N_UI, N_APP_DONE, N_ROLES };
+
+static volatile uint32_t bb_word, rot_out, counters[N_ROLES];
+static char record[64];
+
+static void role_memory(void *c)   { (void)c; bb_word = (bb_word | 8u) & ~4u; bb_word ^= 1u; counters[N_MEM]++; }
+static void role_cpu(void *c)      { uint32_t x = bb_word ^ 0xA5A5A5A5u; unsigned r = (bb_word & 8u) ? 7u : 3u; (void)c;
+                                     rot_out = (x >> r) | (x << (32u - r)); counters[N_CPU]++; }
+static void role_app(void *c)      { (void)c; snprintf(record, sizeof record, "App: begin write -> "); counters[N_APP]++; }
+static void role_device(void *c)   { size_t n = 0; (void)c; while (record[n]) n++;
+                                     snprintf(record + n, sizeof record - n, "Device: append + close."); counters[N_DEV]++; }
+static void role_ui(void *c)       { (void)c; counters[N_UI]++; }
+static void role_app_done(void *c) { (void)c; counters[N_APP_DONE]++; }
+
+static const tg_node_def_t roles_graph[N_ROLES] = {
+  { "Memory",  role_memory,   0, 0,                             0 },
+  { "CPU",     role_cpu,      0, TG_DEP(N_MEM),                 0 },
+  { "App",     role_app,      0, 0,                             0 },
+  { "Device",  role_device,   0, TG_DEP(N_APP),                 0 },
+  { "UI",      role_ui,       0, 0,                             0 },
+  { "AppDone", role_app_done, 0, TG_DEP(N_DEV) | TG_DEP(N_UI),  0 },
+};
+
+int main(int argc, char **argv)
+{
+  static tg_graph_t g;
+  uint32_t iters = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 10000u;
+  uint64_t total = 0;
+  uint32_t i;
+  double mhz = SystemCoreClock / 1e6;
+
+  osKernelInitialize();
+  hrclock_init();
+  trace_init();
+  if (wp_init() || tg_init(&g, roles_graph, N_ROLES)) { fprintf(stderr, "graph setup failed\n"); return 1; }
+
+  for (i = 0; i < iters; ++i) {
+    uint32_t t0 = hrclock_cyc32();
+    tg_run(&g);
+    total += hrclock_cyc32() - t0;
+  }
+  tg_analyse(&g);
+
+  printf("iterations        %u\n", iters);
+  printf("graph iter/s      %.0f\n", total ? iters * (double)SystemCoreClock / (double)total : 0.0);
+  printf("mean iteration    %.2f us\n", total / (double)iters / mhz);
+  printf("critical path     %.2f us of %.2f us total work:", g.crit_cycles / mhz, g.work_cycles / mhz);
+  for (i = 0; i < g.n; ++i) if (g.crit_mask & TG_DEP(i)) printf(" %s", roles_graph[i].name);
+  printf("\n\n%-8s %8s %10s %10s\n", "node", "runs", "mean us", "max us");
+  for (i = 0; i < g.n; ++i)
+    printf("%-8s %8u %10.3f %10.3f\n", roles_graph[i].name, g.stat[i].runs,
+           g.stat[i].runs ? g.stat[i].sum / (double)g.stat[i].runs / mhz : 0.0, g.stat[i].max / mhz);
+  return 0;
+}
@@ -0,0 +1,62 @@
+/* COE718 Lab 3a - host stand-in for the device/core header
+ *
+ * Provides the core intrinsics used by the kernel-independent modules.
+ * LDREX/STREX are emulated with a compare-and-swap against the value the
+ * same thread last loaded; __disable_irq()/__enable_irq() map to one
+ * global recursive lock.
+ */
+#ifndef HOST_LPC17XX_H
+#define HOST_LPC17XX_H
+#include <stdint.h>
+
+#define __I     volatile const
+#define __O     volatile
+#define __IO    volatile
+
+extern uint32_t SystemCoreClock;
+
+extern __thread uint32_t host_ldrex_val;
+
+static inline void     __DMB(void) { __sync_synchronize(); }
+static inline void     __DSB(void) { __sync_synchronize(); }
+static inline void     __ISB(void) { __sync_synchronize(); }
+static inline void     __NOP(void) { }
+static inline uint32_t __LDREXW(volatile uint32_t *p)
+{
+  host_ldrex_val = __atomic_load_n(p, __ATOMIC_SEQ_CST);
+  return host_ldrex_val;
+}
+static inline uint32_t __STREXW(uint32_t v, volatile uint32_t *p)
+{
+  uint32_t expect = host_ldrex_val;
+  return __atomic_compare_exchange_n(p, &expect, v, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? 0u : 1u;
+}
+static inline void     __CLREX(void) { }
+static inline uint32_t __CLZ(uint32_t v)  { return v ? (uint32_t)__builtin_clz(v) : 32u; }
+static inline uint32_t __RBIT(uint32_t v)
+{
+  uint32_t r = 0u, i;
+  for (i = 0; i < 32u; ++i) { r = (r << 1) | (v & 1u); v >>= 1; }
+  return r;
+}
+
+void     __disable_irq(void);
+void     __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t v);
+static inline uint32_t __get_IPSR(void) { return 0u; }
+
+/* DWT cycle counter: every DWT access reloads CYCCNT from the monotonic
+   clock, so reads count nominal SystemCoreClock cycles and writes are
+   ignored; CoreDebug is plain RAM. */
+typedef struct { __IO uint32_t CTRL, CYCCNT; } DWT_Type;
+typedef struct { __IO uint32_t DHCSR, DCRSR, DCRDR, DEMCR; } CoreDebug_Type;
+#define DWT_CTRL_CYCCNTENA_Msk      (1uL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1uL << 24)
+
+DWT_Type *host_dwt(void);
+extern CoreDebug_Type host_coredebug;
+#define DWT         (host_dwt())
+#define CoreDebug   (&host_coredebug)
+
+#endif /* HOST_LPC17XX_H */
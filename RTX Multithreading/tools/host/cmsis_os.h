@@ -0,0 +1,113 @@
+/* COE718 Lab 3a - host shim of the CMSIS-RTOS v1 API (pthreads)
+ *
+ * Lets the kernel-independent modules (msg_ring, task_graph, ...) run
+ * unmodified on Linux for host benchmarks.  Only what those modules use is
+ * provided.  Priorities are stored but not enforced; osKernelSysTick()
+ * counts a nominal SystemCoreClock from CLOCK_MONOTONIC.  Timeouts are
+ * scaled like the target kernel's (time_units.h), so TU_DELAY_*() values
+ * take the same real time here.
+ */
+#ifndef HOST_CMSIS_OS_H
+#define HOST_CMSIS_OS_H
+#include <stdint.h>
+#include <stddef.h>
+
+#define osCMSIS_RTX               0x40052
+#define osFeature_Signals         16
+#define osFeature_SysTick         1
+#define osWaitForever             0xFFFFFFFFu
+#define osKernelSysTickFrequency  100000000u
+
+typedef enum {
+  osPriorityIdle = -3, osPriorityLow = -2, osPriorityBelowNormal = -1,
+  osPriorityNormal = 0, osPriorityAboveNormal = 1, osPriorityHigh = 2,
+  osPriorityRealtime = 3, osPriorityError = 0x84
+} osPriority;
+
+typedef enum {
+  osOK = 0, osEventSignal = 0x08, osEventMessage = 0x10, osEventMail = 0x20,
+  osEventTimeout = 0x40, osErrorParameter = 0x80, osErrorResource = 0x81,
+  osErrorTimeoutResource = 0xC1, osErrorISR = 0x82, osErrorISRRecursive = 0x83,
+  osErrorPriority = 0x84, osErrorNoMemory = 0x85, osErrorValue = 0x86,
+  osErrorOS = 0xFF, os_status_reserved = 0x7FFFFFFF
+} osStatus;
+
+typedef enum { osTimerOnce = 0, osTimerPeriodic = 1 } os_timer_type;
+
+typedef void (*os_pthread)(void const *argument);
+typedef void (*os_ptimer)(void const *argument);
+
+typedef struct host_thread  *osThreadId;
+typedef struct host_timer   *osTimerId;
+typedef struct host_mutex   *osMutexId;
+typedef struct host_sem     *osSemaphoreId;
+typedef struct host_pool    *osPoolId;
+typedef struct host_msgq    *osMessageQId;
+
+typedef struct { os_pthread pthread; osPriority tpriority; uint32_t instances; uint32_t stacksize; } osThreadDef_t;
+typedef struct { os_ptimer ptimer; } osTimerDef_t;
+typedef struct { int unused; } osMutexDef_t;
+typedef struct { int unused; } osSemaphoreDef_t;
+typedef struct { uint32_t pool_sz; uint32_t item_sz; } osPoolDef_t;
+typedef struct { uint32_t queue_sz; } osMessageQDef_t;
+
+typedef struct {
+  osStatus status;
+  union { uint32_t v; void *p; int32_t signals; } value;
+  union { osMessageQId message_id; } def;
+} osEvent;
+
+#define osThreadDef(name, priority, instances, stacksz) \
+  const osThreadDef_t os_thread_def_##name = { (name), (priority), (instances), (stacksz) }
+#define osThread(name)        &os_thread_def_##name
+#define osTimerDef(name, function)  const osTimerDef_t os_timer_def_##name = { (function) }
+#define osTimer(name)         &os_timer_def_##name
+#define osMutexDef(name)      const osMutexDef_t os_mutex_def_##name = { 0 }
+#define osMutex(name)         &os_mutex_def_##name
+#define osSemaphoreDef(name)  const osSemaphoreDef_t os_semaphore_def_##name = { 0 }
+#define osSemaphore(name)     &os_semaphore_def_##name
+#define osPoolDef(name, no, type)  const osPoolDef_t os_pool_def_##name = { (no), sizeof(type) }
+#define osPool(name)          &os_pool_def_##name
+#define osMessageQDef(name, queue_sz, type)  const osMessageQDef_t os_messageQ_def_##name = { (queue_sz) }
+#define osMessageQ(name)      &os_messageQ_def_##name
+
+osStatus   osKernelInitialize(void);
+osStatus   osKernelStart(void);
+int32_t    osKernelRunning(void);
+uint32_t   osKernelSysTick(void);
+
+osThreadId osThreadCreate(const osThreadDef_t *thread_def, void *argument);
+osThreadId osThreadGetId(void);
+osStatus   osThreadTerminate(osThreadId thread_id);
+osStatus   osThreadYield(void);
+osStatus   osThreadSetPriority(osThreadId thread_id, osPriority priority);
+osPriority osThreadGetPriority(osThreadId thread_id);
+
+osStatus   osDelay(uint32_t millisec);
+
+osTimerId  osTimerCreate(const osTimerDef_t *timer_def, os_timer_type type, void *argument);
+osStatus   osTimerStart(osTimerId timer_id, uint32_t millisec);
+osStatus   osTimerStop(osTimerId timer_id);
+
+int32_t    osSignalSet(osThreadId thread_id, int32_t signals);
+int32_t    osSignalClear(osThreadId thread_id, int32_t signals);
+osEvent    osSignalWait(int32_t signals, uint32_t millisec);
+
+osMutexId  osMutexCreate(const osMutexDef_t *mutex_def);
+osStatus   osMutexWait(osMutexId mutex_id, uint32_t millisec);
+osStatus   osMutexRelease(osMutexId mutex_id);
+
+osSemaphoreId osSemaphoreCreate(const osSemaphoreDef_t *semaphore_def, int32_t count);
+int32_t    osSemaphoreWait(osSemaphoreId semaphore_id, uint32_t millisec);
+osStatus   osSemaphoreRelease(osSemaphoreId semaphore_id);
+
+osPoolId   osPoolCreate(const osPoolDef_t *pool_def);
+void      *osPoolAlloc(osPoolId pool_id);
+void      *osPoolCAlloc(osPoolId pool_id);
+osStatus   osPoolFree(osPoolId pool_id, void *block);
+
+osMessageQId osMessageCreate(const osMessageQDef_t *queue_def, osThreadId thread_id);
+osStatus   osMessagePut(osMessageQId queue_id, uint32_t info, uint32_t millisec);
+osEvent    osMessageGet(osMessageQId queue_id, uint32_t millisec);
+
+#endif /* HOST_CMSIS_OS_H */
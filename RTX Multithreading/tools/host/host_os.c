@@ -0,0 +1,427 @@
+/* COE718 Lab 3a - host shim of the CMSIS-RTOS v1 API, see cmsis_os.h */
+
+#define _GNU_SOURCE
+#include "cmsis_os.h"
+#include "LPC17xx.h"
+#include "time_units.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+uint32_t SystemCoreClock = 100000000u;
+__thread uint32_t host_ldrex_val;
+
+/* ------------------- "interrupt disable" ------------------- */
+static pthread_mutex_t irq_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread uint32_t irq_masked;
+
+void __disable_irq(void) { if (!irq_masked) { pthread_mutex_lock(&irq_lock); irq_masked = 1u; } }
+void __enable_irq(void)  { if (irq_masked)  { irq_masked = 0u; pthread_mutex_unlock(&irq_lock); } }
+uint32_t __get_PRIMASK(void) { return irq_masked; }
+void __set_PRIMASK(uint32_t v) { if (v) __disable_irq(); else __enable_irq(); }
+
+/* ------------------- time ------------------- */
+/* Timeouts are kernel milliseconds, as on the target: rounded up to whole
+   OS_TICK ticks, each lasting the real TU_TICK_US (see time_units.h). */
+static uint64_t kms_to_ns(uint32_t ms)
+{
+  uint64_t ticks = ((uint64_t)ms * 1000u + TU_OS_TICK - 1u) / TU_OS_TICK;
+  return ticks * TU_TICK_US * 1000u;
+}
+
+static void ts_add_ns(struct timespec *ts, uint64_t ns)
+{
+  ts->tv_sec  += (time_t)(ns / 1000000000u);
+  ts->tv_nsec += (long)(ns % 1000000000u);
+  if (ts->tv_nsec >= 1000000000L) { ts->tv_sec++; ts->tv_nsec -= 1000000000L; }
+}
+
+static void deadline_in(struct timespec *ts, uint32_t ms)
+{
+  clock_gettime(CLOCK_REALTIME, ts);
+  ts_add_ns(ts, kms_to_ns(ms));
+}
+
+/* waits on c; returns 0 on signal, ETIMEDOUT on timeout */
+static int cond_wait_ms(pthread_cond_t *c, pthread_mutex_t *m, uint32_t ms)
+{
+  struct timespec ts;
+  if (ms == osWaitForever) return pthread_cond_wait(c, m);
+  deadline_in(&ts, ms);
+  return pthread_cond_timedwait(c, m, &ts);
+}
+
+uint32_t osKernelSysTick(void)
+{
+  struct timespec ts;
+  uint64_t ns;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  ns = (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+  return (uint32_t)(ns * (SystemCoreClock / 1000000u) / 1000u);
+}
+
+static DWT_Type host_dwt_regs;
+CoreDebug_Type  host_coredebug;
+
+DWT_Type *host_dwt(void)
+{
+  host_dwt_regs.CYCCNT = osKernelSysTick();
+  return &host_dwt_regs;
+}
+
+osStatus osDelay(uint32_t millisec)
+{
+  struct timespec ts = { 0, 0 };
+  ts_add_ns(&ts, kms_to_ns(millisec));
+  while (nanosleep(&ts, &ts) != 0 && errno == EINTR) { }
+  return osEventTimeout;
+}
+
+/* ------------------- threads + signals ------------------- */
+struct host_thread {
+  pthread_t       pt;
+  pthread_mutex_t m;
+  pthread_cond_t  c;
+  int32_t         signals;
+  osPriority      prio;
+  os_pthread      fn;
+  void           *arg;
+};
+
+static __thread struct host_thread *self;
+
+static struct host_thread *thread_new(osPriority prio)
+{
+  struct host_thread *t = calloc(1, sizeof(*t));
+  pthread_mutex_init(&t->m, NULL);
+  pthread_cond_init(&t->c, NULL);
+  t->prio = prio;
+  return t;
+}
+
+static void *thread_entry(void *p)
+{
+  self = p;
+  self->fn(self->arg);
+  return NULL;
+}
+
+osStatus osKernelInitialize(void) { (void)osThreadGetId(); return osOK; }
+osStatus osKernelStart(void)      { return osOK; }
+int32_t  osKernelRunning(void)    { return 1; }
+
+osThreadId osThreadCreate(const osThreadDef_t *def, void *argument)
+{
+  struct host_thread *t = thread_new(def->tpriority);
+  t->fn  = def->pthread;
+  t->arg = argument;
+  if (pthread_create(&t->pt, NULL, thread_entry, t) != 0) { free(t); return NULL; }
+  pthread_detach(t->pt);
+  return t;
+}
+
+osThreadId osThreadGetId(void)
+{
+  if (!self) { self = thread_new(osPriorityNormal); self->pt = pthread_self(); }
+  return self;
+}
+
+osStatus osThreadTerminate(osThreadId id)
+{
+  if (id != osThreadGetId()) return osErrorResource;   /* only self-exit on host */
+  pthread_exit(NULL);
+}
+
+osStatus   osThreadYield(void) { sched_yield(); return osOK; }
+osStatus   osThreadSetPriority(osThreadId id, osPriority p) { if (!id) return osErrorParameter; id->prio = p; return osOK; }
+osPriority osThreadGetPriority(osThreadId id) { return id ? id->prio : osPriorityError; }
+
+int32_t osSignalSet(osThreadId id, int32_t signals)
+{
+  int32_t old;
+  if (!id) return (int32_t)0x80000000;
+  pthread_mutex_lock(&id->m);
+  old = id->signals;
+  id->signals |= signals;
+  pthread_cond_broadcast(&id->c);
+  pthread_mutex_unlock(&id->m);
+  return old;
+}
+
+int32_t osSignalClear(osThreadId id, int32_t signals)
+{
+  int32_t old;
+  if (!id) return (int32_t)0x80000000;
+  pthread_mutex_lock(&id->m);
+  old = id->signals;
+  id->signals &= ~signals;
+  pthread_mutex_unlock(&id->m);
+  return old;
+}
+
+osEvent osSignalWait(int32_t signals, uint32_t millisec)
+{
+  struct host_thread *t = osThreadGetId();
+  osEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  pthread_mutex_lock(&t->m);
+  for (;;) {
+    int32_t got = signals ? (t->signals & signals) : t->signals;
+    if ((signals && got == signals) || (!signals && got)) {
+      t->signals &= ~got;
+      ev.status = osEventSignal;
+      ev.value.signals = got;
+      break;
+    }
+    if (millisec == 0u || cond_wait_ms(&t->c, &t->m, millisec) == ETIMEDOUT) {
+      ev.status = millisec ? osEventTimeout : osOK;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&t->m);
+  return ev;
+}
+
+/* ------------------- mutex ------------------- */
+struct host_mutex { pthread_mutex_t m; };
+
+osMutexId osMutexCreate(const osMutexDef_t *def)
+{
+  struct host_mutex *mx = calloc(1, sizeof(*mx));
+  pthread_mutexattr_t a;
+  (void)def;
+  pthread_mutexattr_init(&a);
+  pthread_mutexattr_settype(&a, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&mx->m, &a);
+  return mx;
+}
+
+osStatus osMutexWait(osMutexId id, uint32_t millisec)
+{
+  struct timespec ts;
+  if (!id) return osErrorParameter;
+  if (millisec == osWaitForever) return pthread_mutex_lock(&id->m) ? osErrorOS : osOK;
+  if (millisec == 0u) return pthread_mutex_trylock(&id->m) ? osErrorResource : osOK;
+  deadline_in(&ts, millisec);
+  return pthread_mutex_timedlock(&id->m, &ts) ? osErrorTimeoutResource : osOK;
+}
+
+osStatus osMutexRelease(osMutexId id)
+{
+  if (!id) return osErrorParameter;
+  return pthread_mutex_unlock(&id->m) ? osErrorResource : osOK;
+}
+
+/* ------------------- semaphore ------------------- */
+struct host_sem { pthread_mutex_t m; pthread_cond_t c; int32_t count; };
+
+osSemaphoreId osSemaphoreCreate(const osSemaphoreDef_t *def, int32_t count)
+{
+  struct host_sem *s = calloc(1, sizeof(*s));
+  (void)def;
+  pthread_mutex_init(&s->m, NULL);
+  pthread_cond_init(&s->c, NULL);
+  s->count = count;
+  return s;
+}
+
+int32_t osSemaphoreWait(osSemaphoreId s, uint32_t millisec)
+{
+  int32_t left = -1;
+  if (!s) return -1;
+  pthread_mutex_lock(&s->m);
+  while (s->count == 0) {
+    if (millisec == 0u || cond_wait_ms(&s->c, &s->m, millisec) == ETIMEDOUT) break;
+  }
+  if (s->count > 0) left = s->count--;
+  pthread_mutex_unlock(&s->m);
+  return left < 0 ? 0 : left;
+}
+
+osStatus osSemaphoreRelease(osSemaphoreId s)
+{
+  if (!s) return osErrorParameter;
+  pthread_mutex_lock(&s->m);
+  s->count++;
+  pthread_cond_signal(&s->c);
+  pthread_mutex_unlock(&s->m);
+  return osOK;
+}
+
+/* ------------------- memory pool ------------------- */
+struct host_pool { pthread_mutex_t m; void *free_list; uint32_t item_sz; };
+
+osPoolId osPoolCreate(const osPoolDef_t *def)
+{
+  struct host_pool *p = calloc(1, sizeof(*p));
+  uint32_t i, sz = (def->item_sz + 7u) & ~7u;
+  char *blocks;
+  if (sz < sizeof(void *)) sz = sizeof(void *);
+  blocks = calloc(def->pool_sz, sz);
+  pthread_mutex_init(&p->m, NULL);
+  p->item_sz = def->item_sz;
+  for (i = 0; i < def->pool_sz; ++i) {
+    *(void **)(blocks + (size_t)i * sz) = p->free_list;
+    p->free_list = blocks + (size_t)i * sz;
+  }
+  return p;
+}
+
+void *osPoolAlloc(osPoolId p)
+{
+  void *b;
+  if (!p) return NULL;
+  pthread_mutex_lock(&p->m);
+  b = p->free_list;
+  if (b) p->free_list = *(void **)b;
+  pthread_mutex_unlock(&p->m);
+  return b;
+}
+
+void *osPoolCAlloc(osPoolId p)
+{
+  void *b = osPoolAlloc(p);
+  if (b) memset(b, 0, p->item_sz);
+  return b;
+}
+
+osStatus osPoolFree(osPoolId p, void *b)
+{
+  if (!p || !b) return osErrorParameter;
+  pthread_mutex_lock(&p->m);
+  *(void **)b = p->free_list;
+  p->free_list = b;
+  pthread_mutex_unlock(&p->m);
+  return osOK;
+}
+
+/* ------------------- message queue ------------------- */
+struct host_msgq { pthread_mutex_t m; pthread_cond_t c; uint32_t *q, size, head, count; };
+
+osMessageQId osMessageCreate(const osMessageQDef_t *def, osThreadId owner)
+{
+  struct host_msgq *q = calloc(1, sizeof(*q));
+  (void)owner;
+  pthread_mutex_init(&q->m, NULL);
+  pthread_cond_init(&q->c, NULL);
+  q->size = def->queue_sz;
+  q->q = calloc(q->size, sizeof(uint32_t));
+  return q;
+}
+
+osStatus osMessagePut(osMessageQId q, uint32_t info, uint32_t millisec)
+{
+  osStatus st = osOK;
+  if (!q) return osErrorParameter;
+  pthread_mutex_lock(&q->m);
+  while (q->count == q->size) {
+    if (millisec == 0u || cond_wait_ms(&q->c, &q->m, millisec) == ETIMEDOUT) { st = osErrorTimeoutResource; break; }
+  }
+  if (st == osOK) {
+    q->q[(q->head + q->count) % q->size] = info;
+    q->count++;
+    pthread_cond_broadcast(&q->c);
+  }
+  pthread_mutex_unlock(&q->m);
+  return st;
+}
+
+osEvent osMessageGet(osMessageQId q, uint32_t millisec)
+{
+  osEvent ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.def.message_id = q;
+  if (!q) { ev.status = osErrorParameter; return ev; }
+  pthread_mutex_lock(&q->m);
+  while (q->count == 0u) {
+    if (millisec == 0u || cond_wait_ms(&q->c, &q->m, millisec) == ETIMEDOUT) break;
+  }
+  if (q->count) {
+    ev.status  = osEventMessage;
+    ev.value.v = q->q[q->head];
+    q->head = (q->head + 1u) % q->size;
+    q->count--;
+    pthread_cond_broadcast(&q->c);
+  } else {
+    ev.status = millisec ? osEventTimeout : osOK;
+  }
+  pthread_mutex_unlock(&q->m);
+  return ev;
+}
+
+/* ------------------- timers ------------------- */
+struct host_timer {
+  pthread_t       pt;
+  pthread_mutex_t m;
+  pthread_cond_t  c;
+  os_ptimer       fn;
+  void           *arg;
+  os_timer_type   type;
+  uint32_t        period_ms;
+  int             armed;
+  uint32_t        gen;
+};
+
+static void *timer_entry(void *p)
+{
+  struct host_timer *t = p;
+  struct timespec next;
+  pthread_mutex_lock(&t->m);
+  for (;;) {
+    uint32_t gen;
+    while (!t->armed) pthread_cond_wait(&t->c, &t->m);
+    gen = t->gen;
+    clock_gettime(CLOCK_REALTIME, &next);
+    for (;;) {
+      ts_add_ns(&next, kms_to_ns(t->period_ms));
+      while (t->armed && t->gen == gen &&
+             pthread_cond_timedwait(&t->c, &t->m, &next) != ETIMEDOUT) { }
+      if (!t->armed || t->gen != gen) break;
+      if (t->type == osTimerOnce) t->armed = 0;
+      pthread_mutex_unlock(&t->m);
+      t->fn(t->arg);                      /* drift-free: next deadline advances by period */
+      pthread_mutex_lock(&t->m);
+      if (!t->armed || t->gen != gen) break;
+    }
+  }
+  return NULL;
+}
+
+osTimerId osTimerCreate(const osTimerDef_t *def, os_timer_type type, void *argument)
+{
+  struct host_timer *t = calloc(1, sizeof(*t));
+  pthread_mutex_init(&t->m, NULL);
+  pthread_cond_init(&t->c, NULL);
+  t->fn = def->ptimer;
+  t->arg = argument;
+  t->type = type;
+  if (pthread_create(&t->pt, NULL, timer_entry, t) != 0) { free(t); return NULL; }
+  pthread_detach(t->pt);
+  return t;
+}
+
+osStatus osTimerStart(osTimerId t, uint32_t millisec)
+{
+  if (!t || millisec == 0u) return osErrorParameter;
+  pthread_mutex_lock(&t->m);
+  t->period_ms = millisec;
+  t->armed = 1;
+  t->gen++;
+  pthread_cond_broadcast(&t->c);
+  pthread_mutex_unlock(&t->m);
+  return osOK;
+}
+
+osStatus osTimerStop(osTimerId t)
+{
+  if (!t) return osErrorParameter;
+  pthread_mutex_lock(&t->m);
+  t->armed = 0;
+  t->gen++;
+  pthread_cond_broadcast(&t->c);
+  pthread_mutex_unlock(&t->m);
+  return osOK;
+}
@@ -0,0 +1,444 @@
+/* COE718 Lab 3a - bitmap converter for the GLCD_Bitmap family
+ *
+ * Build:  cc -std=c99 -O2 -I.. -o img_gen img_gen.c
+ * Usage:  img_gen [-n name] [-f format,...] [-u] [-o image.h] image.ppm
+ *         img_gen [-n name] [-f format,...] [-u] [-o image.h] -t WxH
+ *
+ * Reads a binary PPM (P6, maxval 255; any paint program or ImageMagick
+ * `convert x.png x.ppm` writes one), or draws the test card with -t, and
+ * writes a header with the image in each format asked for (default
+ * "both", i.e. raw,rle):
+ *
+ *   raw    const unsigned short name[w * h], RGB565, rows bottom up, for
+ *          GLCD_Bitmap(x, y, w, h, (unsigned char *)name)
+ *   rle    const unsigned char name_rle[], glcd_rle.h stream, rows top
+ *          down, for GLCD_BitmapRLE(x, y, w, h, name_rle)
+ *   idxN   N = 1, 2, 4, 8: const unsigned char name_iN[] palette
+ *          indices and const unsigned short name_iN_lut[] RGB565, for
+ *          GLCD_BitmapIdx(x, y, w, h, NAME_IN_FMT, name_iN_lut, name_iN)
+ *   mono   const unsigned char name_mono[], 1 bpp without palette: dark
+ *          pixels (luma < 128) draw in the text colour, the rest in the
+ *          back colour; GLCD_BitmapIdx(..., NAME_MONO_FMT, 0, name_mono)
+ *
+ * plus NAME_W / NAME_H.  Indexed rows run top down unless -u is given
+ * (bottom up, as BMP stores them); both draw at the same speed.  Like
+ * Font_*.h, include the header from one .c file, after GLCD.h.
+ *
+ * An image with at most 2^N colours keeps them exactly; otherwise a
+ * median cut picks the 2^N-entry palette and each colour maps to its
+ * nearest entry (no dithering), with the worst channel error reported.
+ * Every format is decoded back the way the driver reads it and compared
+ * before anything is written; flash bytes for each go to the header
+ * comment and to stderr.
+ *
+ * The test card is what a splash screen looks like to the coder: flat
+ * fills, a title bar with text-like strokes, a ring, a progress bar, and
+ * one shaded band where every pixel differs.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "rle_codec.h"
+
+typedef struct {
+  unsigned  w, h;
+  uint16_t *px;                         /* RGB565, rows top down */
+} image_t;
+
+static uint16_t rgb565(unsigned r, unsigned g, unsigned b)
+{
+  return (uint16_t)(((r * 31u + 127u) / 255u) << 11 | ((g * 63u + 127u) / 255u) << 5 | (b * 31u + 127u) / 255u);
+}
+
+/* channel k (0 red, 1 green, 2 blue) of an RGB565 colour, 0..255 */
+static unsigned chan(uint16_t c, unsigned k)
+{
+  switch (k) {
+    case 0:  return (c >> 11) * 255u / 31u;
+    case 1:  return ((c >> 5) & 63u) * 255u / 63u;
+    default: return (c & 31u) * 255u / 31u;
+  }
+}
+
+/* ------------------- PPM ------------------- */
+static int ppm_field(FILE *f, unsigned *v)
+{
+  int c = fgetc(f);
+
+  for (;;) {
+    while (c != EOF && isspace(c)) c = fgetc(f);
+    if (c != '#') break;
+    while (c != EOF && c != '\n') c = fgetc(f);
+  }
+  if (c == EOF || !isdigit(c)) return -1;
+  for (*v = 0; c != EOF && isdigit(c); c = fgetc(f)) *v = *v * 10u + (unsigned)(c - '0');
+  return 0;                             /* one whitespace consumed */
+}
+
+static int load_ppm(const char *path, image_t *im)
+{
+  FILE *f = fopen(path, "rb");
+  unsigned maxval;
+  size_t i, n;
+  uint8_t *rgb;
+
+  if (!f) { perror(path); return -1; }
+  if (fgetc(f) != 'P' || fgetc(f) != '6' || ppm_field(f, &im->w) || ppm_field(f, &im->h) ||
+      ppm_field(f, &maxval) || maxval != 255u || !im->w || !im->h || im->w > 320u || im->h > 320u) {
+    fprintf(stderr, "%s: not a P6 PPM with maxval 255, at most 320x320\n", path);
+    fclose(f);
+    return -1;
+  }
+  n      = (size_t)im->w * im->h;
+  rgb    = malloc(3u * n);
+  im->px = malloc(n * sizeof *im->px);
+  if (!rgb || !im->px || fread(rgb, 3u, n, f) != n) {
+    fprintf(stderr, "%s: short file\n", path);
+    fclose(f);
+    return -1;
+  }
+  fclose(f);
+  for (i = 0; i < n; ++i) im->px[i] = rgb565(rgb[3u * i], rgb[3u * i + 1u], rgb[3u * i + 2u]);
+  free(rgb);
+  return 0;
+}
+
+/* ------------------- Test card ------------------- */
+static void fill(image_t *im, unsigned x0, unsigned y0, unsigned x1, unsigned y1, uint16_t c)
+{
+  unsigned x, y;
+  for (y = y0; y < y1 && y < im->h; ++y)
+    for (x = x0; x < x1 && x < im->w; ++x) im->px[y * im->w + x] = c;
+}
+
+static int test_card(const char *size, image_t *im)
+{
+  unsigned x, y, bar, cx, cy, r, k;
+
+  if (sscanf(size, "%ux%u", &im->w, &im->h) != 2 || im->w < 32u || im->h < 32u || im->w > 320u || im->h > 320u) {
+    fprintf(stderr, "-t %s: expected WxH, 32..320 each\n", size);
+    return -1;
+  }
+  im->px = malloc((size_t)im->w * im->h * sizeof *im->px);
+  if (!im->px) return -1;
+  bar = im->h / 6u;
+
+  fill(im, 0, 0, im->w, im->h, rgb565(0, 128, 128));                      /* DarkCyan */
+  fill(im, 0, 0, im->w, bar, rgb565(0, 0, 128));                          /* title bar */
+  for (k = 0, x = 4; x + 5u < im->w * 2u / 3u; x += 7u, ++k)              /* "text" */
+    if (k % 5u != 4u) fill(im, x, bar / 4u, x + 5u, bar * 3u / 4u, rgb565(255, 255, 255));
+
+  cx = im->w / 2u;
+  cy = (bar + im->h * 3u / 4u) / 2u;
+  r  = (im->h * 3u / 4u - bar) / 2u - 2u;
+  for (y = 0; y < im->h; ++y) {                                           /* ring */
+    for (x = 0; x < im->w; ++x) {
+      long dx = (long)x - (long)cx, dy = (long)y - (long)cy, d = dx * dx + dy * dy;
+      if (d <= (long)(r * r)) im->px[y * im->w + x] = d >= (long)((r - 3u) * (r - 3u)) ? rgb565(255, 0, 0) : rgb565(255, 255, 0);
+    }
+  }
+
+  for (y = im->h * 3u / 4u; y < im->h * 3u / 4u + 4u; ++y)                /* shaded band */
+    for (x = 0; x < im->w; ++x) im->px[y * im->w + x] = rgb565(x * 255u / im->w, 64u + y * 4u % 64u, 255u - x * 255u / im->w);
+
+  fill(im, 4, im->h - 8u, im->w - 4u, im->h - 3u, rgb565(255, 255, 255)); /* progress bar */
+  fill(im, 5, im->h - 7u, 5u + (im->w - 10u) * 3u / 5u, im->h - 4u, rgb565(0, 255, 0));
+  return 0;
+}
+
+/* ------------------- Palette ------------------- */
+typedef struct {
+  uint16_t c;
+  uint32_t n;                           /* pixels of this colour */
+} colour_t;
+
+static unsigned sort_k;
+
+static int cmp_count(const void *a, const void *b)
+{
+  const colour_t *x = a, *y = b;
+  return x->n != y->n ? (x->n < y->n) - (x->n > y->n) : (x->c > y->c) - (x->c < y->c);
+}
+
+static int cmp_chan(const void *a, const void *b)
+{
+  unsigned x = chan(((const colour_t *)a)->c, sort_k), y = chan(((const colour_t *)b)->c, sort_k);
+  return (x > y) - (x < y);
+}
+
+/* the distinct colours of im, most used first; returns how many */
+static unsigned histogram(const image_t *im, colour_t *col)
+{
+  static uint32_t count[65536];
+  size_t i, n = (size_t)im->w * im->h;
+  unsigned c, k = 0;
+
+  memset(count, 0, sizeof count);
+  for (i = 0; i < n; ++i) count[im->px[i]]++;
+  for (c = 0; c < 65536u; ++c)
+    if (count[c]) { col[k].c = (uint16_t)c; col[k].n = count[c]; ++k; }
+  qsort(col, k, sizeof *col, cmp_count);
+  return k;
+}
+
+/* at most max entries for the k colours in col (reordered); returns how many */
+static unsigned median_cut(colour_t *col, unsigned k, unsigned max, uint16_t *lut)
+{
+  unsigned lo[256], hi[256], boxes = 1, b, i, ch;
+
+  if (k <= max) {
+    for (i = 0; i < k; ++i) lut[i] = col[i].c;
+    return k;
+  }
+  lo[0] = 0;
+  hi[0] = k;
+  while (boxes < max) {
+    unsigned best = 0, widest = 0, best_k = 0;
+    uint64_t half, run = 0;
+    for (b = 0; b < boxes; ++b) {                   /* box with the widest channel */
+      for (ch = 0; ch < 3u; ++ch) {
+        unsigned mn = 255u, mx = 0;
+        for (i = lo[b]; i < hi[b]; ++i) {
+          unsigned v = chan(col[i].c, ch);
+          if (v < mn) mn = v;
+          if (v > mx) mx = v;
+        }
+        if (hi[b] - lo[b] > 1u && mx - mn + 1u > widest) { widest = mx - mn + 1u; best = b; best_k = ch; }
+      }
+    }
+    if (!widest) break;
+    sort_k = best_k;
+    qsort(col + lo[best], hi[best] - lo[best], sizeof *col, cmp_chan);
+    for (half = 0, i = lo[best]; i < hi[best]; ++i) half += col[i].n;
+    half /= 2u;
+    for (i = lo[best]; i + 2u < hi[best]; ++i) {    /* weighted median, both halves non-empty */
+      run += col[i].n;
+      if (run >= half) break;
+    }
+    lo[boxes] = i + 1u;
+    hi[boxes] = hi[best];
+    hi[best]  = i + 1u;
+    boxes++;
+  }
+  for (b = 0; b < boxes; ++b) {                     /* weighted mean of each box */
+    uint64_t sum[3] = { 0, 0, 0 }, n = 0;
+    for (i = lo[b]; i < hi[b]; ++i) {
+      for (ch = 0; ch < 3u; ++ch) sum[ch] += (uint64_t)chan(col[i].c, ch) * col[i].n;
+      n += col[i].n;
+    }
+    lut[b] = rgb565((unsigned)((sum[0] + n / 2u) / n), (unsigned)((sum[1] + n / 2u) / n), (unsigned)((sum[2] + n / 2u) / n));
+  }
+  return boxes;
+}
+
+/* palette of at most 1 << bpp entries and the index of every pixel;
+   returns the palette size, *err the worst channel error */
+static unsigned quantize(const image_t *im, unsigned bpp, uint16_t *lut, uint8_t *idx, unsigned *err)
+{
+  static colour_t col[65536];
+  static uint8_t  map[65536];
+  size_t i, n = (size_t)im->w * im->h;
+  unsigned k = histogram(im, col), entries, j, e, ch;
+
+  entries = median_cut(col, k, 1u << bpp, lut);
+  *err = 0;
+  for (i = 0; i < k; ++i) {                         /* nearest entry per colour */
+    uint32_t best = UINT32_MAX;
+    for (j = 0; j < entries; ++j) {
+      uint32_t d = 0;
+      for (ch = 0; ch < 3u; ++ch) {
+        int v = (int)chan(col[i].c, ch) - (int)chan(lut[j], ch);
+        d += (uint32_t)(v * v);
+      }
+      if (d < best) { best = d; map[col[i].c] = (uint8_t)j; }
+    }
+    for (ch = 0; ch < 3u; ++ch) {
+      e = (unsigned)abs((int)chan(col[i].c, ch) - (int)chan(lut[map[col[i].c]], ch));
+      if (e > *err) *err = e;
+    }
+  }
+  for (i = 0; i < n; ++i) idx[i] = map[im->px[i]];
+  return entries;
+}
+
+static uint8_t luma_dark(uint16_t c)
+{
+  return (uint8_t)(chan(c, 0) * 299u + chan(c, 1) * 587u + chan(c, 2) * 114u < 128000u);
+}
+
+/* ------------------- Indexed packing ------------------- */
+/* rows start on a byte, first pixel in the MSB, as GLCD_BitmapIdx reads */
+static size_t pack(const uint8_t *idx, unsigned w, unsigned h, unsigned bpp, int bottom_up, uint8_t *out)
+{
+  size_t stride = ((size_t)w * bpp + 7u) / 8u, x, y;
+
+  memset(out, 0, stride * h);
+  for (y = 0; y < h; ++y) {
+    uint8_t *row = out + (bottom_up ? h - 1u - y : y) * stride;
+    for (x = 0; x < w; ++x) row[x * bpp / 8u] |= (uint8_t)(idx[y * w + x] << (8u - bpp - x * bpp % 8u));
+  }
+  return stride * h;
+}
+
+/* the indices back, walked like GLCD_BitmapIdx does */
+static int unpack_matches(const uint8_t *data, unsigned w, unsigned h, unsigned bpp, int bottom_up, const uint8_t *idx)
+{
+  size_t stride = ((size_t)w * bpp + 7u) / 8u, x, y;
+  unsigned mask = (1u << bpp) - 1u;
+
+  for (y = 0; y < h; ++y) {
+    const uint8_t *row = data + (bottom_up ? h - 1u - y : y) * stride;
+    for (x = 0; x < w; ++x)
+      if (((row[x * bpp / 8u] >> (8u - bpp - x * bpp % 8u)) & mask) != idx[y * w + x]) return 0;
+  }
+  return 1;
+}
+
+/* ------------------- Output ------------------- */
+enum { F_RAW = 1, F_RLE = 2, F_IDX1 = 4, F_IDX2 = 8, F_IDX4 = 16, F_IDX8 = 32, F_MONO = 64 };
+
+static unsigned parse_formats(const char *list)
+{
+  static const struct { const char *name; unsigned bits; } fmt[] = {
+    { "raw", F_RAW }, { "rle", F_RLE }, { "both", F_RAW | F_RLE }, { "idx1", F_IDX1 },
+    { "idx2", F_IDX2 }, { "idx4", F_IDX4 }, { "idx8", F_IDX8 }, { "mono", F_MONO }
+  };
+  unsigned bits = 0, k;
+
+  while (*list) {
+    size_t len = strcspn(list, ",");
+    for (k = 0; k < sizeof fmt / sizeof fmt[0]; ++k)
+      if (strlen(fmt[k].name) == len && !strncmp(list, fmt[k].name, len)) break;
+    if (k == sizeof fmt / sizeof fmt[0]) return 0;
+    bits |= fmt[k].bits;
+    list += len + (list[len] == ',');
+  }
+  return bits;
+}
+
+static void write_bytes(FILE *f, const uint8_t *p, size_t n)
+{
+  size_t i;
+  for (i = 0; i < n; ++i) fprintf(f, "%s 0x%02X,", i % 16u ? "" : "\n ", p[i]);
+  fprintf(f, "\n};\n");
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = NULL, *card = NULL, *out = "image.h", *name = "image", *fmt = "both";
+  char upper[64], summary[1024];
+  image_t im;
+  uint8_t *buf, *idx;
+  uint16_t *back, lut[256];
+  size_t n, len, i, at = 0;
+  unsigned formats, bpp, err;
+  int bottom_up = 0;
+  FILE *f;
+
+  for (i = 1; i < (size_t)argc; ++i) {
+    if (!strcmp(argv[i], "-o") && i + 1u < (size_t)argc)      out  = argv[++i];
+    else if (!strcmp(argv[i], "-n") && i + 1u < (size_t)argc) name = argv[++i];
+    else if (!strcmp(argv[i], "-f") && i + 1u < (size_t)argc) fmt  = argv[++i];
+    else if (!strcmp(argv[i], "-t") && i + 1u < (size_t)argc) card = argv[++i];
+    else if (!strcmp(argv[i], "-u"))                          bottom_up = 1;
+    else if (argv[i][0] != '-' && !path)                      path = argv[i];
+    else { path = card = NULL; break; }
+  }
+  formats = parse_formats(fmt);
+  if (!path == !card || !formats || strlen(name) >= sizeof upper) {
+    fprintf(stderr, "usage: %s [-n name] [-f format,...] [-u] [-o image.h] image.ppm\n"
+                    "       %s [-n name] [-f format,...] [-u] [-o image.h] -t WxH\n"
+                    "formats: raw rle both idx1 idx2 idx4 idx8 mono\n", argv[0], argv[0]);
+    return 2;
+  }
+  if ((card ? test_card(card, &im) : load_ppm(path, &im)) != 0) return 1;
+
+  n    = (size_t)im.w * im.h;
+  buf  = malloc(RLE_B_BOUND(n));
+  back = malloc(n * sizeof *back);
+  idx  = malloc(n);
+  if (!buf || !back || !idx) { fprintf(stderr, "out of memory\n"); return 1; }
+  for (i = 0; name[i]; ++i) upper[i] = (char)toupper((unsigned char)name[i]);
+  upper[i] = '\0';
+
+  f = fopen(out, "w");
+  if (!f) { perror(out); return 1; }
+  fprintf(f, "/* COE718 Lab 3a - %ux%u image for the GLCD driver\n *\n", im.w, im.h);
+  fprintf(f, " * Generated by tools/img_gen.c, do not edit:\n *   img_gen");
+  for (i = 1; i < (size_t)argc; ++i) fprintf(f, " %s", argv[i]);
+  fprintf(f, "\n *\n");
+  summary[0] = '\0';
+
+#define SUMMARY(...) (at += (size_t)snprintf(summary + at, sizeof summary - at, __VA_ARGS__))
+  SUMMARY("raw RGB565  %6u bytes\n", (unsigned)(2u * n));
+  if (formats & F_RLE) {
+    len = rle_bitmap_encode(im.px, n, buf);
+    if (!len || rle_bitmap_decode(buf, len, back, n) != len || memcmp(back, im.px, n * sizeof *back)) {
+      fprintf(stderr, "RLE round trip failed\n");
+      return 1;
+    }
+    SUMMARY("rle         %6u bytes (%u%%)\n", (unsigned)len, (unsigned)(len * 100u / (2u * n)));
+  }
+  for (bpp = 1; bpp <= 8u; bpp *= 2u) {
+    unsigned entries;
+    if (!(formats & (F_IDX1 << (bpp == 1 ? 0 : bpp == 2 ? 1 : bpp == 4 ? 2 : 3)))) continue;
+    entries = quantize(&im, bpp, lut, idx, &err);
+    len = pack(idx, im.w, im.h, bpp, bottom_up, buf);
+    SUMMARY("idx%u        %6u bytes + %u palette (%u%%), %u colours", bpp, (unsigned)len,
+            2u * entries, (unsigned)((len + 2u * entries) * 100u / (2u * n)), entries);
+    if (err) SUMMARY(", worst channel error %u\n", err);
+    else     SUMMARY(", exact\n");
+  }
+  if (formats & F_MONO)
+    SUMMARY("mono        %6u bytes (%u%%)\n", (unsigned)((im.w + 7u) / 8u * im.h),
+            (unsigned)((im.w + 7u) / 8u * im.h * 100u / (2u * n)));
+  for (i = 0; summary[i]; ++i) fprintf(f, "%s%c", i == 0 || summary[i - 1] == '\n' ? " * " : "", summary[i]);
+  fprintf(f, " */\n");
+  fprintf(f, "#define %s_W  %u\n#define %s_H  %u\n", upper, im.w, upper, im.h);
+
+  if (formats & F_RAW) {
+    fprintf(f, "\n/* GLCD_Bitmap: rows bottom up */\nconst unsigned short %s[%u] = {", name, (unsigned)n);
+    for (i = 0; i < n; ++i) {
+      size_t y = im.h - 1u - i / im.w, x = i % im.w;
+      fprintf(f, "%s 0x%04X,", i % 12u ? "" : "\n ", im.px[y * im.w + x]);
+    }
+    fprintf(f, "\n};\n");
+  }
+  if (formats & F_RLE) {
+    len = rle_bitmap_encode(im.px, n, buf);
+    fprintf(f, "\n/* GLCD_BitmapRLE: glcd_rle.h stream, rows top down */\nconst unsigned char %s_rle[%u] = {", name, (unsigned)len);
+    write_bytes(f, buf, len);
+  }
+  for (bpp = 1; bpp <= 8u; bpp *= 2u) {
+    unsigned entries, k;
+    if (!(formats & (F_IDX1 << (bpp == 1 ? 0 : bpp == 2 ? 1 : bpp == 4 ? 2 : 3)))) continue;
+    entries = quantize(&im, bpp, lut, idx, &err);
+    len = pack(idx, im.w, im.h, bpp, bottom_up, buf);
+    if (!unpack_matches(buf, im.w, im.h, bpp, bottom_up, idx)) { fprintf(stderr, "idx%u round trip failed\n", bpp); return 1; }
+    fprintf(f, "\n/* GLCD_BitmapIdx: %u bpp, rows %s */\n", bpp, bottom_up ? "bottom up" : "top down");
+    fprintf(f, "#define %s_I%u_FMT  (GLCD_IDX%u%s)\n", upper, bpp, bpp, bottom_up ? " | GLCD_BOTTOM_UP" : "");
+    fprintf(f, "const unsigned short %s_i%u_lut[%u] = {", name, bpp, entries);
+    for (k = 0; k < entries; ++k) fprintf(f, "%s 0x%04X,", k % 12u ? "" : "\n ", lut[k]);
+    fprintf(f, "\n};\nconst unsigned char %s_i%u[%u] = {", name, bpp, (unsigned)len);
+    write_bytes(f, buf, len);
+  }
+  if (formats & F_MONO) {
+    for (i = 0; i < n; ++i) idx[i] = luma_dark(im.px[i]);
+    len = pack(idx, im.w, im.h, 1u, bottom_up, buf);
+    if (!unpack_matches(buf, im.w, im.h, 1u, bottom_up, idx)) { fprintf(stderr, "mono round trip failed\n"); return 1; }
+    fprintf(f, "\n/* GLCD_BitmapIdx, no palette: 1 = text colour, rows %s */\n", bottom_up ? "bottom up" : "top down");
+    fprintf(f, "#define %s_MONO_FMT  (GLCD_IDX1%s)\n", upper, bottom_up ? " | GLCD_BOTTOM_UP" : "");
+    fprintf(f, "const unsigned char %s_mono[%u] = {", name, (unsigned)len);
+    write_bytes(f, buf, len);
+  }
+  if (fclose(f) != 0) { perror(out); return 1; }
+
+  fprintf(stderr, "%ux%u:\n%s", im.w, im.h, summary);
+  free(buf);
+  free(back);
+  free(idx);
+  free(im.px);
+  return 0;
+}
@@ -0,0 +1,719 @@
+/* COE718 Lab 3a - RAM/flash usage from the armlink map file, with budgets
+ *
+ * Build:  cc -std=c99 -O2 -o map_report map_report.c
+ * Usage:  map_report [-b budgets] [-n top] [-j treemap.json] [-q] Listings/Lab3a_Demo.map
+ *         map_report -d old.map [-b budgets] [-n top] [-q] new.map
+ *
+ * Reads the "Memory Map of the image" (every input section with its
+ * address, size, kind and object) and the "Image Symbol Table" of an
+ * armlink --map --symbols listing.  Each Data/Code symbol is placed in
+ * the input section that contains its address, so per-object and
+ * per-symbol sizes always add up to the regions they sit in.  Prints
+ *
+ *   regions     every execution region, used / max; flash is the sum of
+ *               the load regions (code, RO data and RW initialisers),
+ *               RAM the sum of the regions that do not execute in place
+ *   objects     code, RO, RW and ZI bytes per object, biggest first
+ *   symbols     the biggest RAM and flash symbols
+ *   groups      named sets of symbols: thread stacks (mp_stk holds the
+ *               OS_STKSIZE stacks), fonts and the logging buffers by
+ *               default, or as the budget file defines them
+ *
+ * -d compares two builds instead: totals, then every object and symbol
+ * whose size changed, largest change first.
+ *
+ * -b applies a budget file; one limit per line, '#' comments, sizes in
+ * bytes with an optional K suffix:
+ *
+ *   flash                 64K
+ *   ram                   24K
+ *   region RW_IRAM1       30K
+ *   object thread2_demo.o 4K
+ *   symbol mp_stk         12K
+ *   group  stacks  16K    mp_stk os_stack_mem @STACK
+ *
+ * A group lists symbol names (with * and ? wildcards) or, after '@',
+ * section names; '-' as its limit only reports it.  Any limit exceeded
+ * makes the exit status 1, so the program can run as a uVision After
+ * Build user command.  -q prints only the totals and the budgets.
+ *
+ * -j writes the region/object/symbol hierarchy as {name, value, children}
+ * JSON, the input d3.treemap and most treemap viewers take; bytes of a
+ * section no symbol covers are an "(other <section>)" leaf.
+ *
+ * The file is read into memory once and tokenised in place: the default
+ * build's map parses in under a millisecond, a 20 MB map with 100k
+ * sections and symbols in about 0.1 s (timing on stderr without -q).
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define MR_MAX_TOK    12
+#define MR_MAX_GROUPS 16
+#define MR_MAX_PATS   16
+
+enum { K_CODE = 0, K_RO, K_RW, K_ZI, K_PAD, K_KINDS };
+
+typedef struct {
+  char    *name;
+  uint32_t base, load, size, max;
+  int      ram;                         /* does not execute in place */
+  size_t   row0, nrows;
+} region_t;
+
+typedef struct {
+  uint32_t addr, size;
+  uint8_t  kind;
+  int      region;
+  char    *sect, *obj;
+  uint32_t covered;                     /* by symbols */
+} row_t;
+
+typedef struct {
+  char    *name;
+  uint32_t addr, size;
+  long     row;                         /* containing section or -1 */
+} msym_t;
+
+typedef struct {
+  char    *name;
+  uint32_t b[K_KINDS];
+} obj_t;
+
+typedef struct {
+  char     *text;
+  region_t *reg;  size_t nreg;
+  row_t    *row;  size_t nrow;
+  msym_t   *sym;  size_t nsym;
+  obj_t    *obj;  size_t nobj, cap_obj;
+  uint32_t *ohash; size_t ocap;         /* object index + 1, open addressing */
+  uint64_t  flash, ram, lines;
+} map_t;
+
+typedef struct {
+  char    *name;
+  long long limit;                      /* -1: report only */
+  char    *pat[MR_MAX_PATS];
+  int      npat;
+} group_t;
+
+static group_t groups[MR_MAX_GROUPS];
+static int     ngroups;
+
+static void *grow(void *p, size_t n, size_t size)
+{
+  p = realloc(p, (n ? n : 1) * size);
+  if (!p) { fprintf(stderr, "out of memory\n"); exit(2); }
+  return p;
+}
+
+#define PUSH(arr, n, cap, val) do {                                       \
+    if ((n) == (cap)) { (cap) = (cap) ? 2 * (cap) : 256; (arr) = grow((arr), (cap), sizeof *(arr)); } \
+    (arr)[(n)++] = (val);                                                 \
+  } while (0)
+
+/* ------------------- Parsing ------------------- */
+static int tokenize(char *s, char **tok)
+{
+  int n = 0;
+  while (*s && n < MR_MAX_TOK) {
+    while (*s == ' ' || *s == '\t') ++s;
+    if (!*s) break;
+    tok[n++] = s;
+    while (*s && *s != ' ' && *s != '\t') ++s;
+    if (*s) *s++ = '\0';
+  }
+  return n;
+}
+
+static int is_hex(const char *s) { return s[0] == '0' && s[1] == 'x'; }
+
+static int is_num(const char *s)
+{
+  if (!*s) return 0;
+  for (; *s; ++s) if (*s < '0' || *s > '9') return 0;
+  return 1;
+}
+
+/* "Size: 0x00004570," after key in a region header */
+static uint32_t field(const char *line, const char *key)
+{
+  const char *p = strstr(line, key);
+  return p ? (uint32_t)strtoul(p + strlen(key), NULL, 16) : 0u;
+}
+
+static uint32_t fnv(const char *s)
+{
+  uint32_t h = 2166136261u;
+  while (*s) h = (h ^ (uint8_t)*s++) * 16777619u;
+  return h;
+}
+
+static obj_t *object(map_t *m, char *name)
+{
+  size_t i, cap;
+  uint32_t h;
+
+  if (2u * (m->nobj + 1u) > m->ocap) {            /* rehash at half full */
+    cap = m->ocap ? 2u * m->ocap : 256u;
+    free(m->ohash);
+    m->ohash = calloc(cap, sizeof *m->ohash);
+    if (!m->ohash) { fprintf(stderr, "out of memory\n"); exit(2); }
+    m->ocap = cap;
+    for (i = 0; i < m->nobj; ++i) {
+      h = fnv(m->obj[i].name);
+      while (m->ohash[h & (cap - 1u)]) ++h;
+      m->ohash[h & (cap - 1u)] = (uint32_t)i + 1u;
+    }
+  }
+  for (h = fnv(name); m->ohash[h & (m->ocap - 1u)]; ++h) {
+    obj_t *o = &m->obj[m->ohash[h & (m->ocap - 1u)] - 1u];
+    if (!strcmp(o->name, name)) return o;
+  }
+  {
+    obj_t o;
+    memset(&o, 0, sizeof o);
+    o.name = name;
+    PUSH(m->obj, m->nobj, m->cap_obj, o);
+    m->ohash[h & (m->ocap - 1u)] = (uint32_t)m->nobj;
+    return &m->obj[m->nobj - 1u];
+  }
+}
+
+static int cmp_row_addr(const void *a, const void *b)
+{
+  const row_t *x = (const row_t *)a, *y = (const row_t *)b;
+  return (x->addr > y->addr) - (x->addr < y->addr);
+}
+
+/* section containing addr, or -1 */
+static long row_find(const map_t *m, const long *order, uint32_t addr)
+{
+  size_t lo = 0, hi = m->nrow;
+  const row_t *r;
+
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2u;
+    if (m->row[order[mid]].addr <= addr) lo = mid + 1u;
+    else                                 hi = mid;
+  }
+  while (lo > 0) {                                 /* skip empty sections at addr */
+    r = &m->row[order[lo - 1u]];
+    if (addr < r->addr + r->size) return order[lo - 1u];
+    if (r->size || r->addr != addr) break;
+    --lo;
+  }
+  return -1;
+}
+
+static const row_t *sorted_rows;
+
+static int cmp_order(const void *a, const void *b)
+{
+  return cmp_row_addr(&sorted_rows[*(const long *)a], &sorted_rows[*(const long *)b]);
+}
+
+static int load_map(map_t *m, const char *path)
+{
+  enum { S_NONE, S_SYMS, S_MAP, S_DONE } state = S_NONE;
+  size_t cap_reg = 0, cap_row = 0, cap_sym = 0, len, i;
+  char *p, *end;
+  long *order;
+  FILE *f = fopen(path, "rb");
+
+  memset(m, 0, sizeof *m);
+  if (!f) return -1;
+  fseek(f, 0, SEEK_END);
+  len = (size_t)ftell(f);
+  rewind(f);
+  m->text = malloc(len + 1u);
+  if (!m->text || fread(m->text, 1, len, f) != len) { fclose(f); return -1; }
+  fclose(f);
+  m->text[len] = '\0';
+
+  for (p = m->text; p < m->text + len && state != S_DONE; p = end + 1) {
+    char *tok[MR_MAX_TOK];
+    int n;
+
+    end = memchr(p, '\n', (size_t)(m->text + len - p));
+    if (!end) end = m->text + len;
+    *end = '\0';
+    if (end > p && end[-1] == '\r') end[-1] = '\0';
+    m->lines++;
+
+    if (p[0] && p[0] != ' ') {                     /* section titles start in column 0 */
+      if (!strncmp(p, "Image Symbol Table", 18))            state = S_SYMS;
+      else if (!strncmp(p, "Memory Map of the image", 23))  state = S_MAP;
+      else if (!strncmp(p, "Image component sizes", 21))    state = S_DONE;
+      continue;
+    }
+    if (state == S_MAP && (strstr(p, "Load Region ") || strstr(p, "Execution Region "))) {
+      char *name = strstr(p, "Region ") + 7, *sp = strchr(name, ' ');
+      if (sp) *sp = '\0';
+      if (strstr(p, "Load Region ")) {
+        m->flash += field(sp ? sp + 1 : name, "Size: ");
+      } else {
+        region_t r;
+        const char *rest = sp + 1;
+        memset(&r, 0, sizeof r);
+        r.name = name;
+        r.base = field(rest, "Exec base: ");
+        r.load = field(rest, "Load base: ");
+        r.size = field(rest, "Size: ");
+        r.max  = field(rest, "Max: ");
+        r.ram  = r.base != r.load;
+        r.row0 = m->nrow;
+        if (r.ram) m->ram += r.size;
+        PUSH(m->reg, m->nreg, cap_reg, r);
+      }
+      continue;
+    }
+    n = tokenize(p, tok);
+    if (state == S_MAP && m->nreg && n >= 4 && is_hex(tok[0]) && is_hex(tok[2])) {
+      row_t r;
+      int k = 4;
+      memset(&r, 0, sizeof r);
+      r.addr   = (uint32_t)strtoul(tok[0], NULL, 16);
+      r.size   = (uint32_t)strtoul(tok[2], NULL, 16);
+      r.region = (int)m->nreg - 1;
+      if (!strcmp(tok[3], "PAD")) {
+        r.kind = K_PAD;
+        r.sect = r.obj = "(pad)";
+      } else {
+        if (n < 8) continue;
+        r.kind = !strcmp(tok[3], "Code") ? K_CODE : !strcmp(tok[3], "Zero") ? K_ZI :
+                 !strcmp(tok[4], "RW") ? K_RW : K_RO;
+        k = 6;                                     /* attr, idx */
+        if (!strcmp(tok[k], "*")) ++k;
+        if (k + 1 >= n) continue;
+        r.sect = tok[k];
+        r.obj  = tok[k + 1];
+      }
+      object(m, r.obj)->b[r.kind] += r.size;
+      PUSH(m->row, m->nrow, cap_row, r);
+      m->reg[m->nreg - 1].nrows++;
+    } else if (state == S_SYMS && n >= 5 && is_hex(tok[1])) {
+      msym_t s;
+      int t = 2;
+      if (!strcmp(tok[t], "Thumb") || !strcmp(tok[t], "ARM")) ++t;
+      if (strcmp(tok[t], "Code") && strcmp(tok[t], "Data")) continue;   /* Number, Section */
+      if (t + 1 >= n || !is_num(tok[t + 1])) continue;
+      s.name = tok[0];
+      s.addr = (uint32_t)strtoul(tok[1], NULL, 16) & ~1u;
+      s.size = (uint32_t)strtoul(tok[t + 1], NULL, 10);
+      s.row  = -1;
+      if (s.size) PUSH(m->sym, m->nsym, cap_sym, s);
+    }
+  }
+
+  /* place every symbol in its section */
+  order = grow(NULL, m->nrow, sizeof *order);
+  for (i = 0; i < m->nrow; ++i) order[i] = (long)i;
+  sorted_rows = m->row;
+  qsort(order, m->nrow, sizeof *order, cmp_order);
+  for (i = 0; i < m->nsym; ++i) {
+    msym_t *s = &m->sym[i];
+    s->row = row_find(m, order, s->addr);
+    if (s->row >= 0) m->row[s->row].covered += s->size;
+  }
+  free(order);
+  return m->nreg ? 0 : -1;
+}
+
+/* ------------------- Groups and budgets ------------------- */
+static int wild(const char *p, const char *s)
+{
+  if (!*p) return !*s;
+  if (*p == '*') return wild(p + 1, s) || (*s && wild(p, s + 1));
+  if (*s && (*p == '?' || *p == *s)) return wild(p + 1, s + 1);
+  return 0;
+}
+
+static long long parse_size(const char *s)
+{
+  char *e;
+  long long v = strtoll(s, &e, 0);
+  if (*e == 'K' || *e == 'k') v *= 1024;
+  return v;
+}
+
+/* pats is modified and kept */
+static void add_group(const char *name, long long limit, char *pats)
+{
+  group_t *g;
+  char *tok[MR_MAX_TOK];
+  int n, i;
+
+  if (ngroups == MR_MAX_GROUPS) return;
+  g = &groups[ngroups++];
+  g->name  = strdup(name);
+  g->limit = limit;
+  n = tokenize(pats, tok);
+  for (i = 0; i < n && i < MR_MAX_PATS; ++i) g->pat[g->npat++] = tok[i];
+}
+
+static const group_t *find_group(const char *name)
+{
+  int g;
+  for (g = 0; g < ngroups; ++g) if (!strcmp(groups[g].name, name)) return &groups[g];
+  return NULL;
+}
+
+static uint64_t group_bytes(const map_t *m, const group_t *g)
+{
+  uint64_t sum = 0;
+  size_t i;
+  int k;
+
+  for (i = 0; i < m->nsym; ++i)
+    for (k = 0; k < g->npat; ++k)
+      if (g->pat[k][0] != '@' && wild(g->pat[k], m->sym[i].name)) { sum += m->sym[i].size; break; }
+  for (i = 0; i < m->nrow; ++i)
+    for (k = 0; k < g->npat; ++k)
+      if (g->pat[k][0] == '@' && wild(g->pat[k] + 1, m->row[i].sect)) { sum += m->row[i].size; break; }
+  return sum;
+}
+
+static int check(const char *what, const char *name, uint64_t used, long long limit)
+{
+  int over = limit >= 0 && used > (uint64_t)limit;
+  printf("  %-7s %-24s %8llu / %-8lld %5.1f%%  %s\n", what, name, (unsigned long long)used, limit,
+         limit > 0 ? 100.0 * used / limit : 0.0, over ? "OVER" : "ok");
+  return over;
+}
+
+static int apply_budgets(const map_t *m, const char *path)
+{
+  char line[512];
+  int bad = 0;
+  FILE *f = fopen(path, "r");
+
+  if (!f) { perror(path); return 1; }
+  printf("\nbudgets (%s)\n", path);
+  while (fgets(line, sizeof line, f)) {
+    char *tok[MR_MAX_TOK], *c = strchr(line, '#');
+    int n;
+    size_t i;
+    if (c) *c = '\0';
+    line[strcspn(line, "\r\n")] = '\0';
+    n = tokenize(line, tok);
+    if (n == 2 && !strcmp(tok[0], "flash")) {
+      bad |= check("flash", "", m->flash, parse_size(tok[1]));
+    } else if (n == 2 && !strcmp(tok[0], "ram")) {
+      bad |= check("ram", "", m->ram, parse_size(tok[1]));
+    } else if (n == 3 && !strcmp(tok[0], "region")) {
+      uint64_t used = 0;
+      for (i = 0; i < m->nreg; ++i) if (!strcmp(m->reg[i].name, tok[1])) used = m->reg[i].size;
+      bad |= check("region", tok[1], used, parse_size(tok[2]));
+    } else if (n == 3 && !strcmp(tok[0], "object")) {
+      uint64_t used = 0;
+      for (i = 0; i < m->nobj; ++i)
+        if (wild(tok[1], m->obj[i].name)) used += m->obj[i].b[K_CODE] + m->obj[i].b[K_RO] + m->obj[i].b[K_RW] + m->obj[i].b[K_ZI];
+      bad |= check("object", tok[1], used, parse_size(tok[2]));
+    } else if (n == 3 && !strcmp(tok[0], "symbol")) {
+      uint64_t used = 0;
+      for (i = 0; i < m->nsym; ++i) if (wild(tok[1], m->sym[i].name)) used += m->sym[i].size;
+      bad |= check("symbol", tok[1], used, parse_size(tok[2]));
+    } else if (n >= 4 && !strcmp(tok[0], "group")) {
+      const group_t *g = find_group(tok[1]);   /* loaded by load_groups() */
+      if (g && g->limit >= 0) bad |= check("group", g->name, group_bytes(m, g), g->limit);
+    } else if (n) {
+      fprintf(stderr, "%s: ignored: %s\n", path, tok[0]);
+    }
+  }
+  fclose(f);
+  return bad;
+}
+
+/* the group lines of the budget file, or the default groups */
+static void load_groups(const char *path)
+{
+  static char defaults[3][80] = {
+    "mp_stk os_stack_mem *_stk @STACK @HEAP",
+    "Font_* font_sub_*",
+    "logger timeline g_trace g_blog g_prof g_tm* g_qs*"
+  };
+  char line[512];
+  FILE *f = path ? fopen(path, "r") : NULL;
+
+  while (f && fgets(line, sizeof line, f)) {
+    char *c = strchr(line, '#'), *p = line, *name, *limit;
+    if (c) *c = '\0';
+    line[strcspn(line, "\r\n")] = '\0';
+    p += strspn(p, " \t");
+    if (strncmp(p, "group", 5) || (p[5] != ' ' && p[5] != '\t')) continue;
+    p += 5 + strspn(p + 5, " \t");
+    name = p;
+    p += strcspn(p, " \t");
+    if (*p) *p++ = '\0';
+    p += strspn(p, " \t");
+    limit = p;
+    p += strcspn(p, " \t");
+    if (*p) *p++ = '\0';
+    if (*name && *limit && *p) add_group(name, strcmp(limit, "-") ? parse_size(limit) : -1, strdup(p));
+  }
+  if (f) fclose(f);
+  if (ngroups) return;
+  add_group("stacks",  -1, defaults[0]);
+  add_group("fonts",   -1, defaults[1]);
+  add_group("buffers", -1, defaults[2]);
+}
+
+/* ------------------- Reports ------------------- */
+static uint32_t obj_total(const obj_t *o) { return o->b[K_CODE] + o->b[K_RO] + o->b[K_RW] + o->b[K_ZI]; }
+
+static int cmp_obj(const void *a, const void *b)
+{
+  uint32_t x = obj_total((const obj_t *)a), y = obj_total((const obj_t *)b);
+  return (y > x) - (y < x);
+}
+
+static int cmp_sym_size(const void *a, const void *b)
+{
+  const msym_t *x = (const msym_t *)a, *y = (const msym_t *)b;
+  if (x->size != y->size) return (y->size > x->size) - (y->size < x->size);
+  return strcmp(x->name, y->name);
+}
+
+static void print_totals(const map_t *m)
+{
+  size_t i;
+
+  printf("flash %llu bytes, RAM %llu bytes\n", (unsigned long long)m->flash, (unsigned long long)m->ram);
+  for (i = 0; i < m->nreg; ++i) {
+    const region_t *r = &m->reg[i];
+    printf("  %-4s %-12s 0x%08x %8u / %-8u %5.1f%%\n", r->ram ? "RAM" : "ROM", r->name, (unsigned)r->base,
+           (unsigned)r->size, (unsigned)r->max, r->max ? 100.0 * r->size / r->max : 0.0);
+  }
+}
+
+static void report(map_t *m, unsigned top)
+{
+  uint32_t t[K_KINDS] = { 0 };
+  size_t i, n;
+  int g, ram;
+
+  qsort(m->obj, m->nobj, sizeof *m->obj, cmp_obj);   /* the hash is not used after parsing */
+  printf("\nobjects\n  %8s %8s %8s %8s %8s\n", "code", "ro", "rw", "zi", "pad");
+  for (i = 0; i < m->nobj; ++i) {
+    const obj_t *o = &m->obj[i];
+    int k;
+    for (k = 0; k < K_KINDS; ++k) t[k] += o->b[k];
+    if (i >= top || !strcmp(o->name, "(pad)")) continue;
+    printf("  %8u %8u %8u %8u %8s  %s\n", (unsigned)o->b[K_CODE], (unsigned)o->b[K_RO],
+           (unsigned)o->b[K_RW], (unsigned)o->b[K_ZI], "", o->name);
+  }
+  if (m->nobj > top) printf("  (%zu more)\n", m->nobj - top);
+  printf("  %8u %8u %8u %8u %8u  total\n", (unsigned)t[K_CODE], (unsigned)t[K_RO], (unsigned)t[K_RW],
+         (unsigned)t[K_ZI], (unsigned)t[K_PAD]);
+
+  qsort(m->sym, m->nsym, sizeof *m->sym, cmp_sym_size);
+  for (ram = 1; ram >= 0; --ram) {
+    printf("\n%s symbols\n", ram ? "RAM" : "flash");
+    for (i = 0, n = 0; i < m->nsym && n < top; ++i) {
+      const msym_t *s = &m->sym[i];
+      if (s->row < 0 || m->reg[m->row[s->row].region].ram != ram) continue;
+      printf("  %8u  0x%08x  %-32s %s\n", (unsigned)s->size, (unsigned)s->addr, s->name, m->row[s->row].obj);
+      n++;
+    }
+  }
+
+  printf("\ngroups\n");
+  for (g = 0; g < ngroups; ++g) {
+    int k;
+    printf("  %8llu  %-10s", (unsigned long long)group_bytes(m, &groups[g]), groups[g].name);
+    for (k = 0; k < groups[g].npat; ++k) printf(" %s", groups[g].pat[k]);
+    printf("\n");
+  }
+}
+
+/* ------------------- Diff ------------------- */
+static int cmp_name_obj(const void *a, const void *b) { return strcmp(((const obj_t *)a)->name, ((const obj_t *)b)->name); }
+static int cmp_name_sym(const void *a, const void *b) { return strcmp(((const msym_t *)a)->name, ((const msym_t *)b)->name); }
+
+typedef struct { const char *name; long long old, cur; } delta_t;
+
+static int cmp_delta(const void *a, const void *b)
+{
+  const delta_t *x = (const delta_t *)a, *y = (const delta_t *)b;
+  long long dx = llabs(x->cur - x->old), dy = llabs(y->cur - y->old);
+  if (dx != dy) return (dy > dx) - (dy < dx);
+  return strcmp(x->name, y->name);
+}
+
+static void print_deltas(const char *title, delta_t *d, size_t n, unsigned top)
+{
+  size_t i;
+  qsort(d, n, sizeof *d, cmp_delta);
+  printf("\n%s: %zu changed\n", title, n);
+  for (i = 0; i < n && i < top; ++i)
+    printf("  %+8lld  %8lld -> %-8lld %s\n", d[i].cur - d[i].old, d[i].old, d[i].cur, d[i].name);
+  if (n > top) printf("  (%zu more)\n", n - top);
+}
+
+/* merge two name-sorted arrays; a name missing on one side counts 0 */
+#define MERGE(A, NA, B, NB, SIZE, OUT, NOUT, CAP) do {                              \
+    size_t ia = 0, ib = 0;                                                         \
+    while (ia < (NA) || ib < (NB)) {                                               \
+      int c = ia == (NA) ? 1 : ib == (NB) ? -1 : strcmp((A)[ia].name, (B)[ib].name); \
+      delta_t dl;                                                                  \
+      dl.name = c <= 0 ? (A)[ia].name : (B)[ib].name;                              \
+      dl.old  = c <= 0 ? (long long)SIZE(&(A)[ia]) : 0;                            \
+      dl.cur  = c >= 0 ? (long long)SIZE(&(B)[ib]) : 0;                            \
+      if (c <= 0) ++ia;                                                            \
+      if (c >= 0) ++ib;                                                            \
+      if (dl.old != dl.cur) PUSH(OUT, NOUT, CAP, dl);                              \
+    }                                                                              \
+  } while (0)
+
+#define SYM_SIZE(s) ((s)->size)
+
+static void diff(map_t *a, map_t *b, unsigned top)
+{
+  delta_t *d = NULL;
+  size_t n = 0, cap = 0;
+
+  printf("flash %llu -> %llu (%+lld), RAM %llu -> %llu (%+lld)\n",
+         (unsigned long long)a->flash, (unsigned long long)b->flash, (long long)b->flash - (long long)a->flash,
+         (unsigned long long)a->ram, (unsigned long long)b->ram, (long long)b->ram - (long long)a->ram);
+  qsort(a->obj, a->nobj, sizeof *a->obj, cmp_name_obj);
+  qsort(b->obj, b->nobj, sizeof *b->obj, cmp_name_obj);
+  MERGE(a->obj, a->nobj, b->obj, b->nobj, obj_total, d, n, cap);
+  print_deltas("objects", d, n, top);
+  n = 0;
+  qsort(a->sym, a->nsym, sizeof *a->sym, cmp_name_sym);
+  qsort(b->sym, b->nsym, sizeof *b->sym, cmp_name_sym);
+  MERGE(a->sym, a->nsym, b->sym, b->nsym, SYM_SIZE, d, n, cap);
+  print_deltas("symbols", d, n, top);
+  free(d);
+}
+
+/* ------------------- Treemap ------------------- */
+static void json_str(FILE *f, const char *s)
+{
+  fputc('"', f);
+  for (; *s; ++s) {
+    if (*s == '"' || *s == '\\') fputc('\\', f);
+    if ((unsigned char)*s >= 0x20) fputc(*s, f);
+  }
+  fputc('"', f);
+}
+
+static int cmp_sym_row(const void *a, const void *b)
+{
+  const msym_t *x = (const msym_t *)a, *y = (const msym_t *)b;
+  if (x->row != y->row) return (x->row > y->row) - (x->row < y->row);
+  return (x->addr > y->addr) - (x->addr < y->addr);
+}
+
+static const row_t *tm_rows;
+
+static int cmp_row_obj(const void *a, const void *b)
+{
+  long x = *(const long *)a, y = *(const long *)b;
+  int c = strcmp(tm_rows[x].obj, tm_rows[y].obj);
+  return c ? c : (x > y) - (x < y);
+}
+
+/* region -> object -> symbol, one leaf per symbol and an "(other)" leaf
+   per section for the bytes no symbol covers */
+static int treemap(map_t *m, const char *path)
+{
+  size_t *first = grow(NULL, m->nrow + 1u, sizeof *first);
+  long *idx = grow(NULL, m->nrow, sizeof *idx);
+  size_t ri, i, s;
+  FILE *f = fopen(path, "w");
+
+  if (!f) { perror(path); return 1; }
+  qsort(m->sym, m->nsym, sizeof *m->sym, cmp_sym_row);
+  for (i = 0, s = 0; i <= m->nrow; ++i) {          /* symbols of row i: first[i] .. first[i+1] */
+    while (s < m->nsym && m->sym[s].row < (long)i) ++s;
+    first[i] = s;
+  }
+  tm_rows = m->row;
+
+  fprintf(f, "{\"name\":\"image\",\"children\":[");
+  for (ri = 0; ri < m->nreg; ++ri) {
+    const region_t *r = &m->reg[ri];
+    size_t k, nobj = 0;
+    for (k = 0; k < r->nrows; ++k) idx[k] = (long)(r->row0 + k);
+    qsort(idx, r->nrows, sizeof *idx, cmp_row_obj);
+    fprintf(f, "%s\n {\"name\":", ri ? "," : "");
+    json_str(f, r->name);
+    fprintf(f, ",\"ram\":%d,\"children\":[", r->ram);
+    for (k = 0; k < r->nrows; ) {
+      const char *obj = m->row[idx[k]].obj;
+      int leaves = 0;
+      fprintf(f, "%s\n  {\"name\":", nobj++ ? "," : "");
+      json_str(f, obj);
+      fprintf(f, ",\"children\":[");
+      for (; k < r->nrows && !strcmp(m->row[idx[k]].obj, obj); ++k) {
+        const row_t *w = &m->row[idx[k]];
+        for (s = first[idx[k]]; s < first[idx[k] + 1]; ++s) {
+          fprintf(f, "%s{\"name\":", leaves++ ? "," : "");
+          json_str(f, m->sym[s].name);
+          fprintf(f, ",\"value\":%u}", (unsigned)m->sym[s].size);
+        }
+        if (w->size > w->covered) {
+          fprintf(f, "%s{\"name\":\"(other %s)\",\"value\":%u}", leaves++ ? "," : "",
+                  w->sect, (unsigned)(w->size - w->covered));
+        }
+      }
+      fprintf(f, "]}");
+    }
+    fprintf(f, "]}");
+  }
+  fprintf(f, "\n]}\n");
+  free(first);
+  free(idx);
+  return fclose(f) ? 1 : 0;
+}
+
+/* ------------------- Main ------------------- */
+int main(int argc, char **argv)
+{
+  static map_t a, b;
+  const char *path = NULL, *old = NULL, *budgets = NULL, *json = NULL;
+  unsigned top = 20;
+  int i, quiet = 0, bad = 0;
+  struct timespec t0, t1;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-b") && i + 1 < argc)      budgets = argv[++i];
+    else if (!strcmp(argv[i], "-d") && i + 1 < argc) old     = argv[++i];
+    else if (!strcmp(argv[i], "-j") && i + 1 < argc) json    = argv[++i];
+    else if (!strcmp(argv[i], "-n") && i + 1 < argc) top     = (unsigned)atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-q"))                 quiet   = 1;
+    else if (argv[i][0] != '-' && !path)             path    = argv[i];
+    else { path = NULL; break; }
+  }
+  if (!path) {
+    fprintf(stderr, "usage: %s [-b budgets] [-n top] [-j treemap.json] [-q] file.map\n"
+                    "       %s -d old.map [-b budgets] [-n top] [-q] new.map\n", argv[0], argv[0]);
+    return 2;
+  }
+  load_groups(budgets);
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  if (old && load_map(&a, old) != 0) { fprintf(stderr, "%s: not an armlink map\n", old); return 2; }
+  if (load_map(&b, path) != 0)       { fprintf(stderr, "%s: not an armlink map\n", path); return 2; }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  if (!quiet)
+    fprintf(stderr, "# %llu lines, %zu sections, %zu symbols parsed in %.2f ms\n",
+            (unsigned long long)(a.lines + b.lines), a.nrow + b.nrow, a.nsym + b.nsym,
+            (t1.tv_sec - t0.tv_sec) * 1e3 + (t1.tv_nsec - t0.tv_nsec) / 1e6);
+
+  if (old) {
+    diff(&a, &b, top);
+  } else {
+    print_totals(&b);
+    if (json) bad |= treemap(&b, json);
+    if (!quiet) report(&b, top);
+  }
+  if (budgets) bad |= apply_budgets(&b, budgets);
+  return bad;
+}
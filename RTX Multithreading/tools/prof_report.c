@@ -0,0 +1,314 @@
+/* COE718 Lab 3a - flat profiles and folded stacks from a g_prof dump
+ *
+ * Build:  cc -std=c99 -O2 -I.. -Ihost -o prof_report prof_report.c
+ * Usage:  prof_report [-n top] [-T thread] [-a function] [-f out.folded]
+ *                     prof.{hex,bin} [Objects/Lab3a_Demo.axf]
+ *
+ * Reads the profile.h sample table (the dump may cover more RAM than
+ * g_prof; the table is found by its magic) and symbolises every sampled
+ * pc against the function symbols of the .axf.  Without the .axf, or for
+ * addresses outside every function, the raw address is shown.  Prints
+ *
+ *   flat        self samples per function over all contexts
+ *   contexts    samples per thread (trace.h name), "other" for
+ *               unregistered threads and the RTX idle demon, and one
+ *               line per interrupted handler; then the top functions of
+ *               each context
+ *
+ * -T limits everything to one context, -n sets the rows per table
+ * (default 15).  -a function lists the sampled instructions inside that
+ * function, offset by offset, to see where its cycles go.  -f writes
+ * folded stacks, "context;caller;function count", for flamegraph.pl or
+ * speedscope.  The caller comes from the sampled LR, which is only
+ * meaningful when the pc was in a leaf: when it resolves to the pc's own
+ * function (a non-leaf whose LR is stale) the frame is left out.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "profile.h"
+#include "dump_image.h"
+
+#define PR_NAME_MAX  64
+
+/* ------------------- Symbols ------------------- */
+typedef struct {
+  uint32_t addr, size;
+  char    *name;
+} sym_t;
+
+static sym_t  *syms;
+static size_t  nsyms;
+
+static int cmp_sym(const void *a, const void *b)
+{
+  const sym_t *x = (const sym_t *)a, *y = (const sym_t *)b;
+  if (x->addr != y->addr) return (x->addr > y->addr) - (x->addr < y->addr);
+  return (y->size > x->size) - (y->size < x->size);   /* sized first */
+}
+
+/* ELF32 little-endian: STT_FUNC symbols of .symtab */
+static int load_elf(const char *path)
+{
+  size_t len = 0, i;
+  uint8_t *f;
+  uint32_t shoff, shentsize, shnum;
+  FILE *fp = fopen(path, "rb");
+
+  if (!fp) return -1;
+  fseek(fp, 0, SEEK_END);
+  len = (size_t)ftell(fp);
+  rewind(fp);
+  f = malloc(len ? len : 1);
+  if (!f || fread(f, 1, len, fp) != len) { fclose(fp); free(f); return -1; }
+  fclose(fp);
+  if (len < 52 || memcmp(f, "\177ELF", 4) || f[4] != 1 || f[5] != 1) { free(f); return -1; }
+
+  shoff     = rd32(f + 32);
+  shentsize = rd16(f + 46);
+  shnum     = rd16(f + 48);
+  if (shentsize < 40 || (uint64_t)shoff + (uint64_t)shnum * shentsize > len) { free(f); return -1; }
+  for (i = 0; i < shnum; ++i) {
+    const uint8_t *sh = f + shoff + i * shentsize, *st;
+    uint32_t off, size, link, entsize, k;
+    if (rd32(sh + 4) != 2u) continue;   /* SHT_SYMTAB */
+    off = rd32(sh + 16); size = rd32(sh + 20); link = rd32(sh + 24); entsize = rd32(sh + 36);
+    if (link >= shnum || entsize < 16 || (uint64_t)off + size > len) continue;
+    st = f + shoff + link * shentsize;
+    for (k = 0; k + entsize <= size; k += entsize) {
+      const uint8_t *s = f + off + k;
+      uint32_t name = rd32(s), str = rd32(st + 16), strsz = rd32(st + 20);
+      if ((s[12] & 0xFu) != 2u || rd16(s + 14) == 0u || name >= strsz || (uint64_t)str + strsz > len) continue;
+      syms = realloc(syms, (nsyms + 1) * sizeof *syms);
+      if (!syms) { fprintf(stderr, "out of memory\n"); exit(1); }
+      syms[nsyms].addr = rd32(s + 4) & ~1u;
+      syms[nsyms].size = rd32(s + 8);
+      syms[nsyms].name = strdup((const char *)f + str + name);
+      nsyms++;
+    }
+  }
+  free(f);
+  qsort(syms, nsyms, sizeof *syms, cmp_sym);
+  return 0;
+}
+
+/* function containing a, or NULL; a symbol without a size reaches up to
+   the next one */
+static const sym_t *sym_find(uint32_t a)
+{
+  size_t lo = 0, hi = nsyms;
+  const sym_t *s;
+
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2u;
+    if (syms[mid].addr <= a) lo = mid + 1u;
+    else                     hi = mid;
+  }
+  if (lo == 0) return NULL;
+  s = &syms[lo - 1];
+  while (s > syms && s[-1].addr == s->addr) --s;      /* the sized alias */
+  if (s->size) return a < s->addr + s->size ? s : NULL;
+  return lo < nsyms ? s : NULL;
+}
+
+static void addr_name(uint32_t a, char *out)
+{
+  const sym_t *s = sym_find(a);
+  if (s) snprintf(out, PR_NAME_MAX, "%s", s->name);
+  else   snprintf(out, PR_NAME_MAX, "0x%08x", (unsigned)a);
+}
+
+/* ------------------- Contexts ------------------- */
+static const char *const lpc_irq[] = {
+  "WDT", "TIMER0", "TIMER1", "TIMER2", "TIMER3", "UART0", "UART1", "UART2", "UART3",
+  "PWM1", "I2C0", "I2C1", "I2C2", "SPI", "SSP0", "SSP1", "PLL0", "RTC",
+  "EINT0", "EINT1", "EINT2", "EINT3", "ADC", "BOD", "USB", "CAN", "DMA", "I2S",
+  "ENET", "RIT", "MCPWM", "QEI", "PLL1", "USBActivity", "CANActivity"
+};
+
+static char tnames[TRACE_MAX_THREADS][TRACE_NAME_LEN + 1];
+
+static void ctx_name(unsigned ctx, char *out)
+{
+  unsigned x = ctx & 0x1FFu;
+
+  if (ctx & PF_CTX_ISR) {
+    if (x >= 16u && x - 16u < sizeof lpc_irq / sizeof lpc_irq[0]) snprintf(out, PR_NAME_MAX, "[%s]", lpc_irq[x - 16u]);
+    else if (x == 11u) snprintf(out, PR_NAME_MAX, "[SVC]");
+    else if (x == 14u) snprintf(out, PR_NAME_MAX, "[PendSV]");
+    else if (x == 15u) snprintf(out, PR_NAME_MAX, "[SysTick]");
+    else               snprintf(out, PR_NAME_MAX, "[exc%u]", x);
+  } else if (ctx == PF_CTX_OTHER) {
+    snprintf(out, PR_NAME_MAX, "other");
+  } else if (ctx < TRACE_MAX_THREADS && tnames[ctx][0]) {
+    snprintf(out, PR_NAME_MAX, "%s", tnames[ctx]);
+  } else {
+    snprintf(out, PR_NAME_MAX, "t%u", ctx);
+  }
+}
+
+/* ------------------- Aggregation ------------------- */
+typedef struct {
+  char     key[3 * PR_NAME_MAX];
+  uint64_t count;
+} row_t;
+
+typedef struct {
+  row_t  *r;
+  size_t  n;
+} table_t;
+
+static void tab_add(table_t *t, const char *key, uint64_t count)
+{
+  size_t i;
+  for (i = 0; i < t->n; ++i) {
+    if (!strcmp(t->r[i].key, key)) { t->r[i].count += count; return; }
+  }
+  t->r = realloc(t->r, (t->n + 1) * sizeof *t->r);
+  if (!t->r) { fprintf(stderr, "out of memory\n"); exit(1); }
+  snprintf(t->r[t->n].key, sizeof t->r[t->n].key, "%s", key);
+  t->r[t->n].count = count;
+  t->n++;
+}
+
+static int cmp_row(const void *a, const void *b)
+{
+  const row_t *x = (const row_t *)a, *y = (const row_t *)b;
+  if (x->count != y->count) return (y->count > x->count) - (y->count < x->count);
+  return strcmp(x->key, y->key);
+}
+
+static void tab_print(table_t *t, const char *title, uint64_t total, unsigned top)
+{
+  uint64_t cum = 0;
+  size_t i;
+
+  qsort(t->r, t->n, sizeof *t->r, cmp_row);
+  printf("\n%s\n  %10s %7s %7s\n", title, "samples", "%", "cum %");
+  for (i = 0; i < t->n && i < top; ++i) {
+    cum += t->r[i].count;
+    printf("  %10llu %6.2f%% %6.2f%%  %s\n", (unsigned long long)t->r[i].count,
+           100.0 * t->r[i].count / total, 100.0 * cum / total, t->r[i].key);
+  }
+  if (t->n > top) printf("  %10s (%zu more)\n", "", t->n - top);
+}
+
+/* ------------------- Main ------------------- */
+static const uint8_t *find_prof(const uint8_t *img, size_t len)
+{
+  size_t off;
+  for (off = 0; off + 24u <= len; off += 4u) {
+    const uint8_t *p = img + off;
+    if (rd32(p) == PF_MAGIC && rd32(p + 8) == 16u && (rd32(p + 4) & (rd32(p + 4) - 1u)) == 0u &&
+        off + 24u + TRACE_MAX_THREADS * TRACE_NAME_LEN + (size_t)rd32(p + 4) * 16u <= len)
+      return p;
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv)
+{
+  const char *dump = NULL, *axf = NULL, *folded = NULL, *annotate = NULL, *only = NULL;
+  table_t flat = { 0, 0 }, ctxs = { 0, 0 }, stacks = { 0, 0 }, inside = { 0, 0 };
+  table_t per[PF_CTX_ISR + 0x200u];
+  const uint8_t *p, *bins;
+  uint8_t *img;
+  uint32_t nbins, period, samples, dropped, used = 0, k;
+  uint64_t total = 0;
+  unsigned top = 15, t;
+  size_t len = 0;
+  int i;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc)      top      = (unsigned)atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-T") && i + 1 < argc) only     = argv[++i];
+    else if (!strcmp(argv[i], "-a") && i + 1 < argc) annotate = argv[++i];
+    else if (!strcmp(argv[i], "-f") && i + 1 < argc) folded   = argv[++i];
+    else if (argv[i][0] != '-' && !dump)             dump     = argv[i];
+    else if (argv[i][0] != '-' && !axf)              axf      = argv[i];
+    else { dump = NULL; break; }
+  }
+  if (!dump) {
+    fprintf(stderr, "usage: %s [-n top] [-T thread] [-a function] [-f out.folded] prof.{hex,bin} [app.axf]\n", argv[0]);
+    return 2;
+  }
+  img = load_dump(dump, &len);
+  p   = img ? find_prof(img, len) : NULL;
+  if (!p) { fprintf(stderr, "%s: no g_prof table in the dump\n", dump); return 1; }
+  if (axf && load_elf(axf) != 0) { fprintf(stderr, "%s: not an ELF32 file\n", axf); return 1; }
+
+  nbins   = rd32(p + 4);
+  period  = rd32(p + 12);
+  samples = rd32(p + 16);
+  dropped = rd32(p + 20);
+  for (t = 0; t < TRACE_MAX_THREADS; ++t) memcpy(tnames[t], p + 24 + t * TRACE_NAME_LEN, TRACE_NAME_LEN);
+  bins = p + 24 + TRACE_MAX_THREADS * TRACE_NAME_LEN;
+  memset(per, 0, sizeof per);
+
+  for (k = 0; k < nbins; ++k) {
+    const uint8_t *b = bins + (size_t)k * 16u;
+    uint32_t pc = rd32(b), lr = rd32(b + 4), count = rd32(b + 8);
+    unsigned ctx = rd16(b + 12) & 0x3FFu;
+    char fn[PR_NAME_MAX], caller[PR_NAME_MAX], cn[PR_NAME_MAX], line[3 * PR_NAME_MAX];
+    const sym_t *s;
+
+    if (!count) continue;
+    used++;
+    ctx_name(ctx, cn);
+    if (only && strcmp(only, cn)) continue;
+    addr_name(pc, fn);
+    total += count;
+    tab_add(&flat, fn, count);
+    tab_add(&ctxs, cn, count);
+    tab_add(&per[ctx], fn, count);
+
+    caller[0] = '\0';
+    if (lr >= 2u && lr < 0xF0000000u) {
+      addr_name((lr & ~1u) - 2u, caller);   /* inside the BL that returns there */
+      if (!strcmp(caller, fn)) caller[0] = '\0';
+    }
+    if (caller[0]) snprintf(line, sizeof line, "%s;%s;%s", cn, caller, fn);
+    else           snprintf(line, sizeof line, "%s;%s", cn, fn);
+    tab_add(&stacks, line, count);
+
+    if (annotate && !strcmp(annotate, fn) && (s = sym_find(pc)) != NULL) {
+      snprintf(line, sizeof line, "%s+0x%04x  (0x%08x)", fn, (unsigned)(pc - s->addr), (unsigned)pc);
+      tab_add(&inside, line, count);
+    }
+  }
+
+  printf("# %u samples every ~%u us (%.3f s), %u dropped, %u/%u bins used, %zu symbols\n",
+         samples, period, samples * period / 1e6, dropped, used, nbins, nsyms);
+  if (!total) { printf("no samples\n"); return 0; }
+
+  tab_print(&flat, "flat profile (self)", total, top);
+  tab_print(&ctxs, "contexts", total, top);
+  for (t = 0; t < sizeof per / sizeof per[0]; ++t) {
+    char cn[PR_NAME_MAX], title[2 * PR_NAME_MAX];
+    uint64_t n = 0;
+    size_t r;
+    if (!per[t].n) continue;
+    for (r = 0; r < per[t].n; ++r) n += per[t].r[r].count;
+    ctx_name(t, cn);
+    snprintf(title, sizeof title, "%s: %llu samples", cn, (unsigned long long)n);
+    tab_print(&per[t], title, n, top);
+  }
+  if (annotate) {
+    uint64_t n = 0;
+    size_t r;
+    for (r = 0; r < inside.n; ++r) n += inside.r[r].count;
+    if (n) tab_print(&inside, annotate, n, (unsigned)inside.n);
+    else   printf("\n%s: no samples\n", annotate);
+  }
+  if (folded) {
+    FILE *f = fopen(folded, "w");
+    size_t r;
+    if (!f) { perror(folded); return 1; }
+    qsort(stacks.r, stacks.n, sizeof *stacks.r, cmp_row);
+    for (r = 0; r < stacks.n; ++r) fprintf(f, "%s %llu\n", stacks.r[r].key, (unsigned long long)stacks.r[r].count);
+    fclose(f);
+  }
+  free(img);
+  return 0;
+}
@@ -0,0 +1,254 @@
+/* COE718 Lab 3a - checks the qstat.h streaming statistics against exact values
+ *
+ * Build:  cc -std=c99 -O2 -DQS_HOST -I.. -Ihost -o qstat_check qstat_check.c ../qstat.c trace_file.c -lm
+ * Usage:  qstat_check [-c core_hz] trace.{trf,hex,bin}
+ *         qstat_check -g samples [-s seed]
+ *
+ * Rebuilds the qstat.h metrics from the events of a recorded trace
+ * (indexed trace file or g_trace dump), the same intervals the target
+ * hooks measure:
+ *
+ *   sig_wake   SIGNAL_SET to the receiver's next SIGNAL_WAKE
+ *   activate   PT_RELEASE to PT_START of the same task
+ *   lcd_draw   LCD_BEGIN to LCD_END on one thread
+ *   mtx_wait   MUTEX_WAIT to MUTEX_ACQUIRE on one thread
+ *
+ * and feeds each sample both to the target's qs_update() and to a plain
+ * array.  Count, min, max, mean and variance must match the exact values
+ * to the cycle (the program fails otherwise); for every quantile it
+ * prints the exact nearest-rank value, the P-square estimate, their
+ * difference and the rank error, F(estimate) - p in percentage points,
+ * which is what matters for a tail.
+ *
+ * -g replaces the trace with that many samples from each of four
+ * synthetic distributions (uniform, shifted exponential, log-normal,
+ * bimodal) of scheduler-like latencies in cycles.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "qstat.h"
+#include "trace_model.h"
+#include "trace_file.h"
+#include "dump_image.h"
+
+typedef struct {
+  const char *name;
+  uint32_t   *v;
+  size_t      n, cap;
+  qs_metric_t m;
+} series_t;
+
+static series_t series[QS_METRICS];
+
+static void sample(unsigned id, uint32_t cycles)
+{
+  series_t *s = &series[id];
+  if (s->n == s->cap) {
+    s->cap = s->cap ? 2u * s->cap : 4096u;
+    s->v   = realloc(s->v, s->cap * sizeof *s->v);
+    if (!s->v) { fprintf(stderr, "out of memory\n"); exit(1); }
+  }
+  s->v[s->n++] = cycles > QS_VALUE_MAX ? QS_VALUE_MAX : cycles;
+  qs_update(&s->m, cycles);
+}
+
+/* ------------------- Intervals from trace events ------------------- */
+typedef struct {
+  uint64_t set_at[TRACE_MAX_THREADS];   /* last SIGNAL_SET per receiver */
+  uint64_t release[256];                /* per periodic task */
+  uint64_t lcd[TRACE_MAX_THREADS], wait[TRACE_MAX_THREADS];
+  uint32_t set_ok, lcd_ok, wait_ok;     /* bit per slot */
+  uint8_t  rel_ok[256];
+} intervals_t;
+
+static void on_event(const trace_ev_t *e, void *ctx)
+{
+  intervals_t *iv = (intervals_t *)ctx;
+  unsigned t = e->thread, a = e->arg & 0xFFu;
+  uint32_t bit = t < TRACE_MAX_THREADS ? 1uL << t : 0u;
+
+  switch (e->ev) {
+    case TR_SIGNAL_SET:
+      if (a < TRACE_MAX_THREADS) { iv->set_at[a] = e->ts; iv->set_ok |= 1uL << a; }
+      break;
+    case TR_SIGNAL_WAKE:
+      if (iv->set_ok & bit) { iv->set_ok &= ~bit; sample(QS_SIG_WAKE, (uint32_t)(e->ts - iv->set_at[t])); }
+      break;
+    case TR_PT_RELEASE:
+      iv->release[a] = e->ts;
+      iv->rel_ok[a]  = 1u;
+      break;
+    case TR_PT_START:
+      if (iv->rel_ok[a]) { iv->rel_ok[a] = 0u; sample(QS_ACTIVATION, (uint32_t)(e->ts - iv->release[a])); }
+      break;
+    case TR_LCD_BEGIN:
+      if (bit) { iv->lcd[t] = e->ts; iv->lcd_ok |= bit; }
+      break;
+    case TR_LCD_END:
+      if (iv->lcd_ok & bit) { iv->lcd_ok &= ~bit; sample(QS_LCD_DRAW, (uint32_t)(e->ts - iv->lcd[t])); }
+      break;
+    case TR_MUTEX_WAIT:
+      if (bit) { iv->wait[t] = e->ts; iv->wait_ok |= bit; }
+      break;
+    case TR_MUTEX_ACQUIRE:
+      if (iv->wait_ok & bit) { iv->wait_ok &= ~bit; sample(QS_MUTEX_WAIT, (uint32_t)(e->ts - iv->wait[t])); }
+      break;
+    default:
+      break;
+  }
+}
+
+static int read_trace(const char *path)
+{
+  static intervals_t iv;
+  static tf_reader_t r;
+  static trace_names_t names;
+  long long n;
+
+  if (tf_open(&r, path) == 0) {
+    n = tf_scan(&r, 0, UINT64_MAX, TF_ALL_THREADS, on_event, &iv);
+    tf_close(&r);
+  } else {
+    size_t len = 0;
+    uint8_t *img = load_dump(path, &len);
+    n = img ? trace_ring_read(img, len, &names, on_event, &iv) : -1;
+    free(img);
+  }
+  if (n < 0) { fprintf(stderr, "%s: not a trace file or g_trace dump\n", path); return -1; }
+  printf("# %lld events\n", n);
+  return 0;
+}
+
+/* ------------------- Synthetic samples ------------------- */
+static uint64_t rng = 88172645463325252ull;
+
+static double uniform(void)
+{
+  rng ^= rng << 13;
+  rng ^= rng >> 7;
+  rng ^= rng << 17;
+  return ((rng >> 11) + 0.5) / 9007199254740992.0;
+}
+
+static double normal(void)
+{
+  return sqrt(-2.0 * log(uniform())) * cos(6.283185307179586 * uniform());
+}
+
+static void generate(uint64_t n)
+{
+  static const char *const what[QS_METRICS] = {
+    "uniform 1000..5000", "2000 + exponential, mean 3000",
+    "log-normal, median 20000, sigma 0.8", "bimodal 90% N(3000,300) + 10% N(40000,4000)"
+  };
+  uint64_t k;
+  unsigned id;
+
+  for (id = 0; id < QS_METRICS; ++id) {
+    series[id].name = what[id];
+    for (k = 0; k < n; ++k) {
+      double x;
+      switch (id) {
+        case 0:  x = 1000.0 + 4000.0 * uniform(); break;
+        case 1:  x = 2000.0 - 3000.0 * log(uniform()); break;
+        case 2:  x = 20000.0 * exp(0.8 * normal()); break;
+        default: x = uniform() < 0.9 ? 3000.0 + 300.0 * normal() : 40000.0 + 4000.0 * normal(); break;
+      }
+      sample(id, x < 0.0 ? 0u : x > QS_VALUE_MAX ? QS_VALUE_MAX : (uint32_t)x);
+    }
+  }
+}
+
+/* ------------------- Comparison ------------------- */
+static int cmp_u32(const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return (x > y) - (x < y);
+}
+
+/* samples <= v in the sorted series */
+static size_t rank_of(const uint32_t *v, size_t n, uint32_t x)
+{
+  size_t lo = 0, hi = n;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2u;
+    if (v[mid] <= x) lo = mid + 1u;
+    else             hi = mid;
+  }
+  return lo;
+}
+
+static int compare(const series_t *s, double hz)
+{
+  static const uint32_t ppm[QS_NQ] = QS_QUANTILES_PPM;
+  unsigned __int128 s1 = 0, s2 = 0;
+  uint64_t var;
+  uint32_t min, max, mean;
+  qs_snap_t q;
+  size_t n = s->n, i;
+  int bad = 0;
+
+  qs_read(&s->m, &q);
+  printf("\n%s: %zu samples\n", s->name, n);
+  if (n == 0) return 0;
+  qsort(s->v, n, sizeof *s->v, cmp_u32);
+  for (i = 0; i < n; ++i) { s1 += s->v[i]; s2 += (uint64_t)s->v[i] * s->v[i]; }
+  min  = s->v[0];
+  max  = s->v[n - 1];
+  mean = (uint32_t)(s1 / n);
+  var  = n > 1 ? (uint64_t)((s2 * n - s1 * s1) / ((unsigned __int128)n * (n - 1))) : 0u;
+
+  printf("  %-6s %14s %14s\n", "", "exact", "qstat");
+  printf("  %-6s %14zu %14u\n", "count", n, q.count);
+  printf("  %-6s %14u %14u\n", "min", min, q.min);
+  printf("  %-6s %14u %14u\n", "max", max, q.max);
+  printf("  %-6s %14u %14u\n", "mean", mean, q.mean);
+  printf("  %-6s %14.1f %14u\n", "sd", sqrt((double)var), q.sd);
+  if (q.count != n || q.min != min || q.max != max || q.mean != mean || q.var != var) {
+    printf("  FAIL   exact statistics differ (variance %llu vs %llu)\n",
+           (unsigned long long)var, (unsigned long long)q.var);
+    bad = 1;
+  }
+
+  printf("  %-6s %14s %14s %10s %12s %10s\n", "", "exact", "P-square", "error", "", "rank err");
+  for (i = 0; i < QS_NQ; ++i) {
+    double p = ppm[i] / 1e6;
+    size_t r = (size_t)ceil(p * n);
+    uint32_t x = s->v[(r ? r : 1) - 1];
+    double f = (double)rank_of(s->v, n, q.q[i]) / n;
+    printf("  p%-5g %14u %14u %9.2f%% %9.2f us %+9.3fpp\n", p * 100.0, x, q.q[i],
+           x ? 100.0 * ((double)q.q[i] - x) / x : 0.0, ((double)q.q[i] - x) / hz * 1e6, 100.0 * (f - p));
+  }
+  return bad;
+}
+
+int main(int argc, char **argv)
+{
+  static const char *const names[QS_METRICS] = QS_NAMES;
+  const char *path = NULL;
+  uint64_t gen = 0;
+  double hz = 100e6;
+  unsigned id;
+  int i, bad = 0;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-c") && i + 1 < argc)      hz  = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-g") && i + 1 < argc) gen = strtoull(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc) rng = strtoull(argv[++i], NULL, 0) | 1u;
+    else if (argv[i][0] != '-' && !path)             path = argv[i];
+    else { path = NULL; gen = 0; break; }
+  }
+  if (!path == !gen) {
+    fprintf(stderr, "usage: %s [-c core_hz] trace.{trf,hex,bin}\n"
+                    "       %s -g samples [-s seed]\n", argv[0], argv[0]);
+    return 2;
+  }
+  for (id = 0; id < QS_METRICS; ++id) series[id].name = names[id];
+  if (gen) generate(gen);
+  else if (read_trace(path) != 0) return 1;
+  for (id = 0; id < QS_METRICS; ++id) bad |= compare(&series[id], hz);
+  printf("\n%s\n", bad ? "FAIL" : "ok");
+  return bad;
+}
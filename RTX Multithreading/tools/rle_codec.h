@@ -0,0 +1,130 @@
+/* COE718 Lab 3a - glcd_rle.h encoders and reference decoders for the host tools
+ *
+ * The encoders choose packets by an optimal parse: cost[i] is the fewest
+ * bytes that code pixels i..n-1, filled from the end, one pass per
+ * packet length.  On equal cost a run wins over a literal, since the
+ * driver sends a run without touching flash per pixel.  The decoders
+ * mirror GLCD_DrawCharRLE and GLCD_BitmapRLE so a tool can check every
+ * stream it writes.  Header-only so each tool stays a single cc command.
+ */
+#pragma once
+#include <stdlib.h>
+#include <stdint.h>
+#include "glcd_rle.h"
+
+/* worst-case stream bytes for n pixels */
+#define RLE_G_BOUND(n)   (((n) + RLE_G_LIT - 1u) / RLE_G_LIT)
+#define RLE_B_BOUND(n)   (2u * (n) + ((n) + RLE_B_LIT_MAX - 1u) / RLE_B_LIT_MAX)
+
+/* glyph pixels (0 back, 1 text) -> stream; returns its length */
+static inline size_t rle_glyph_encode(const uint8_t *pix, size_t n, uint8_t *out)
+{
+  size_t *cost = malloc((n + 1u) * sizeof *cost), *take = malloc((n + 1u) * sizeof *take);
+  size_t i, len = 0;
+
+  if (!cost || !take) { free(cost); free(take); return 0; }
+  cost[n] = 0;
+  for (i = n; i-- > 0; ) {
+    size_t j, lit = i + RLE_G_LIT < n ? i + RLE_G_LIT : n;
+    cost[i] = cost[lit] + 1u;
+    take[i] = 0;                                  /* literal */
+    for (j = i + 1u; j <= n && j - i <= RLE_G_RUN_MAX && pix[j - 1u] == pix[i]; ++j)
+      if (cost[j] + 1u <= cost[i]) { cost[i] = cost[j] + 1u; take[i] = j - i; }
+  }
+  for (i = 0; i < n; ) {
+    if (take[i]) {
+      out[len++] = (uint8_t)(RLE_RUN | (pix[i] ? RLE_G_COLOR : 0u) | (take[i] - 1u));
+      i += take[i];
+    } else {
+      uint8_t b = 0;
+      size_t k;
+      for (k = 0; k < RLE_G_LIT && i + k < n; ++k) b |= (uint8_t)((pix[i + k] & 1u) << k);
+      out[len++] = b;
+      i += RLE_G_LIT;
+    }
+  }
+  free(cost);
+  free(take);
+  return len;
+}
+
+/* stream -> n glyph pixels; returns bytes read, 0 if the stream ends early */
+static inline size_t rle_glyph_decode(const uint8_t *in, size_t len, uint8_t *pix, size_t n)
+{
+  size_t used = 0;
+
+  while (n) {
+    uint8_t b;
+    size_t k;
+    if (used == len) return 0;
+    b = in[used++];
+    if (b & RLE_RUN) {
+      for (k = (b & RLE_G_LEN) + 1u; k && n; --k, --n) *pix++ = (b & RLE_G_COLOR) ? 1u : 0u;
+    } else {
+      for (k = 0; k < RLE_G_LIT && n; ++k, --n) *pix++ = (b >> k) & 1u;
+    }
+  }
+  return used;
+}
+
+/* RGB565 pixels, top down -> stream; returns its length */
+static inline size_t rle_bitmap_encode(const uint16_t *pix, size_t n, uint8_t *out)
+{
+  size_t *cost = malloc((n + 1u) * sizeof *cost), *take = malloc((n + 1u) * sizeof *take);
+  uint8_t *run = malloc(n + 1u);
+  size_t i, len = 0;
+
+  if (!cost || !take || !run) { free(cost); free(take); free(run); return 0; }
+  cost[n] = 0;
+  for (i = n; i-- > 0; ) {
+    size_t j;
+    cost[i] = (size_t)-1;
+    for (j = i + 1u; j <= n && j - i <= RLE_B_LIT_MAX; ++j)
+      if (cost[j] + 1u + 2u * (j - i) < cost[i]) { cost[i] = cost[j] + 1u + 2u * (j - i); take[i] = j - i; run[i] = 0; }
+    for (j = i + RLE_B_RUN_MIN; j <= n && j - i <= RLE_B_RUN_MAX && pix[j - 1u] == pix[i]; ++j)
+      if (cost[j] + 3u <= cost[i]) { cost[i] = cost[j] + 3u; take[i] = j - i; run[i] = 1; }
+  }
+  for (i = 0; i < n; i += take[i]) {
+    size_t k;
+    if (run[i]) {
+      out[len++] = (uint8_t)(RLE_RUN | (take[i] - RLE_B_RUN_MIN));
+      out[len++] = (uint8_t)(pix[i] >> 8);
+      out[len++] = (uint8_t)pix[i];
+    } else {
+      out[len++] = (uint8_t)(take[i] - 1u);
+      for (k = 0; k < take[i]; ++k) {
+        out[len++] = (uint8_t)(pix[i + k] >> 8);
+        out[len++] = (uint8_t)pix[i + k];
+      }
+    }
+  }
+  free(cost);
+  free(take);
+  free(run);
+  return len;
+}
+
+/* stream -> n RGB565 pixels; returns bytes read, 0 if the stream ends early */
+static inline size_t rle_bitmap_decode(const uint8_t *in, size_t len, uint16_t *pix, size_t n)
+{
+  size_t used = 0;
+
+  while (n) {
+    uint8_t b;
+    size_t k;
+    if (used == len) return 0;
+    b = in[used++];
+    if (b & RLE_RUN) {
+      uint16_t v;
+      if (len - used < 2u) return 0;
+      v = (uint16_t)(in[used] << 8 | in[used + 1u]);
+      used += 2u;
+      for (k = (b & RLE_B_LEN) + RLE_B_RUN_MIN; k && n; --k, --n) *pix++ = v;
+    } else {
+      k = (b & RLE_B_LEN) + 1u;
+      if (len - used < 2u * k) return 0;
+      for (; k && n; --k, --n, used += 2u) *pix++ = (uint16_t)(in[used] << 8 | in[used + 1u]);
+    }
+  }
+  return used;
+}
@@ -0,0 +1,427 @@
+/* COE718 Lab 3a - schedulability and response-time analysis
+ *
+ * Build:  cc -std=c99 -O2 -I.. -o sched_rta sched_rta.c -lm
+ * Usage:  sched_rta [-R RTX_Conf_CM.c] [-q robin_ticks] [-o overhead_us]
+ *                   [-m measured.txt] [-x] source.c|tasks.txt ...
+ *
+ * Collects tasks from the sources: every osThreadDef(name, prio, ...) and
+ * every row of a pt_task_def_t table ({ "name", job, ctx, period_ms,
+ * deadline_ms, wcet_us, prio, jobs }), resolving plain #define values of
+ * the same file; PT_PRIO_RM rows get the priority periodic.c would give
+ * them.  A .txt file lists "name prio period_ms deadline_ms wcet_us" per
+ * line (prio: -3..3, osPriorityX or rm; deadline 0 = period).
+ *
+ * -m reads "name wcet_us [period_ms [deadline_ms]]" lines and overrides the
+ * declared values: copy the measured worst cases there from the target,
+ * e.g. g_pt_task[i].st.exec_max / TU_CYCLES_PER_US or g_bg[i].st.  Threads
+ * without a period are listed but not analysed.  -R takes OS_ROBIN and
+ * OS_ROBINTOUT from the RTX configuration, -q overrides the slice, -o
+ * adds a per-job overhead (release, context switches).
+ *
+ * For each priority level, from the top, the response time is the
+ * smallest fixed point of
+ *   R = C + sum_hp ceil(R/T_j) C_j + sum_ep min(ceil(R/T_j) C_j, ceil(C/Q) Q)
+ * where hp are the higher-priority tasks and ep the other tasks at the
+ * same priority, each of which can take one OS_ROBINTOUT slice Q per
+ * slice of the task (or its whole demand when that is smaller).  Without
+ * OS_ROBIN the ep term is the full demand.  Also printed: utilisation,
+ * the Liu & Layland and hyperbolic RM bounds and the EDF bound.
+ *
+ * Exits 1 when a deadline can be missed, so it can gate a build.  -x
+ * explores every priority order of the analysed tasks and all-equal
+ * round-robin with slices of 1..10 ticks, and reports configurations per
+ * second.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+#include "time_units.h"
+
+#define MAX_TASKS   32
+#define MAX_DEFS    512
+#define PRIO_RM     100
+#define PRIO_NONE   101
+#define PRIO_TOP    1                   /* periodic.h: PT_PRIO_TOP */
+#define PRIO_LOW    (-1)
+
+typedef struct {
+  char   name[32];
+  int    prio;                          /* -3..3, osPriorityIdle..Realtime */
+  double T, D, C;                       /* us; T == 0: no period */
+} task_t;
+
+typedef struct { char name[48]; char val[96]; } def_t;
+
+static task_t task[MAX_TASKS];
+static int    n_task;
+static def_t  defs[MAX_DEFS];
+static int    n_defs;
+
+static int    robin_on  = 1;
+static double robin_us  = 3.0 * TU_TICK_US;
+static double overhead  = 0.0;
+
+static const char *const prio_name[] = {
+  "osPriorityIdle", "osPriorityLow", "osPriorityBelowNormal", "osPriorityNormal",
+  "osPriorityAboveNormal", "osPriorityHigh", "osPriorityRealtime"
+};
+
+/* ------------------- Source parsing ------------------- */
+static char *trim(char *s)
+{
+  char *e;
+  while (isspace((unsigned char)*s)) s++;
+  e = s + strlen(s);
+  while (e > s && isspace((unsigned char)e[-1])) *--e = '\0';
+  return s;
+}
+
+static const char *lookup(const char *name)
+{
+  int i;
+  for (i = n_defs - 1; i >= 0; --i) if (!strcmp(defs[i].name, name)) return defs[i].val;
+  return NULL;
+}
+
+/* number, osPriorityX, PT_PRIO_* or a #define of one of them */
+static int resolve(const char *tok, double *num, int *prio)
+{
+  char buf[96], *s, *end;
+  int i, depth;
+
+  snprintf(buf, sizeof buf, "%s", tok);
+  for (depth = 0; depth < 8; ++depth) {
+    const char *v;
+    s = trim(buf);
+    if (*s == '(' && s[strlen(s) - 1] == ')') { s[strlen(s) - 1] = '\0'; s++; s = trim(s); }
+    if (isdigit((unsigned char)*s) || *s == '-') {
+      double d = strtod(s, &end);
+      while (*end == 'u' || *end == 'U' || *end == 'l' || *end == 'L') end++;
+      if (*trim(end)) return -1;
+      if (num) *num = d;
+      if (prio) *prio = (int)d;
+      return 0;
+    }
+    for (i = 0; i < 7; ++i) {
+      if (!strcmp(s, prio_name[i])) { if (prio) *prio = i - 3; return 0; }
+    }
+    if (!strcmp(s, "PT_PRIO_RM"))  { if (prio) *prio = PRIO_RM;  return 0; }
+    if (!strcmp(s, "PT_PRIO_TOP")) { if (prio) *prio = PRIO_TOP; return 0; }
+    if (!strcmp(s, "PT_EDF_LOW"))  { if (prio) *prio = PRIO_LOW; return 0; }
+    if (!(v = lookup(s))) return -1;
+    snprintf(buf, sizeof buf, "%s", v);
+  }
+  return -1;
+}
+
+static task_t *find_task(const char *name)
+{
+  int i;
+  for (i = 0; i < n_task; ++i) if (!strcmp(task[i].name, name)) return &task[i];
+  return NULL;
+}
+
+static task_t *add_task(const char *name)
+{
+  task_t *t = find_task(name);
+  if (t) return t;
+  if (n_task == MAX_TASKS) { fprintf(stderr, "too many tasks\n"); exit(2); }
+  t = &task[n_task++];
+  memset(t, 0, sizeof *t);
+  snprintf(t->name, sizeof t->name, "%s", name);
+  t->prio = PRIO_NONE;
+  return t;
+}
+
+static int split_args(char *s, char **arg, int max)
+{
+  int n = 0, depth = 0;
+  arg[n++] = s;
+  for (; *s && n < max; ++s) {
+    if (*s == '(' || *s == '{') depth++;
+    else if (*s == ')' || *s == '}') depth--;
+    else if (*s == ',' && depth == 0) { *s = '\0'; arg[n++] = s + 1; }
+  }
+  return n;
+}
+
+static void parse_c(FILE *f)
+{
+  char line[512];
+
+  while (fgets(line, sizeof line, f)) {
+    char *s, *c, *arg[10];
+    int n;
+
+    if ((c = strstr(line, "/*")) != NULL) *c = '\0';
+    if ((c = strstr(line, "//")) != NULL) *c = '\0';
+    s = trim(line);
+
+    if (!strncmp(s, "#", 1)) {
+      s = trim(s + 1);
+      if (!strncmp(s, "define", 6) && isspace((unsigned char)s[6]) && n_defs < MAX_DEFS) {
+        char name[48];
+        int len = 0;
+        s = trim(s + 6);
+        while (s[len] && !isspace((unsigned char)s[len]) && s[len] != '(' && len < 47) len++;
+        if (s[len] == '(') continue;    /* function-like */
+        memcpy(name, s, (size_t)len);
+        name[len] = '\0';
+        snprintf(defs[n_defs].name, sizeof defs[0].name, "%s", name);
+        snprintf(defs[n_defs].val, sizeof defs[0].val, "%s", trim(s + len));
+        n_defs++;
+      }
+      continue;
+    }
+
+    if ((c = strstr(s, "osThreadDef(")) != NULL) {
+      char *close = strrchr(c, ')');
+      int prio;
+      if (!close) continue;
+      *close = '\0';
+      n = split_args(c + 12, arg, 4);
+      if (n == 4 && resolve(arg[1], NULL, &prio) == 0) {
+        task_t *t = add_task(trim(arg[0]));
+        if (t->prio == PRIO_NONE) t->prio = prio;
+      }
+      continue;
+    }
+
+    if (s[0] == '{' && (c = strchr(s, '"')) != NULL) {
+      char *q = strchr(c + 1, '"'), *close = strrchr(s, '}');
+      double per, dl, wcet;
+      int prio;
+      if (!q || !close) continue;
+      *close = '\0';
+      n = split_args(s + 1, arg, 10);
+      if (n < 8) continue;
+      *q = '\0';
+      if (resolve(arg[3], &per, NULL) || resolve(arg[4], &dl, NULL) ||
+          resolve(arg[5], &wcet, NULL) || resolve(arg[6], NULL, &prio)) continue;
+      {
+        task_t *t = add_task(c + 1);
+        t->T    = per * 1000.0;
+        t->D    = (dl > 0.0 ? dl : per) * 1000.0;
+        t->C    = wcet;
+        t->prio = prio;
+      }
+    }
+  }
+}
+
+static void parse_txt(FILE *f, int measured)
+{
+  char line[256], name[32], p[48];
+  double a, b, c, d;
+
+  while (fgets(line, sizeof line, f)) {
+    task_t *t;
+    int n;
+    char *s = trim(line);
+    if (!*s || *s == '#') continue;
+    if (measured) {
+      n = sscanf(s, "%31s %lf %lf %lf", name, &a, &b, &c);
+      if (n < 2) continue;
+      t = add_task(name);
+      t->C = a;
+      if (n >= 3) { t->T = b * 1000.0; t->D = t->T; }
+      if (n >= 4 && c > 0.0) t->D = c * 1000.0;
+    } else {
+      int prio;
+      n = sscanf(s, "%31s %47s %lf %lf %lf", name, p, &a, &b, &d);
+      if (n < 5) continue;
+      if (!strcmp(p, "rm")) prio = PRIO_RM;
+      else if (resolve(p, NULL, &prio)) { fprintf(stderr, "bad priority '%s'\n", p); exit(2); }
+      t = add_task(name);
+      t->prio = prio;
+      t->T    = a * 1000.0;
+      t->D    = (b > 0.0 ? b : a) * 1000.0;
+      t->C    = d;
+    }
+  }
+}
+
+static void parse_rtx_conf(FILE *f)
+{
+  char line[256];
+  double v;
+  while (fgets(line, sizeof line, f)) {
+    char *s = trim(line);
+    if (sscanf(s, "#define OS_ROBINTOUT %lf", &v) == 1) robin_us = v * TU_TICK_US;
+    else if (sscanf(s, "#define OS_ROBIN %lf", &v) == 1) robin_on = v != 0.0;
+  }
+}
+
+/* PT_PRIO_RM: rank by distinct shorter period, from PRIO_TOP down */
+static void assign_rm(void)
+{
+  int prio[MAX_TASKS], i, j, k;
+  for (k = 0; k < n_task; ++k) {
+    int rank = 0;
+    prio[k] = task[k].prio;
+    if (task[k].prio != PRIO_RM) continue;
+    for (i = 0; i < n_task; ++i) {
+      int seen = 0;
+      if (task[i].prio != PRIO_RM || task[i].T >= task[k].T) continue;
+      for (j = 0; j < i; ++j) if (task[j].prio == PRIO_RM && task[j].T == task[i].T) seen = 1;
+      rank += !seen;
+    }
+    prio[k] = (PRIO_TOP - rank < PRIO_LOW) ? PRIO_LOW : PRIO_TOP - rank;
+  }
+  for (k = 0; k < n_task; ++k) task[k].prio = prio[k];
+}
+
+/* ------------------- Analysis ------------------- */
+typedef struct { double T, D, C; int prio; } rt_t;
+
+/* response time of a[i], or a value > D when it cannot be met */
+static double response(const rt_t *a, int n, int i, int robin, double q)
+{
+  double C = a[i].C + overhead, R = C, prev = -1.0;
+  int j;
+
+  while (R != prev && R <= a[i].D) {
+    prev = R;
+    R = C;
+    for (j = 0; j < n; ++j) {
+      double demand;
+      if (j == i) continue;
+      demand = ceil(prev / a[j].T) * (a[j].C + overhead);
+      if (a[j].prio > a[i].prio) R += demand;
+      else if (a[j].prio == a[i].prio) {
+        double share = ceil(C / q) * q;
+        R += (robin && share < demand) ? share : demand;
+      }
+    }
+  }
+  return R;
+}
+
+static int feasible(const rt_t *a, int n, int robin, double q, double *r)
+{
+  int i, ok = 1;
+  for (i = 0; i < n; ++i) {
+    double R = response(a, n, i, robin, q);
+    if (r) r[i] = R;
+    if (R > a[i].D) { ok = 0; if (!r) break; }
+  }
+  return ok;
+}
+
+static int next_perm(int *p, int n)
+{
+  int i = n - 2, j, t;
+  while (i >= 0 && p[i] >= p[i + 1]) i--;
+  if (i < 0) return 0;
+  for (j = n - 1; p[j] <= p[i]; --j) ;
+  t = p[i]; p[i] = p[j]; p[j] = t;
+  for (i++, j = n - 1; i < j; ++i, --j) { t = p[i]; p[i] = p[j]; p[j] = t; }
+  return 1;
+}
+
+static void explore(const rt_t *base, int n)
+{
+  rt_t a[MAX_TASKS];
+  int perm[MAX_TASKS], i, q;
+  long configs = 0, ok_fp = 0, ok_rr = 0;
+  struct timespec t0, t1;
+  double secs;
+
+  if (n > 7) { fprintf(stderr, "-x: at most 7 analysed tasks (one per priority)\n"); return; }
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  memcpy(a, base, sizeof a[0] * (size_t)n);
+  for (i = 0; i < n; ++i) perm[i] = i;
+  do {                                  /* distinct priorities, every order */
+    for (i = 0; i < n; ++i) a[perm[i]].prio = 3 - i;
+    ok_fp += feasible(a, n, robin_on, robin_us, NULL);
+    configs++;
+  } while (next_perm(perm, n));
+  for (i = 0; i < n; ++i) a[i].prio = 0;
+  printf("round-robin at one priority:\n");
+  for (q = 1; q <= 10; ++q) {           /* all equal, slice 1..10 ticks */
+    int ok = feasible(a, n, 1, (double)q * TU_TICK_US, NULL);
+    printf("  OS_ROBINTOUT %2d  %s\n", q, ok ? "ok" : "deadline miss");
+    ok_rr += ok;
+    configs++;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+  printf("%ld configurations: %ld of %ld priority orders and %ld of 10 slices feasible, "
+         "%.0f configurations/s\n", configs, ok_fp, configs - 10, ok_rr,
+         secs > 0.0 ? configs / secs : 0.0);
+}
+
+int main(int argc, char **argv)
+{
+  rt_t   a[MAX_TASKS];
+  double r[MAX_TASKS], U = 0.0, hyp = 1.0;
+  int    idx[MAX_TASKS], n = 0, i, xplore = 0, ok;
+  const char *measured = NULL;
+
+  for (i = 1; i < argc; ++i) {
+    FILE *f;
+    if (!strcmp(argv[i], "-x")) { xplore = 1; continue; }
+    if (argv[i][0] == '-' && i + 1 < argc) {
+      const char *v = argv[++i];
+      if (!strcmp(argv[i - 1], "-q"))      robin_us = atof(v) * TU_TICK_US;
+      else if (!strcmp(argv[i - 1], "-o")) overhead = atof(v);
+      else if (!strcmp(argv[i - 1], "-m")) measured = v;
+      else if (!strcmp(argv[i - 1], "-R")) {
+        if (!(f = fopen(v, "r"))) { perror(v); return 2; }
+        parse_rtx_conf(f);
+        fclose(f);
+      } else break;
+      continue;
+    }
+    if (argv[i][0] == '-') break;
+    if (!(f = fopen(argv[i], "r"))) { perror(argv[i]); return 2; }
+    n_defs = 0;                         /* #defines are per file */
+    if (strstr(argv[i], ".txt")) parse_txt(f, 0); else parse_c(f);
+    fclose(f);
+  }
+  if (i < argc || n_task == 0) {
+    fprintf(stderr, "usage: %s [-R RTX_Conf_CM.c] [-q robin_ticks] [-o overhead_us]\n"
+                    "          [-m measured.txt] [-x] source.c|tasks.txt ...\n", argv[0]);
+    return 2;
+  }
+  if (measured) {
+    FILE *f = fopen(measured, "r");
+    if (!f) { perror(measured); return 2; }
+    parse_txt(f, 1);
+    fclose(f);
+  }
+  assign_rm();
+
+  printf("tick %u us, OS_ROBIN %d, slice %.0f us, overhead %.0f us/job\n\n",
+         (unsigned)TU_TICK_US, robin_on, robin_us, overhead);
+  for (i = 0; i < n_task; ++i) {
+    task_t *t = &task[i];
+    if (t->T <= 0.0 || t->C <= 0.0 || t->prio == PRIO_NONE || t->prio == PRIO_RM) {
+      printf("  %-22s not analysed (no period/WCET, give it with -m)\n", t->name);
+      continue;
+    }
+    a[n].T = t->T; a[n].D = t->D; a[n].C = t->C; a[n].prio = t->prio;
+    U   += t->C / t->T;
+    hyp *= t->C / t->T + 1.0;
+    idx[n++] = i;
+  }
+  if (n == 0) return 0;
+
+  ok = feasible(a, n, robin_on, robin_us, r);
+  printf("  %-22s %5s %9s %9s %9s %9s\n", "task", "prio", "T us", "D us", "C us", "R us");
+  for (i = 0; i < n; ++i) {
+    printf("  %-22s %5d %9.0f %9.0f %9.0f ", task[idx[i]].name, a[i].prio, a[i].T, a[i].D, a[i].C);
+    if (r[i] > a[i].D) printf("%9s  DEADLINE MISS\n", "> D");
+    else printf("%9.0f\n", r[i]);
+  }
+  printf("\nU = %.3f   RM bound %.3f (n=%d)   hyperbolic %.3f <= 2   EDF U <= 1\n",
+         U, n * (pow(2.0, 1.0 / n) - 1.0), n, hyp);
+  printf("%s\n", ok ? "schedulable" : "NOT schedulable");
+
+  if (xplore) { printf("\n"); explore(a, n); }
+  return ok ? 0 : 1;
+}
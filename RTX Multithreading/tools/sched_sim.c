@@ -0,0 +1,330 @@
+/* COE718 Lab 3a - uniprocessor scheduling simulator: RR vs RM vs EDF
+ *
+ * Build:  cc -std=c99 -O2 -DRF_HOST -I.. -o sched_sim sched_sim.c ../rr_fair.c -lm
+ * Usage:  sched_sim [-q robin_ticks] [-o switch_us] [-r sets] [-n tasks] [-s seed]
+ *         sched_sim -f rf.{hex,bin} [-p rr|rm|edf] [-q robin_ticks] [-o switch_us]
+ *
+ * Host counterpart of sched_bench.c.  Without -r it simulates the same
+ * three tasks (10/20/25 ms, 40/35/25 % of the load) at 70..95 % total
+ * utilisation for 2 s each and prints missed jobs per mille and the worst
+ * response/deadline ratio per policy, the numbers sched_bench.c leaves in
+ * g_sb_miss_pm / g_sb_resp_pct.  With -r it draws that many random task
+ * sets per level (UUniFast utilisations, periods from multiples of the
+ * real 5 ms tick) and prints the fraction with no deadline miss.
+ *
+ * The policies follow periodic.h: jobs are released on tick boundaries, a
+ * release that finds the previous job unfinished is skipped and counted as
+ * a miss, RM uses fixed priorities by period, EDF runs the earliest absolute
+ * deadline, and RR keeps all tasks at one priority and rotates the running
+ * job once it has used robin_ticks ticks (OS_ROBINTOUT), checked at ticks.
+ * -o charges a context-switch cost on every dispatch.
+ *
+ * With -f it reads a g_rf dump (rr_fair.h), simulates the dumped threads
+ * as periodic tasks (period_us, cost_us, target jobs) under one policy,
+ * RR by default, feeds the simulated completions through the same
+ * rr_fair.c analysis at every tick and prints measured against predicted
+ * throughput, worst lag, completion time and Jain's index.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "time_units.h"
+#include "rr_fair.h"
+#include "dump_image.h"
+
+#define MAX_TASKS   16
+#define RUN_US      2000000ull
+#define LEVELS      6
+
+enum { POL_RM, POL_EDF, POL_RR, POLICIES };
+static const char *const pol_name[POLICIES] = { "RM", "EDF", "RR" };
+
+typedef struct { uint64_t T, D, C, N; } task_t;   /* N: jobs, 0 = forever */
+
+typedef struct {
+  uint64_t next_rel, rel, dl, rem, count;
+  int      busy;
+} job_t;
+
+typedef struct {
+  uint64_t jobs, missed;
+  double   worst_ratio;                 /* response / deadline */
+} result_t;
+
+static uint64_t robin_us  = 3u * TU_TICK_US;
+static uint64_t switch_us = 0u;
+
+/* -f: completions sampled into sim_rf every sim_tick_us */
+static rf_state_t *sim_rf;
+static uint32_t    sim_done[MAX_TASKS];
+static uint64_t    sim_tick_us = TU_TICK_US;
+
+/* ------------------- Simulation ------------------- */
+static int pick(int pol, const task_t *ts, const job_t *j, int n, const int *rq, int rqn)
+{
+  int i, best = -1;
+  if (pol == POL_RR) return rqn ? rq[0] : -1;
+  for (i = 0; i < n; ++i) {
+    if (!j[i].busy) continue;
+    if (best < 0) { best = i; continue; }
+    if (pol == POL_RM  && ts[i].T  < ts[best].T)  best = i;
+    if (pol == POL_EDF && j[i].dl  < j[best].dl)  best = i;
+  }
+  return best;
+}
+
+static void rq_remove(int *rq, int *rqn, int k)
+{
+  int i, w = 0;
+  for (i = 0; i < *rqn; ++i) if (rq[i] != k) rq[w++] = rq[i];
+  *rqn = w;
+}
+
+static result_t simulate(int pol, const task_t *ts, int n, uint64_t run_us)
+{
+  job_t    j[MAX_TASKS];
+  int      rq[MAX_TASKS], rqn = 0, running = -1, i;
+  uint64_t t = 0, slice_start = 0, overhead = 0, sample = sim_tick_us;
+  result_t r = { 0, 0, 0.0 };
+
+  memset(j, 0, sizeof j);
+  if (sim_rf) memset(sim_done, 0, sizeof sim_done);
+  while (t < run_us) {
+    uint64_t ev = run_us;
+    int next;
+
+    /* next event: release, completion, RR rotation, analyzer sample */
+    for (i = 0; i < n; ++i) if (j[i].next_rel < ev) ev = j[i].next_rel;
+    if (sim_rf && sample < ev) ev = sample;
+    if (running >= 0) {
+      uint64_t done = t + overhead + j[running].rem;
+      if (done < ev) ev = done;
+      if (pol == POL_RR && rqn > 1) {
+        uint64_t rot = ((slice_start + robin_us + TU_TICK_US - 1u) / TU_TICK_US) * TU_TICK_US;
+        if (rot < ev) ev = rot;
+      }
+    }
+
+    /* run the current job up to ev */
+    if (running >= 0) {
+      uint64_t span = ev - t;
+      if (overhead >= span) overhead -= span;
+      else { j[running].rem -= span - overhead; overhead = 0; }
+    }
+    t = ev;
+
+    if (running >= 0 && j[running].rem == 0u) {
+      job_t *c = &j[running];
+      double ratio = (double)(t - c->rel) / (double)ts[running].D;
+      if (t > c->dl) r.missed++;
+      if (ratio > r.worst_ratio) r.worst_ratio = ratio;
+      c->busy = 0;
+      if (sim_rf) sim_done[running]++;
+      rq_remove(rq, &rqn, running);
+      running = -1;
+    }
+
+    for (i = 0; i < n; ++i) {
+      if (j[i].next_rel != t) continue;
+      j[i].next_rel += ts[i].T;
+      if (ts[i].N && ++j[i].count >= ts[i].N) j[i].next_rel = UINT64_MAX;
+      r.jobs++;
+      if (j[i].busy) { r.missed++; continue; }   /* skipped release */
+      j[i].busy = 1;
+      j[i].rel  = t;
+      j[i].dl   = t + ts[i].D;
+      j[i].rem  = ts[i].C;
+      rq[rqn++] = i;
+    }
+
+    if (pol == POL_RR && running >= 0 && rqn > 1 &&
+        t >= ((slice_start + robin_us + TU_TICK_US - 1u) / TU_TICK_US) * TU_TICK_US) {
+      rq_remove(rq, &rqn, running);       /* slice used up: to the tail */
+      rq[rqn++] = running;
+      running = -1;
+    }
+
+    if (sim_rf && t == sample) {
+      sample += sim_tick_us;
+      if (rf_step(sim_rf, sim_done)) break;
+    }
+
+    next = pick(pol, ts, j, n, rq, rqn);
+    if (next != running) {
+      running     = next;
+      slice_start = t;
+      overhead    = (next >= 0) ? switch_us : 0u;
+    }
+  }
+  /* jobs still running at the end whose deadline has passed */
+  for (i = 0; i < n; ++i) if (j[i].busy && j[i].dl <= run_us) r.missed++;
+  return r;
+}
+
+/* ------------------- Task sets ------------------- */
+static double urand(void) { return (rand() + 0.5) / ((double)RAND_MAX + 1.0); }
+
+/* UUniFast: n utilisations summing to u */
+static void uunifast(double u, int n, double *out)
+{
+  double sum = u, next;
+  int i;
+  for (i = 0; i < n - 1; ++i) {
+    next = sum * pow(urand(), 1.0 / (n - i));
+    out[i] = sum - next;
+    sum = next;
+  }
+  out[n - 1] = sum;
+}
+
+static void fixed_set(task_t *ts, unsigned u_pct)
+{
+  static const uint64_t per_ms[3]  = { 10, 20, 25 };
+  static const uint64_t share_pm[3] = { 400, 350, 250 };
+  int i;
+  for (i = 0; i < 3; ++i) {
+    ts[i].T = per_ms[i] * 1000u;
+    ts[i].D = ts[i].T;
+    ts[i].C = u_pct * share_pm[i] * ts[i].T / 100000u;
+    ts[i].N = 0u;
+  }
+}
+
+static void random_set(task_t *ts, int n, unsigned u_pct)
+{
+  static const uint64_t per_ticks[] = { 2, 4, 5, 8, 10, 16, 20, 25, 40 };
+  double u[MAX_TASKS];
+  int i;
+  uunifast(u_pct / 100.0, n, u);
+  for (i = 0; i < n; ++i) {
+    ts[i].T = per_ticks[rand() % (int)(sizeof per_ticks / sizeof per_ticks[0])] * TU_TICK_US;
+    ts[i].D = ts[i].T;
+    ts[i].C = (uint64_t)(u[i] * (double)ts[i].T);
+    if (ts[i].C == 0u) ts[i].C = 1u;
+    ts[i].N = 0u;
+  }
+}
+
+/* ------------------- Fairness dump vs. prediction ------------------- */
+static int compare_fair(const char *path, int pol)
+{
+  static rf_state_t meas, pred;
+  task_t   ts[MAX_TASKS];
+  uint8_t *img;
+  size_t   len = 0;
+  uint32_t i, n, targets = 0u;
+  uint64_t run_us;
+
+  img = load_dump(path, &len);
+  if (!img || len < sizeof meas || rd32(img) != RF_MAGIC || rd32(img + 4) != sizeof(rf_thread_t)) {
+    fprintf(stderr, "%s: not a g_rf dump\n", path);
+    free(img);
+    return 1;
+  }
+  memcpy(&meas, img, sizeof meas);      /* little-endian host, same layout */
+  free(img);
+  n = meas.threads;
+  if (n == 0u || n > RF_MAX_THREADS || meas.tick_us == 0u) { fprintf(stderr, "%s: empty dump\n", path); return 1; }
+  if (!meas.done) fprintf(stderr, "%s: analysis not finished, partial result\n", path);
+
+  rf_reset(&pred, meas.tick_us);
+  for (i = 0; i < n; ++i) {
+    const rf_thread_t *t = &meas.t[i];
+    if (t->cost_us == 0u) { fprintf(stderr, "%s: %.8s has no cost_us\n", path, t->name); return 1; }
+    ts[i].T = ts[i].D = t->period_us;
+    ts[i].C = t->cost_us;
+    ts[i].N = t->target;
+    targets += t->target != 0u;
+    (void)rf_add(&pred, t->name, t->period_us, t->cost_us, t->target);
+  }
+  /* with targets run until they are reached (twice the measured time at most) */
+  run_us = (uint64_t)meas.ticks * meas.tick_us * (targets ? 2u : 1u);
+  sim_rf      = &pred;
+  sim_tick_us = meas.tick_us;
+  (void)simulate(pol, ts, (int)n, run_us + 1u);
+  rf_finish(&pred);
+  sim_rf = NULL;
+
+  printf("%s: %u threads, %u ticks of %u us; %s prediction, slice %llu us, switch %llu us\n\n",
+         path, n, meas.ticks, meas.tick_us, pol_name[pol],
+         (unsigned long long)robin_us, (unsigned long long)switch_us);
+  printf("  %-8s %21s %21s %21s\n", "thread", "units/s meas/pred", "max lag us meas/pred", "done ms meas/pred");
+  for (i = 0; i < n; ++i) {
+    const rf_thread_t *a = &meas.t[i], *b = &pred.t[i];
+    printf("  %-8.8s %10.3f %10.3f %10d %10d %10.1f %10.1f\n", a->name,
+           a->thr_milli / 1000.0, b->thr_milli / 1000.0, a->lag_max_us, b->lag_max_us,
+           a->done_tick * (double)meas.tick_us / 1000.0, b->done_tick * (double)pred.tick_us / 1000.0);
+  }
+  printf("\n  Jain (per mille)   run %4u/%-4u   window min %4u/%-4u   window mean %4u/%-4u\n",
+         meas.jain_run_pm, pred.jain_run_pm, meas.jain_min_pm, pred.jain_min_pm,
+         meas.jain_mean_pm, pred.jain_mean_pm);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  task_t ts[MAX_TASKS];
+  int sets = 0, n = 3, i, l, p, fpol = POL_RR;
+  unsigned seed = 1u;
+  const char *fair = NULL;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-q") && i + 1 < argc)      robin_us  = strtoull(argv[++i], NULL, 0) * TU_TICK_US;
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc) switch_us = strtoull(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-r") && i + 1 < argc) sets      = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-n") && i + 1 < argc) n         = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc) seed      = (unsigned)strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-f") && i + 1 < argc) fair      = argv[++i];
+    else if (!strcmp(argv[i], "-p") && i + 1 < argc) {
+      for (fpol = 0; fpol < POLICIES; ++fpol) {
+        const char *a = pol_name[fpol], *b = argv[i + 1];
+        while (*a && (*a | 0x20) == (*b | 0x20)) { a++; b++; }
+        if (!*a && !*b) break;
+      }
+      i++;
+      if (fpol == POLICIES) { fprintf(stderr, "policy: rr, rm or edf\n"); return 2; }
+    }
+    else {
+      fprintf(stderr, "usage: %s [-q robin_ticks] [-o switch_us] [-r sets] [-n tasks] [-s seed]\n"
+                      "       %s -f rf.{hex,bin} [-p rr|rm|edf] [-q robin_ticks] [-o switch_us]\n", argv[0], argv[0]);
+      return 2;
+    }
+  }
+  if (fair) return compare_fair(fair, fpol);
+  if (n < 1 || n > MAX_TASKS) { fprintf(stderr, "tasks: 1..%d\n", MAX_TASKS); return 2; }
+  srand(seed);
+
+  if (sets == 0) {
+    printf("tick %u us, RR slice %llu us, switch %llu us, 10/20/25 ms tasks, %llu ms per run\n\n",
+           (unsigned)TU_TICK_US, (unsigned long long)robin_us, (unsigned long long)switch_us,
+           (unsigned long long)(RUN_US / 1000u));
+    printf("  U%%   %-18s %-18s %-18s\n", "RM miss/resp", "EDF miss/resp", "RR miss/resp");
+    for (l = 0; l < LEVELS; ++l) {
+      unsigned u = 70u + 5u * (unsigned)l;
+      fixed_set(ts, u);
+      printf("  %2u  ", u);
+      for (p = 0; p < POLICIES; ++p) {
+        result_t r = simulate(p, ts, 3, RUN_US);
+        printf(" %4llu/1000 %5.0f%%    ", (unsigned long long)(r.jobs ? r.missed * 1000u / r.jobs : 0u),
+               r.worst_ratio * 100.0);
+      }
+      printf("\n");
+    }
+    return 0;
+  }
+
+  printf("%d random sets of %d tasks per level, fraction with no deadline miss\n\n", sets, n);
+  printf("  U%%  %6s %6s %6s\n", pol_name[0], pol_name[1], pol_name[2]);
+  for (l = 0; l < LEVELS; ++l) {
+    unsigned u = 70u + 5u * (unsigned)l;
+    int ok[POLICIES] = { 0, 0, 0 }, s;
+    for (s = 0; s < sets; ++s) {
+      random_set(ts, n, u);
+      for (p = 0; p < POLICIES; ++p) ok[p] += simulate(p, ts, n, RUN_US).missed == 0u;
+    }
+    printf("  %2u  %6.3f %6.3f %6.3f\n", u, ok[0] / (double)sets, ok[1] / (double)sets, ok[2] / (double)sets);
+  }
+  return 0;
+}
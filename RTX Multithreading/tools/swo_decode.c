@@ -0,0 +1,328 @@
+/* COE718 Lab 3a - SWO/ITM decoder for the trace recorder (trace.h, TRACE_ITM=1)
+ *
+ * Build:  cc -std=c99 -O2 -I.. -Ihost -o swo_decode swo_decode.c trace_file.c
+ * Usage:  swo_decode [-c core_hz] [-p port] [-q] [-w out.trf] capture.swo
+ *         swo_decode [-c core_hz] [-w out.trf] -R trace.{hex,bin}
+ *         swo_decode -g events [-s seed] capture.swo
+ *
+ * Reads a raw SWO byte stream (ITM packets as the probe delivers them,
+ * UART/NRZ already decoded) and prints the trace events on stimulus port
+ * -p (default TRACE_ITM_PORT) in the same model and format as a g_trace
+ * RAM dump, which -R reads for comparison.  Timestamps are the ITM local
+ * timestamps summed from the start of the capture, in core cycles.
+ *
+ * The capture is parsed in fixed-size chunks by a byte-wise packet state
+ * machine, so its size is not limited by memory.  Synchronisation,
+ * overflow, local and global timestamp, extension and hardware (DWT)
+ * packets and other stimulus ports are understood and counted; events
+ * between an overflow and the next timestamp keep the last known time.
+ *
+ * -w also stores the events in an indexed trace file (trace_file.h) for
+ * trace_cat and the other tools that seek by time.
+ *
+ * -g writes a synthetic capture of that many events with every packet
+ * kind mixed in, and prints the event count and last timestamp the
+ * decoder must report:
+ *
+ *   swo_decode -g 1000000 t.swo && swo_decode -q t.swo
+ *
+ * samples/swo_sample.swo is a 93-byte hand-built capture with one packet
+ * of each kind: sync, the names of slots 0 and 1 on ports 2 and 3, local
+ * timestamps in format 1 (plain and delayed) and format 2, both global
+ * timestamps, an extension, a printf byte on port 0, a DWT counter and
+ * PC sample, a reserved header, an overflow followed by two ISR events,
+ * and a last event with no timestamp after it.  samples/swo_sample.txt is
+ * the expected dump, summary line included; from tools/:
+ *
+ *   ./swo_decode samples/swo_sample.swo | diff samples/swo_sample.txt -
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "trace_model.h"
+#include "dump_image.h"
+#include "trace_file.h"
+
+#define SWO_CHUNK     (1u << 20)
+#define SWO_PENDING   64u               /* events waiting for a timestamp */
+
+typedef struct {
+  /* packet state machine */
+  int        state;                     /* 0 header, 1 source payload, 2 continuation */
+  uint8_t    hdr;
+  unsigned   need, got, zeros;
+  uint32_t   val;
+  unsigned   shift;
+  /* event model */
+  unsigned   port;
+  uint64_t   now;                       /* cycles at the last timestamp */
+  trace_ev_t pend[SWO_PENDING];
+  unsigned   npend;
+  uint32_t   name_lo;                   /* first word of a name */
+  trace_names_t names;
+  int        quiet;
+  double     hz;
+  tf_writer_t *out;                     /* -w, NULL = none */
+  /* statistics */
+  uint64_t   bytes, events, syncs, overflows, lts, gts, ext, hw, other_port, reserved;
+  uint64_t   last_ts;
+} swo_t;
+
+/* ------------------- Event model ------------------- */
+static void flush(swo_t *s)
+{
+  unsigned i;
+  for (i = 0; i < s->npend; ++i) {
+    s->pend[i].ts = s->now;
+    s->last_ts    = s->now;
+    s->events++;
+    if (s->out) (void)tf_write(s->out, &s->pend[i]);
+    if (!s->quiet) trace_ev_print(stdout, &s->pend[i], &s->names, s->hz);
+  }
+  s->npend = 0;
+}
+
+static void stimulus(swo_t *s, unsigned port, uint32_t w, unsigned size)
+{
+  if (port == s->port && size == 4u) {
+    trace_ev_t *e;
+    if (s->npend == SWO_PENDING) flush(s);   /* timestamps off */
+    e = &s->pend[s->npend++];
+    e->ev     = (uint8_t)w;
+    e->thread = (uint8_t)(w >> 8);
+    e->arg    = (uint16_t)(w >> 16);
+  } else if (port == s->port + 1u && size == 4u) {
+    s->name_lo = w;                     /* slot + 3 chars, rest follows */
+  } else if (port == s->port + 2u && size == 4u) {
+    uint32_t lo = s->name_lo, slot = lo & 0xFFu;
+    if (slot < TRACE_MAX_THREADS) {
+      char *n = s->names.name[slot];
+      n[0] = (char)(lo >> 8); n[1] = (char)(lo >> 16); n[2] = (char)(lo >> 24);
+      n[3] = (char)w; n[4] = (char)(w >> 8); n[5] = (char)(w >> 16); n[6] = (char)(w >> 24);
+      n[7] = '\0';
+    }
+  } else {
+    s->other_port++;
+  }
+}
+
+/* ------------------- ITM packets ------------------- */
+static const unsigned src_size[4] = { 0, 1, 2, 4 };
+
+static void end_continuation(swo_t *s)
+{
+  uint8_t h = s->hdr;
+  if ((h & 0xCFu) == 0xC0u) {           /* local timestamp, format 1 */
+    s->now += s->val;
+    s->lts++;
+    flush(s);
+  } else if (h == 0x94u || h == 0xB4u) {
+    s->gts++;
+  } else {
+    s->ext++;
+  }
+  s->state = 0;
+}
+
+static void feed(swo_t *s, const uint8_t *p, size_t n)
+{
+  size_t i;
+  for (i = 0; i < n; ++i) {
+    uint8_t b = p[i];
+    switch (s->state) {
+      case 1:                           /* source payload */
+        s->val |= (uint32_t)b << (8u * s->got);
+        if (++s->got == s->need) {
+          if (s->hdr & 4u) s->hw++;
+          else             stimulus(s, s->hdr >> 3, s->val, s->need);
+          s->state = 0;
+        }
+        continue;
+      case 2:                           /* continuation bytes, 7 bits each */
+        if (s->shift < 32u) s->val |= (uint32_t)(b & 0x7Fu) << s->shift;
+        s->shift += 7u;
+        if (!(b & 0x80u)) end_continuation(s);
+        continue;
+      default:
+        break;
+    }
+
+    if (b == 0x00u) { s->zeros++; continue; }
+    if (b == 0x80u && s->zeros >= 5u) { s->syncs++; s->zeros = 0; continue; }
+    s->zeros = 0;
+    s->hdr   = b;
+    s->val   = 0;
+    s->shift = 0;
+    if (b == 0x70u) {
+      s->overflows++;
+    } else if ((b & 0x03u) != 0u) {     /* instrumentation or hardware source */
+      s->need  = src_size[b & 3u];
+      s->got   = 0;
+      s->state = 1;
+    } else if ((b & 0x8Fu) == 0x00u) {  /* local timestamp, format 2 */
+      s->now += (b >> 4) & 7u;
+      s->lts++;
+      flush(s);
+    } else if ((b & 0xCFu) == 0xC0u || b == 0x94u || b == 0xB4u) {
+      s->state = 2;                     /* timestamp with continuation */
+    } else if ((b & 0x0Bu) == 0x08u) {  /* extension */
+      if (b & 0x80u) s->state = 2;
+      else           s->ext++;
+    } else {
+      s->reserved++;
+    }
+  }
+  s->bytes += n;
+}
+
+static int decode(const char *path, swo_t *s)
+{
+  static uint8_t buf[SWO_CHUNK];
+  FILE *f = fopen(path, "rb");
+  size_t n;
+
+  if (!f) { perror(path); return 1; }
+  while ((n = fread(buf, 1, sizeof buf, f)) > 0) feed(s, buf, n);
+  fclose(f);
+  flush(s);
+  printf("# %llu bytes: %llu events, last at %llu cycles; %llu syncs, %llu overflows, %llu local / %llu global timestamps,"
+         " %llu extension, %llu hardware, %llu other-port, %llu reserved packets\n",
+         (unsigned long long)s->bytes, (unsigned long long)s->events, (unsigned long long)s->last_ts,
+         (unsigned long long)s->syncs, (unsigned long long)s->overflows, (unsigned long long)s->lts,
+         (unsigned long long)s->gts, (unsigned long long)s->ext, (unsigned long long)s->hw,
+         (unsigned long long)s->other_port, (unsigned long long)s->reserved);
+  return 0;
+}
+
+/* ------------------- g_trace dump, same model ------------------- */
+typedef struct { const trace_names_t *names; double hz; tf_writer_t *out; } ring_ctx_t;
+
+static void ring_print(const trace_ev_t *e, void *ctx)
+{
+  const ring_ctx_t *c = (const ring_ctx_t *)ctx;
+  if (c->out) (void)tf_write(c->out, e);
+  trace_ev_print(stdout, e, c->names, c->hz);
+}
+
+static int read_ring(const char *path, double hz, tf_writer_t *out, trace_names_t *names)
+{
+  ring_ctx_t c;
+  size_t len = 0;
+  uint8_t *img = load_dump(path, &len);
+  long n;
+
+  c.names = names;
+  c.hz    = hz;
+  c.out   = out;
+  n = img ? trace_ring_read(img, len, names, ring_print, &c) : -1;
+  free(img);
+  if (n < 0) { fprintf(stderr, "%s: not a g_trace dump\n", path); return 1; }
+  printf("# %ld events\n", n);
+  return 0;
+}
+
+/* ------------------- Generator ------------------- */
+static void put_sync(FILE *f)
+{
+  static const uint8_t sync[6] = { 0, 0, 0, 0, 0, 0x80 };
+  fwrite(sync, 1, sizeof sync, f);
+}
+
+static void put_src(FILE *f, unsigned port, int hw, uint32_t v, unsigned size)
+{
+  unsigned i;
+  fputc((int)(port << 3 | (hw ? 4u : 0u) | (size == 4u ? 3u : size)), f);
+  for (i = 0; i < size; ++i) fputc((int)((v >> (8u * i)) & 0xFFu), f);
+}
+
+static void put_cont(FILE *f, uint8_t hdr, uint32_t v)
+{
+  fputc(hdr, f);
+  do {
+    uint8_t b = (uint8_t)(v & 0x7Fu);
+    v >>= 7;
+    fputc(v ? b | 0x80u : b, f);
+  } while (v);
+}
+
+static void put_lts(FILE *f, uint32_t d)
+{
+  if (d >= 1u && d <= 6u) fputc((int)(d << 4), f);
+  else                    put_cont(f, 0xC0u, d);
+}
+
+static int generate(const char *path, uint64_t events, unsigned seed)
+{
+  static const char *const names[3] = { "painter", "morse", "robot" };
+  FILE *f = fopen(path, "wb");
+  uint64_t k, now = 0;
+  unsigned i;
+
+  if (!f) { perror(path); return 1; }
+  setvbuf(f, NULL, _IOFBF, SWO_CHUNK);
+  srand(seed);
+  put_sync(f);
+  for (i = 0; i < 3u; ++i) {
+    uint8_t n[8] = { 0 };
+    memcpy(n, names[i], strlen(names[i]));
+    put_src(f, TRACE_ITM_PORT + 1u, 0, i | n[0] << 8 | n[1] << 16 | (uint32_t)n[2] << 24, 4u);
+    put_src(f, TRACE_ITM_PORT + 2u, 0, n[3] | n[4] << 8 | n[5] << 16 | (uint32_t)n[6] << 24, 4u);
+  }
+  for (k = 0; k < events; ++k) {
+    unsigned t = (unsigned)rand() % 3u;
+    uint32_t d = (k % 7u == 0u) ? 1u + (uint32_t)rand() % 6u : 100u + (uint32_t)rand() % 200000u;
+    put_src(f, TRACE_ITM_PORT, 0, (uint32_t)(TR_PT_RELEASE + t) | t << 8 | (uint32_t)(k & 0xFFFFu) << 16, 4u);
+    now += d;
+    put_lts(f, d);
+    if (k % 97u == 0u)    put_src(f, 0, 0, 'A' + (uint32_t)(k % 26u), 1u);   /* printf on port 0 */
+    if (k % 101u == 0u)   put_src(f, 2, 1, (uint32_t)rand(), 4u);            /* DWT PC sample */
+    if (k % 1009u == 0u)  put_cont(f, 0x94u, (uint32_t)k);                   /* global timestamp */
+    if (k % 4099u == 0u)  put_sync(f);
+    if (k % 50021u == 0u) fputc(0x70, f);                                    /* overflow */
+  }
+  if (fclose(f) != 0) { perror(path); return 1; }
+  printf("# %llu events, last at %llu cycles\n", (unsigned long long)events, (unsigned long long)now);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  static swo_t s;
+  static tf_writer_t w;
+  const char *path = NULL, *out = NULL;
+  uint64_t gen = 0;
+  unsigned seed = 1u;
+  int ring = 0, i, rc;
+
+  s.port = TRACE_ITM_PORT;
+  s.hz   = 100e6;
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-c") && i + 1 < argc)      s.hz   = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-p") && i + 1 < argc) s.port = (unsigned)strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-g") && i + 1 < argc) gen    = strtoull(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc) seed   = (unsigned)strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-w") && i + 1 < argc) out    = argv[++i];
+    else if (!strcmp(argv[i], "-q"))                 s.quiet = 1;
+    else if (!strcmp(argv[i], "-R"))                 ring   = 1;
+    else if (argv[i][0] != '-' && !path)             path   = argv[i];
+    else { path = NULL; break; }
+  }
+  if (!path || s.port > 29u) {
+    fprintf(stderr, "usage: %s [-c core_hz] [-p port] [-q] [-w out.trf] capture.swo\n"
+                    "       %s [-c core_hz] [-w out.trf] -R trace.{hex,bin}\n"
+                    "       %s -g events [-s seed] capture.swo\n", argv[0], argv[0], argv[0]);
+    return 2;
+  }
+  if (gen) return generate(path, gen, seed);
+  if (out) {
+    if (tf_create(&w, out, (uint32_t)s.hz, 0) != 0) { perror(out); return 1; }
+    s.out = &w;
+  }
+  rc = ring ? read_ring(path, s.hz, s.out, &s.names) : decode(path, &s);
+  if (out) {
+    tf_set_names(&w, &s.names);
+    if (tf_finish(&w) != 0) { fprintf(stderr, "%s: write failed\n", out); rc = 1; }
+  }
+  return rc;
+}
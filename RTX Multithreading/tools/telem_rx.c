@@ -0,0 +1,317 @@
+/* COE718 Lab 3a - host receiver for the UART telemetry stream (telem.h)
+ *
+ * Build:  cc -std=c99 -O2 -I.. -Ihost -o telem_rx telem_rx.c ../telem_frame.c trace_file.c
+ * Usage:  telem_rx [-b baud] [-c core_hz] [-q] [-w out.trf] device|pty|file
+ *         telem_rx -g frames [-e every] device|pty|file
+ *
+ * Reads frames from a serial device (switched to raw 8N1 at -b), a pty or
+ * a captured file, resynchronises on the sync bytes after noise or a CRC
+ * error and prints every record; -q prints the summary only.  At end of
+ * file, or on ^C, it reports frames decoded, CRC failures, bytes skipped,
+ * frames lost to sequence gaps and the target's last drop counters.
+ * -w also stores the trace events in an indexed trace file (trace_file.h).
+ *
+ * -g writes a synthetic stream with the target's encoder instead, with
+ * noise between frames, one frame in every -e (default 7) corrupted and a
+ * skipped sequence number after it, so the receiver can be checked end to
+ * end without a board:
+ *
+ *   telem_rx -g 500 tm.bin && telem_rx -q tm.bin
+ *   socat -d -d pty,raw,echo=0 pty,raw,echo=0      # prints two /dev/pts/N
+ *   telem_rx /dev/pts/A &  telem_rx -g 500 /dev/pts/B
+ */
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <termios.h>
+#include <unistd.h>
+#include "telem.h"
+#include "qstat.h"
+#include "trace_model.h"
+#include "trace_file.h"
+
+typedef struct {
+  uint64_t frames, crc_fail, skipped, lost, records;
+  uint32_t drop[4];                     /* last TM_REC_DROP */
+  int      have_seq;
+  uint8_t  seq;
+  uint32_t ts_prev;                     /* widens trace timestamps */
+  uint64_t ts_hi;
+} rx_stat_t;
+
+static volatile sig_atomic_t rx_stop;
+static double rx_hz = 100e6;
+static int    rx_quiet;
+static trace_names_t rx_thread;
+static tf_writer_t  *rx_out;            /* -w, NULL = none */
+static char   rx_counter[256][TM_NAME_LEN + 1];
+
+static uint32_t rd32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint16_t rd16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+static void on_sigint(int s) { (void)s; rx_stop = 1; }
+
+static speed_t baud_const(long b)
+{
+  switch (b) {
+    case 9600:    return B9600;
+    case 19200:   return B19200;
+    case 38400:   return B38400;
+    case 57600:   return B57600;
+    case 115200:  return B115200;
+    case 230400:  return B230400;
+    case 460800:  return B460800;
+    case 921600:  return B921600;
+    default:      return 0;
+  }
+}
+
+/* raw 8N1 on a tty; files and pipes are left alone */
+static int set_raw(int fd, long baud)
+{
+  struct termios tio;
+  speed_t sp = baud_const(baud);
+
+  if (!isatty(fd)) return 0;
+  if (!sp) { fprintf(stderr, "unsupported baud %ld\n", baud); return -1; }
+  if (tcgetattr(fd, &tio) != 0) { perror("tcgetattr"); return -1; }
+  cfmakeraw(&tio);
+  tio.c_cflag |= CLOCAL | CREAD;
+  tio.c_cc[VMIN]  = 1;
+  tio.c_cc[VTIME] = 0;
+  cfsetispeed(&tio, sp);
+  cfsetospeed(&tio, sp);
+  return tcsetattr(fd, TCSANOW, &tio) == 0 ? 0 : (perror("tcsetattr"), -1);
+}
+
+/* ------------------- Records ------------------- */
+static void record(rx_stat_t *st, uint8_t type, const uint8_t *b, uint8_t len)
+{
+  st->records++;
+  switch (type) {
+    case TM_REC_NAME:
+      if (len < 2u + TM_NAME_LEN) break;
+      if (b[0])                           memcpy(rx_counter[b[1]], b + 2, TM_NAME_LEN);
+      else if (b[1] < TRACE_MAX_THREADS)  memcpy(rx_thread.name[b[1]], b + 2, TRACE_NAME_LEN);
+      break;
+    case TM_REC_TRACE: {
+      trace_ev_t e;
+      if (len < 8u) break;
+      if (rd32(b) < st->ts_prev) st->ts_hi += 1ull << 32;
+      st->ts_prev = rd32(b);
+      e.ts     = st->ts_hi | st->ts_prev;
+      e.ev     = b[4];
+      e.thread = b[5];
+      e.arg    = rd16(b + 6);
+      if (rx_out) (void)tf_write(rx_out, &e);
+      if (!rx_quiet) trace_ev_print(stdout, &e, &rx_thread, rx_hz);
+      break;
+    }
+    case TM_REC_COUNTER:
+      if (len < 5u || rx_quiet) break;
+      printf("  counter %-8s = %u\n", rx_counter[b[0]][0] ? rx_counter[b[0]] : "?", rd32(b + 1));
+      break;
+    case TM_REC_UTIL:
+      if (len < 6u || rx_quiet) break;
+      printf("  busy %5.1f %% over %.1f ms\n", rd16(b) / 10.0, rd32(b + 2) / rx_hz * 1e3);
+      break;
+    case TM_REC_DROP: {
+      uint32_t d[4];
+      if (len < 16u) break;
+      d[0] = rd32(b); d[1] = rd32(b + 4); d[2] = rd32(b + 8); d[3] = rd32(b + 12);
+      if (!rx_quiet && memcmp(st->drop, d, sizeof d))
+        printf("  target drops: %u frames, %u records, %u trace events, %u DMA errors\n", d[0], d[1], d[2], d[3]);
+      memcpy(st->drop, d, sizeof d);
+      break;
+    }
+    case TM_REC_QSTAT: {
+      static const char *const qs_names[QS_METRICS] = QS_NAMES;
+      if (len < 1u + 4u * (5u + QS_NQ) || rx_quiet) break;
+      printf("  stat %-8s n=%u min %.1f max %.1f mean %.1f sd %.1f  p50 %.1f p90 %.1f p99 %.1f p99.9 %.1f us\n",
+             b[0] < QS_METRICS ? qs_names[b[0]] : "?", rd32(b + 1),
+             rd32(b + 5) / rx_hz * 1e6, rd32(b + 9) / rx_hz * 1e6, rd32(b + 13) / rx_hz * 1e6,
+             rd32(b + 17) / rx_hz * 1e6, rd32(b + 21) / rx_hz * 1e6, rd32(b + 25) / rx_hz * 1e6,
+             rd32(b + 29) / rx_hz * 1e6, rd32(b + 33) / rx_hz * 1e6);
+      break;
+    }
+    default:
+      break;                            /* newer record type: skip */
+  }
+}
+
+static void frame(rx_stat_t *st, const uint8_t *f)
+{
+  uint8_t seq = f[2], len = f[3], k = 0;
+
+  if (st->have_seq) st->lost += (uint8_t)(seq - st->seq - 1u);
+  st->seq = seq;
+  st->have_seq = 1;
+  st->frames++;
+  while (k + 2u <= len) {
+    const uint8_t *r = f + TM_HDR_BYTES + k;
+    if (k + 2u + r[1] > len) break;
+    record(st, r[0], r + 2, r[1]);
+    k = (uint8_t)(k + 2u + r[1]);
+  }
+}
+
+/* Consumes whole frames from buf[0..n); returns the bytes used. */
+static size_t parse(rx_stat_t *st, const uint8_t *buf, size_t n)
+{
+  size_t i = 0;
+
+  while (i + TM_HDR_BYTES <= n) {
+    size_t flen;
+    if (buf[i] != TM_SYNC0 || buf[i + 1] != TM_SYNC1 || buf[i + 3] > TM_PAYLOAD_MAX) {
+      i++; st->skipped++;
+      continue;
+    }
+    flen = TM_HDR_BYTES + buf[i + 3] + 2u;
+    if (i + flen > n) break;            /* wait for the rest */
+    if (tm_crc16(buf + i + 2, (uint32_t)flen - 4u) != rd16(buf + i + flen - 2)) {
+      i++; st->skipped++; st->crc_fail++;
+      continue;
+    }
+    frame(st, buf + i);
+    i += flen;
+  }
+  return i;
+}
+
+static int receive(const char *path, long baud)
+{
+  static uint8_t buf[1u << 16];
+  rx_stat_t st;
+  size_t have = 0;
+  struct sigaction sa;
+  int fd = open(path, O_RDONLY | O_NOCTTY);
+
+  if (fd < 0) { perror(path); return 1; }
+  if (set_raw(fd, baud) != 0) { close(fd); return 1; }
+  memset(&st, 0, sizeof st);
+  memset(&sa, 0, sizeof sa);
+  sa.sa_handler = on_sigint;            /* no SA_RESTART: read() returns EINTR */
+  sigaction(SIGINT, &sa, NULL);
+
+  while (!rx_stop) {
+    ssize_t r = read(fd, buf + have, sizeof buf - have);
+    size_t used;
+    if (r < 0 && errno == EINTR) continue;
+    if (r <= 0) break;
+    have += (size_t)r;
+    used = parse(&st, buf, have);
+    memmove(buf, buf + used, have - used);
+    have -= used;
+  }
+  close(fd);
+  st.skipped += have;
+
+  printf("# %llu frames, %llu records, %llu lost (sequence gaps), %llu CRC failures, %llu bytes skipped\n",
+         (unsigned long long)st.frames, (unsigned long long)st.records, (unsigned long long)st.lost,
+         (unsigned long long)st.crc_fail, (unsigned long long)st.skipped);
+  printf("# target drops: %u frames, %u records, %u trace events, %u DMA errors\n",
+         st.drop[0], st.drop[1], st.drop[2], st.drop[3]);
+  if (rx_out) {
+    tf_set_names(rx_out, &rx_thread);
+    if (tf_finish(rx_out) != 0) { fprintf(stderr, "trace file write failed\n"); return 1; }
+  }
+  return 0;
+}
+
+/* ------------------- Generator ------------------- */
+static void put32(uint8_t *p, uint32_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24); }
+
+static int generate(const char *path, unsigned frames, unsigned every, long baud)
+{
+  static const char *const names[3] = { "painter", "morse", "robot" };
+  tm_frame_t f;
+  uint8_t b[2u + TM_NAME_LEN];
+  uint8_t seq = 0;
+  uint32_t ts = 0, acts[3] = { 0, 0, 0 };
+  unsigned k, i, bad = 0;
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_NOCTTY, 0644);
+
+  if (fd < 0) { perror(path); return 1; }
+  if (set_raw(fd, baud) != 0) { close(fd); return 1; }
+  srand(1u);
+  for (k = 0; k < frames; ++k) {
+    uint32_t len;
+    tm_frame_begin(&f, seq++);
+    if (k % 20u == 0u) {
+      for (i = 0; i < 3u; ++i) {
+        memset(b, 0, sizeof b);
+        b[0] = 0; b[1] = (uint8_t)i;
+        memcpy(b + 2, names[i], strlen(names[i]));
+        (void)tm_frame_add(&f, TM_REC_NAME, b, sizeof b);
+        b[0] = 1;
+        (void)tm_frame_add(&f, TM_REC_NAME, b, sizeof b);
+      }
+    }
+    for (i = 0; i < 3u; ++i) {
+      uint8_t c[5];
+      acts[i] += 1u + (uint32_t)(rand() % 2);
+      c[0] = (uint8_t)i;
+      put32(c + 1, acts[i]);
+      (void)tm_frame_add(&f, TM_REC_COUNTER, c, 5u);
+    }
+    for (;;) {                          /* fill with trace events */
+      uint8_t t[8];
+      ts += 1000u + (uint32_t)(rand() % 50000);
+      put32(t, ts);
+      t[4] = (uint8_t)(TR_PT_RELEASE + rand() % 3);
+      t[5] = (uint8_t)(rand() % 3);
+      t[6] = t[5]; t[7] = 0;
+      if (tm_frame_add(&f, TM_REC_TRACE, t, 8u) != 0) break;
+    }
+    len = tm_frame_end(&f);
+    if (every && k % every == every - 1u) {
+      f.buf[TM_HDR_BYTES + (unsigned)rand() % (len - TM_HDR_BYTES - 2u)] ^= 0x10u;
+      seq++;                            /* and a gap after it */
+      bad++;
+    }
+    if (write(fd, f.buf, len) != (ssize_t)len) { perror(path); close(fd); return 1; }
+    if (k % 3u == 0u) {                 /* line noise, with a false sync */
+      static const uint8_t noise[5] = { 0x00, 0xA5, 0x5A, 0x07, 0xFF };
+      if (write(fd, noise, sizeof noise) != (ssize_t)sizeof noise) { perror(path); close(fd); return 1; }
+    }
+  }
+  close(fd);
+  fprintf(stderr, "# %u frames written, %u corrupted and each followed by a sequence gap\n", frames, bad);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  static tf_writer_t w;
+  const char *path = NULL, *out = NULL;
+  long baud = TM_BAUD;
+  unsigned gen = 0, every = 7;
+  int i;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-b") && i + 1 < argc)      baud   = strtol(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-c") && i + 1 < argc) rx_hz  = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-g") && i + 1 < argc) gen    = (unsigned)strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-e") && i + 1 < argc) every  = (unsigned)strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-w") && i + 1 < argc) out    = argv[++i];
+    else if (!strcmp(argv[i], "-q"))                 rx_quiet = 1;
+    else if (argv[i][0] != '-' && !path)             path   = argv[i];
+    else { path = NULL; break; }
+  }
+  if (!path) {
+    fprintf(stderr, "usage: %s [-b baud] [-c core_hz] [-q] [-w out.trf] device|pty|file\n"
+                    "       %s -g frames [-e every] device|pty|file\n", argv[0], argv[0]);
+    return 2;
+  }
+  if (gen) return generate(path, gen, every, baud);
+  if (out) {
+    if (tf_create(&w, out, (uint32_t)rx_hz, 0) != 0) { perror(out); return 1; }
+    rx_out = &w;
+  }
+  return receive(path, baud);
+}
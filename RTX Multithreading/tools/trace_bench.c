@@ -0,0 +1,201 @@
+/* COE718 Lab 3a - benchmark of the indexed trace file (trace_file.h)
+ *
+ * Build:  cc -std=c99 -O2 -I.. -Ihost -o trace_bench trace_bench.c trace_file.c
+ * Usage:  trace_bench [-n events] [-b block_events] [-q queries] [-w window_us] [-k] file.trf
+ *
+ * Writes a synthetic soak trace of -n events (default 100M) shaped like
+ * the round-robin demos: four threads rotating on RR slices with job and
+ * mutex events in between, 5 ms kernel ticks, timestamps at 100 MHz.  It
+ * then maps the file back and reports
+ *
+ *   write     events/s and bytes per event
+ *   scan      one pass over every block, events/s
+ *   seek      -q random windows of -w microseconds (default 1000), half
+ *             of them filtered to one thread: mean and worst time per
+ *             query and blocks unpacked per query
+ *
+ * The scan pass also recounts eight of the windows by brute force and
+ * checks the event count and a checksum against the writer's, so a wrong
+ * index or a packing bug fails the run.  -k keeps the file.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "trace_file.h"
+
+#define TB_HZ      100000000u
+#define TB_THREADS 4u
+#define TB_CHECKS  8u
+
+static double now_s(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng = 88172645463325252ull;
+
+static uint32_t xorshift(void)
+{
+  rng ^= rng << 13;
+  rng ^= rng >> 7;
+  rng ^= rng << 17;
+  return (uint32_t)(rng >> 16);
+}
+
+static uint64_t mix(uint64_t h, const trace_ev_t *e)
+{
+  h ^= e->ts + ((uint64_t)e->ev << 40) + ((uint64_t)e->thread << 48) + ((uint64_t)e->arg << 24);
+  return h * 0x100000001B3ull;
+}
+
+/* ------------------- Synthetic trace ------------------- */
+/* Next event of a round-robin soak: a rotation every slice, a few job
+   and mutex events inside it, the ISR tick every 5 ms. */
+static void next_event(trace_ev_t *e, uint64_t *ts, unsigned *cur, uint64_t *next_tick)
+{
+  uint32_t r = xorshift();
+
+  *ts += 200u + r % 20000u;
+  if (*ts >= *next_tick) {
+    *ts = *next_tick;
+    *next_tick += TB_HZ / 200u;
+    e->ev = TR_USER; e->thread = TRACE_NO_THREAD; e->arg = 0;
+  } else if (r % 8u == 0u) {
+    *cur = (*cur + 1u) % TB_THREADS;
+    e->ev = TR_RR_ROTATE; e->thread = (uint8_t)*cur; e->arg = (uint16_t)(r >> 16);
+  } else {
+    static const uint8_t kinds[4] = { TR_JOB_START, TR_JOB_END, TR_MUTEX_ACQUIRE, TR_MUTEX_RELEASE };
+    e->ev = kinds[(r >> 3) & 3u]; e->thread = (uint8_t)*cur; e->arg = (uint16_t)(r >> 20);
+  }
+  e->ts = *ts;
+}
+
+/* ------------------- Checks ------------------- */
+typedef struct {
+  uint64_t t0, t1;
+  uint32_t mask;
+  long long brute, indexed;
+} window_t;
+
+typedef struct {
+  uint64_t  events, hash;
+  window_t *w;
+} scan_t;
+
+static void on_scan(const trace_ev_t *e, void *ctx)
+{
+  scan_t *s = (scan_t *)ctx;
+  unsigned i;
+  s->events++;
+  s->hash = mix(s->hash, e);
+  for (i = 0; i < TB_CHECKS; ++i)
+    if (e->ts >= s->w[i].t0 && e->ts < s->w[i].t1 && (tf_thread_bit(e->thread) & s->w[i].mask)) s->w[i].brute++;
+}
+
+static void on_query(const trace_ev_t *e, void *ctx)
+{
+  (*(uint64_t *)ctx)++;
+  (void)e;
+}
+
+static void pick_window(window_t *w, const tf_header_t *h, double window_us, int filtered)
+{
+  uint64_t span = h->t_last - h->t_first + 1u;
+  uint64_t len  = (uint64_t)(window_us * h->hz / 1e6);
+  w->t0 = h->t_first + (((uint64_t)xorshift() << 32 | xorshift()) % span);
+  w->t1 = w->t0 + len;
+  w->mask = filtered ? tf_thread_bit((uint8_t)(xorshift() % TB_THREADS)) : TF_ALL_THREADS;
+  w->brute = w->indexed = 0;
+}
+
+int main(int argc, char **argv)
+{
+  static tf_writer_t w;
+  static tf_reader_t r;
+  static trace_names_t names = { { "rr_a", "rr_b", "rr_c", "rr_d" } };
+  const char *path = NULL;
+  uint64_t n = 100000000ull, k, ts = 0, next_tick = TB_HZ / 200u, hash = 0, blocks_read = 0;
+  uint32_t block = TF_BLOCK_EVENTS, queries = 10000u;
+  double window_us = 1000.0, t, worst = 0.0, total = 0.0;
+  window_t check[TB_CHECKS];
+  unsigned cur = 0;
+  int keep = 0, i, bad = 0;
+  scan_t s;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc)      n         = strtoull(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-b") && i + 1 < argc) block     = (uint32_t)strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-q") && i + 1 < argc) queries   = (uint32_t)strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-w") && i + 1 < argc) window_us = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-k"))                 keep      = 1;
+    else if (argv[i][0] != '-' && !path)             path      = argv[i];
+    else { path = NULL; break; }
+  }
+  if (!path || n == 0u || window_us <= 0.0) {
+    fprintf(stderr, "usage: %s [-n events] [-b block_events] [-q queries] [-w window_us] [-k] file.trf\n", argv[0]);
+    return 2;
+  }
+
+  /* write */
+  t = now_s();
+  if (tf_create(&w, path, TB_HZ, block) != 0) { perror(path); return 1; }
+  tf_set_names(&w, &names);
+  for (k = 0; k < n; ++k) {
+    trace_ev_t e;
+    next_event(&e, &ts, &cur, &next_tick);
+    hash = mix(hash, &e);
+    if (tf_write(&w, &e) != 0) break;
+  }
+  if (tf_finish(&w) != 0 || k != n) { fprintf(stderr, "%s: write failed\n", path); return 1; }
+  t = now_s() - t;
+
+  if (tf_open(&r, path) != 0) { fprintf(stderr, "%s: not a trace file\n", path); return 1; }
+  printf("write   %llu events in %.2f s, %.1f M events/s; %.1f MB, %.2f bytes/event, %llu blocks of %u\n",
+         (unsigned long long)n, t, n / t / 1e6, r.len / 1e6, (double)r.len / n,
+         (unsigned long long)r.hdr->blocks, r.hdr->block_events);
+
+  /* scan, with the brute-force recount of the check windows */
+  for (i = 0; i < (int)TB_CHECKS; ++i) pick_window(&check[i], r.hdr, window_us, i & 1);
+  memset(&s, 0, sizeof s);
+  s.w = check;
+  t = now_s();
+  if (tf_scan(&r, 0, UINT64_MAX, TF_ALL_THREADS, on_scan, &s) < 0) { fprintf(stderr, "%s: corrupt block\n", path); return 1; }
+  t = now_s() - t;
+  printf("scan    %llu events in %.2f s, %.1f M events/s\n", (unsigned long long)s.events, t, s.events / t / 1e6);
+  if (s.events != n || s.hash != hash) { printf("FAIL    scan count or checksum differs from the writer\n"); bad = 1; }
+  for (i = 0; i < (int)TB_CHECKS; ++i) {
+    uint64_t c = 0;
+    check[i].indexed = tf_scan(&r, check[i].t0, check[i].t1, check[i].mask, on_query, &c);
+    if (check[i].indexed != check[i].brute || (long long)c != check[i].brute) {
+      printf("FAIL    window %d: %lld indexed, %lld brute force\n", i, check[i].indexed, check[i].brute);
+      bad = 1;
+    }
+  }
+
+  /* seek */
+  for (k = 0; k < queries; ++k) {
+    window_t q;
+    uint64_t c = 0, b;
+    double dt;
+    pick_window(&q, r.hdr, window_us, (int)(k & 1u));
+    t  = now_s();
+    if (tf_scan(&r, q.t0, q.t1, q.mask, on_query, &c) < 0) { bad = 1; break; }
+    dt = now_s() - t;
+    total += dt;
+    if (dt > worst) worst = dt;
+    for (b = tf_find(&r, q.t0); b < r.hdr->blocks && r.index[b].t_first < q.t1; ++b)
+      if (r.index[b].threads & q.mask) blocks_read++;
+  }
+  if (queries)
+    printf("seek    %u windows of %.0f us: %.2f us mean, %.2f us worst, %.2f blocks unpacked per query\n",
+           queries, window_us, total / queries * 1e6, worst * 1e6, (double)blocks_read / queries);
+
+  tf_close(&r);
+  if (!keep) remove(path);
+  printf("%s\n", bad ? "FAIL" : "ok");
+  return bad;
+}
@@ -0,0 +1,102 @@
+/* COE718 Lab 3a - prints a time window of an indexed trace file (trace_file.h)
+ *
+ * Build:  cc -std=c99 -O2 -I.. -Ihost -o trace_cat trace_cat.c trace_file.c
+ * Usage:  trace_cat [-t from_us[:to_us]] [-T thread] [-i] file.trf
+ *
+ * Prints the events from from_us (default the start) up to but not
+ * including to_us (default the end), in the trace_model.h text format,
+ * optionally only those of one thread, given by name or slot number.
+ * Times are microseconds of the trace clock, as printed.  Only the
+ * blocks overlapping the window are read, so a window deep into a soak
+ * capture costs the same as one at its start.  -i prints the header and
+ * the block index instead.
+ *
+ *   swo_decode -q -w soak.trf soak.swo && trace_cat -t 3600e6:3600.01e6 soak.trf
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace_file.h"
+
+typedef struct { const trace_names_t *names; double hz; } cat_t;
+
+static void print_ev(const trace_ev_t *e, void *ctx)
+{
+  const cat_t *c = (const cat_t *)ctx;
+  trace_ev_print(stdout, e, c->names, c->hz);
+}
+
+static int thread_slot(const trace_names_t *n, const char *s)
+{
+  char *end;
+  unsigned long v = strtoul(s, &end, 0);
+  unsigned t;
+
+  if (*s && !*end && v < TRACE_MAX_THREADS) return (int)v;
+  for (t = 0; t < TRACE_MAX_THREADS; ++t)
+    if (n->name[t][0] && !strncmp(n->name[t], s, TRACE_NAME_LEN)) return (int)t;
+  return -1;
+}
+
+static void print_index(const tf_reader_t *r)
+{
+  const tf_header_t *h = r->hdr;
+  uint64_t b;
+  unsigned t;
+
+  printf("# %llu events in %llu blocks of %u, %.1f bytes/event, %u Hz, %.3f s\n",
+         (unsigned long long)h->events, (unsigned long long)h->blocks, h->block_events,
+         h->events ? (double)r->len / h->events : 0.0, h->hz, (double)(h->t_last - h->t_first) / h->hz);
+  for (t = 0; t < TRACE_MAX_THREADS; ++t)
+    if (r->names.name[t][0]) printf("# thread %u %s\n", t, r->names.name[t]);
+  for (b = 0; b < h->blocks; ++b) {
+    const tf_index_t *x = &r->index[b];
+    printf("%8llu  @%-12llu %5u events %6u bytes  %14.1f .. %14.1f us  threads %08X events %08X\n",
+           (unsigned long long)b, (unsigned long long)x->offset, x->count, x->bytes,
+           (double)x->t_first / h->hz * 1e6, (double)x->t_last / h->hz * 1e6,
+           x->threads, x->evs);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  static tf_reader_t r;
+  const char *path = NULL, *window = NULL, *thread = NULL;
+  uint64_t t0 = 0, t1 = UINT64_MAX;
+  uint32_t mask = TF_ALL_THREADS;
+  int index = 0, i;
+  long long n;
+  cat_t c;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-t") && i + 1 < argc)      window = argv[++i];
+    else if (!strcmp(argv[i], "-T") && i + 1 < argc) thread = argv[++i];
+    else if (!strcmp(argv[i], "-i"))                 index  = 1;
+    else if (argv[i][0] != '-' && !path)             path   = argv[i];
+    else { path = NULL; break; }
+  }
+  if (!path) {
+    fprintf(stderr, "usage: %s [-t from_us[:to_us]] [-T thread] [-i] file.trf\n", argv[0]);
+    return 2;
+  }
+  if (tf_open(&r, path) != 0) { fprintf(stderr, "%s: not a trace file\n", path); return 1; }
+  if (index) { print_index(&r); tf_close(&r); return 0; }
+
+  c.names = &r.names;
+  c.hz    = r.hdr->hz ? r.hdr->hz : 100e6;
+  if (window) {
+    char *end;
+    t0 = (uint64_t)(strtod(window, &end) * c.hz / 1e6);
+    if (*end == ':') t1 = (uint64_t)(strtod(end + 1, NULL) * c.hz / 1e6);
+  }
+  if (thread) {
+    int t = thread_slot(&r.names, thread);
+    if (t < 0) { fprintf(stderr, "%s: no thread %s\n", path, thread); tf_close(&r); return 1; }
+    mask = tf_thread_bit((uint8_t)t);
+  }
+  n = tf_scan(&r, t0, t1, mask, print_ev, &c);
+  tf_close(&r);
+  if (n < 0) { fprintf(stderr, "%s: corrupt block\n", path); return 1; }
+  printf("# %lld events\n", n);
+  return 0;
+}
@@ -0,0 +1,363 @@
+/* COE718 Lab 3a - trace to Chrome trace JSON, for Perfetto or chrome://tracing
+ *
+ * Build:  cc -std=c99 -O2 -I.. -Ihost -o trace_chrome trace_chrome.c trace_file.c
+ * Usage:  trace_chrome [-c core_hz] [-S bit=name]... [-o out.json] trace.{trf,hex,bin}
+ *
+ * Reads an indexed trace file (swo_decode -w for SWO, telem_rx -w for the
+ * UART stream) or a g_trace RAM dump and writes the Chrome trace event
+ * JSON that ui.perfetto.dev and chrome://tracing open directly:
+ *
+ *   CPU       one lane of run slices, the thread each event came from.
+ *             A slice starts at a thread's first event after another
+ *             thread's and ends at the next thread's first event; the
+ *             switch itself happened in between ("last" in its args is
+ *             the thread's last event), so a preemption point is where
+ *             one colour meets the next.
+ *   threads   one track per thread (and ISR): mutex wait and hold, job,
+ *             periodic job and LCD I/O spans, everything else as
+ *             instants.  TRACE_SIGNAL_SET/WAIT hand-offs are drawn as
+ *             flow arrows from the sender to the woken thread, labelled
+ *             with the -S names (default sigN).
+ *
+ * Events are converted as they are read, with per-thread state only, so
+ * memory stays constant however long the capture; a .trf file is mapped,
+ * not loaded.  Events are formatted by hand rather than with printf,
+ * about two million a second on a desktop.
+ *
+ *   trace_chrome -S 0=SIG_MM_TO_CPU -S 1=SIG_CPU_TO_MM -S 2=SIG_APP_READY \
+ *                -S 3=SIG_DEV_DONE -S 4=SIG_UI_DONE -o t2.json t2.trf
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace_model.h"
+#include "trace_file.h"
+#include "dump_image.h"
+
+#define PID_CPU     1
+#define PID_THREADS 2
+#define NSLOTS      (TRACE_MAX_THREADS + 1u)   /* last one: ISR / unregistered */
+#define NSIGS       16u
+#define NAME_MAX_LEN 40u                /* of any name written */
+
+typedef struct {
+  uint32_t wait, hold, pt, lcd;         /* open spans, bit = arg & 31 */
+  uint32_t jobs;                        /* open job spans */
+} open_t;
+
+typedef struct {
+  FILE         *f;
+  uint64_t      hz;
+  char          line[256];              /* event being formatted */
+  trace_names_t names;
+  const char   *sig[NSIGS];
+  int           first;                  /* no event written yet */
+  int           named;                  /* thread_name metadata written */
+  /* CPU lane */
+  unsigned      run;                    /* slot on the CPU, NSLOTS = none */
+  uint64_t      run_start, run_last, last_ts;
+  /* thread tracks */
+  open_t        open[NSLOTS];
+  uint32_t      flow[NSLOTS][NSIGS];    /* pending hand-off id, 0 = none */
+  uint32_t      next_flow;
+  uint64_t      events;
+} chrome_t;
+
+static unsigned slot_of(uint8_t thread) { return thread < TRACE_MAX_THREADS ? thread : TRACE_MAX_THREADS; }
+static int      tid_of(unsigned slot)   { return slot < TRACE_MAX_THREADS ? (int)slot : (int)TRACE_NO_THREAD; }
+
+static const char *slot_name(const chrome_t *c, unsigned slot)
+{
+  if (slot >= TRACE_MAX_THREADS) return "ISR";
+  return c->names.name[slot][0] ? c->names.name[slot] : "?";
+}
+
+static const char *sig_name(const chrome_t *c, unsigned bit, char *buf)
+{
+  if (c->sig[bit]) return c->sig[bit];
+  sprintf(buf, "sig%u", bit);
+  return buf;
+}
+
+/* ------------------- JSON ------------------- */
+/* names lose anything JSON would need escaped */
+static char *put_name(char *p, const char *s)
+{
+  unsigned n;
+  for (n = 0; s[n] && n < NAME_MAX_LEN; ++n) *p++ = (s[n] == '"' || s[n] == '\\' || (unsigned char)s[n] < 0x20u) ? '_' : s[n];
+  return p;
+}
+
+static char *put_str(char *p, const char *s)
+{
+  while (*s) *p++ = *s++;
+  return p;
+}
+
+static char *put_uint(char *p, uint64_t v)
+{
+  char t[20];
+  int n = 0;
+  do { t[n++] = (char)('0' + v % 10u); v /= 10u; } while (v);
+  while (n) *p++ = t[--n];
+  return p;
+}
+
+/* cycles as microseconds, three decimals */
+static char *put_us(const chrome_t *c, char *p, uint64_t cyc)
+{
+  uint64_t ns = cyc / c->hz * 1000000000u + cyc % c->hz * 1000000000u / c->hz;
+  p = put_uint(p, ns / 1000u);
+  *p++ = '.';
+  *p++ = (char)('0' + ns / 100u % 10u);
+  *p++ = (char)('0' + ns / 10u % 10u);
+  *p++ = (char)('0' + ns % 10u);
+  return p;
+}
+
+static char *head(chrome_t *c, char ph, const char *name, const char *cat, int pid, int tid, uint64_t ts)
+{
+  char *p = c->line;
+  if (!c->first) *p++ = ',';
+  c->first = 0;
+  p = put_str(p, "\n{\"ph\":\"");
+  *p++ = ph;
+  p = put_str(p, "\",\"name\":\"");
+  p = put_name(p, name);
+  p = put_str(p, "\",\"cat\":\"");
+  p = put_str(p, cat);
+  p = put_str(p, "\",\"pid\":");
+  p = put_uint(p, (uint64_t)pid);
+  p = put_str(p, ",\"tid\":");
+  p = put_uint(p, (uint64_t)tid);
+  p = put_str(p, ",\"ts\":");
+  return put_us(c, p, ts);
+}
+
+static void emit(chrome_t *c, char *p, const char *tail)
+{
+  p = put_str(p, tail);
+  fwrite(c->line, 1, (size_t)(p - c->line), c->f);
+}
+
+static void meta(chrome_t *c, const char *what, int pid, int tid, const char *name)
+{
+  char *p = c->line;
+  if (!c->first) *p++ = ',';
+  c->first = 0;
+  p = put_str(p, "\n{\"ph\":\"M\",\"name\":\"");
+  p = put_str(p, what);
+  p = put_str(p, "\",\"pid\":");
+  p = put_uint(p, (uint64_t)pid);
+  p = put_str(p, ",\"tid\":");
+  p = put_uint(p, (uint64_t)tid);
+  p = put_str(p, ",\"args\":{\"name\":\"");
+  p = put_name(p, name);
+  emit(c, p, "\"}}");
+}
+
+static void span(chrome_t *c, char ph, const char *kind, unsigned arg, unsigned slot, uint64_t ts)
+{
+  char name[24], *p;
+  sprintf(name, "%s %u", kind, arg);
+  p = head(c, ph, name, kind, PID_THREADS, tid_of(slot), ts);
+  emit(c, p, "}");
+}
+
+static void instant(chrome_t *c, const trace_ev_t *e, unsigned slot)
+{
+  char *p = head(c, 'i', trace_ev_name(e->ev), "event", PID_THREADS, tid_of(slot), e->ts);
+  p = put_str(p, ",\"s\":\"t\",\"args\":{\"arg\":");
+  p = put_uint(p, e->arg);
+  emit(c, p, "}}");
+}
+
+/* zero-length slice, the end of a flow arrow when id != 0 */
+static void mark(chrome_t *c, const char *name, unsigned slot, uint64_t ts, uint32_t id, const char *dir)
+{
+  char *p = head(c, 'X', name, "signal", PID_THREADS, tid_of(slot), ts);
+  p = put_str(p, ",\"dur\":0");
+  if (id) {
+    p = put_str(p, ",\"bind_id\":");
+    p = put_uint(p, id);
+    p = put_str(p, dir);
+  }
+  emit(c, p, "}");
+}
+
+static void names(chrome_t *c)
+{
+  unsigned t;
+  meta(c, "process_name", PID_CPU, 0, "CPU");
+  meta(c, "thread_name", PID_CPU, 0, "running");
+  meta(c, "process_name", PID_THREADS, 0, "threads");
+  for (t = 0; t < NSLOTS; ++t)
+    if (t == TRACE_MAX_THREADS || c->names.name[t][0]) meta(c, "thread_name", PID_THREADS, tid_of(t), slot_name(c, t));
+  c->named = 1;
+}
+
+/* ------------------- CPU lane ------------------- */
+static void run_end(chrome_t *c, uint64_t ts)
+{
+  char *p;
+
+  if (c->run == NSLOTS) return;
+  p = head(c, 'X', slot_name(c, c->run), "run", PID_CPU, 0, c->run_start);
+  p = put_str(p, ",\"dur\":");
+  p = put_us(c, p, ts - c->run_start);
+  p = put_str(p, ",\"args\":{\"last\":");
+  p = put_us(c, p, c->run_last);
+  emit(c, p, "}}");
+  c->run = NSLOTS;
+}
+
+static void run_track(chrome_t *c, const trace_ev_t *e, unsigned slot)
+{
+  if (slot >= TRACE_MAX_THREADS) return;  /* an ISR runs inside a thread's slice */
+  if (slot != c->run) {
+    run_end(c, e->ts);
+    c->run       = slot;
+    c->run_start = e->ts;
+  }
+  c->run_last = e->ts;
+  if (e->ev == TR_THREAD_EXIT && e->arg == slot) run_end(c, e->ts);
+}
+
+/* ------------------- Thread tracks ------------------- */
+/* opens or closes span kind/arg on slot; an end without a begin (the
+   capture started inside it) is dropped */
+static void pair(chrome_t *c, uint32_t *set, int begin, const char *kind, unsigned arg, unsigned slot, uint64_t ts)
+{
+  uint32_t bit = 1uL << (arg & 31u);
+  if (begin) {
+    if (*set & bit) span(c, 'E', kind, arg, slot, ts);   /* lost end */
+    *set |= bit;
+    span(c, 'B', kind, arg, slot, ts);
+  } else if (*set & bit) {
+    *set &= ~bit;
+    span(c, 'E', kind, arg, slot, ts);
+  }
+}
+
+static void signal_set(chrome_t *c, const trace_ev_t *e, unsigned slot)
+{
+  unsigned to = slot_of((uint8_t)(e->arg & 0xFFu)), bit = (e->arg >> 8) & (NSIGS - 1u);
+  char buf[12], name[40];
+
+  sprintf(name, "%.16s -> %.8s", sig_name(c, bit, buf), slot_name(c, to));
+  if (to < TRACE_MAX_THREADS) c->flow[to][bit] = ++c->next_flow;
+  mark(c, name, slot, e->ts, to < TRACE_MAX_THREADS ? c->flow[to][bit] : 0u, ",\"flow_out\":true");
+}
+
+static void signal_wake(chrome_t *c, const trace_ev_t *e, unsigned slot)
+{
+  unsigned bit;
+  char buf[12], name[32];
+
+  for (bit = 0; bit < NSIGS; ++bit) {
+    if (!(e->arg & (1u << bit))) continue;
+    sprintf(name, "wake %.24s", sig_name(c, bit, buf));
+    mark(c, name, slot, e->ts, c->flow[slot][bit], ",\"flow_in\":true");
+    c->flow[slot][bit] = 0;
+  }
+}
+
+static void on_event(const trace_ev_t *e, void *ctx)
+{
+  chrome_t *c = (chrome_t *)ctx;
+  unsigned slot = slot_of(e->thread);
+  open_t *o = &c->open[slot];
+
+  if (!c->named) names(c);
+  c->events++;
+  c->last_ts = e->ts;
+  run_track(c, e, slot);
+  switch (e->ev) {
+    case TR_MUTEX_WAIT:     pair(c, &o->wait, 1, "wait m", e->arg, slot, e->ts); break;
+    case TR_MUTEX_ACQUIRE:  pair(c, &o->wait, 0, "wait m", e->arg, slot, e->ts);
+                            pair(c, &o->hold, 1, "hold m", e->arg, slot, e->ts); break;
+    case TR_MUTEX_RELEASE:  pair(c, &o->hold, 0, "hold m", e->arg, slot, e->ts); break;
+    case TR_PT_START:       pair(c, &o->pt,   1, "pt",     e->arg, slot, e->ts); break;
+    case TR_PT_END:         pair(c, &o->pt,   0, "pt",     e->arg, slot, e->ts); break;
+    case TR_LCD_BEGIN:      pair(c, &o->lcd,  1, "lcd",    e->arg, slot, e->ts); break;
+    case TR_LCD_END:        pair(c, &o->lcd,  0, "lcd",    e->arg, slot, e->ts); break;
+    case TR_JOB_START:      o->jobs++; span(c, 'B', "job", e->arg, slot, e->ts); break;
+    case TR_JOB_END:        if (o->jobs) { o->jobs--; span(c, 'E', "job", e->arg, slot, e->ts); } break;
+    case TR_SIGNAL_SET:     signal_set(c, e, slot); break;
+    case TR_SIGNAL_WAKE:    signal_wake(c, e, slot); break;
+    default:                instant(c, e, slot); break;
+  }
+}
+
+/* closes whatever the capture ended inside of */
+static void finish(chrome_t *c)
+{
+  unsigned t, b;
+
+  if (!c->named) names(c);
+  run_end(c, c->last_ts);
+  for (t = 0; t < NSLOTS; ++t) {
+    open_t *o = &c->open[t];
+    for (b = 0; b < 32u; ++b) {
+      if (o->lcd  & (1uL << b)) span(c, 'E', "lcd",    b, t, c->last_ts);
+      if (o->hold & (1uL << b)) span(c, 'E', "hold m", b, t, c->last_ts);
+      if (o->wait & (1uL << b)) span(c, 'E', "wait m", b, t, c->last_ts);
+      if (o->pt   & (1uL << b)) span(c, 'E', "pt",     b, t, c->last_ts);
+    }
+    for (; o->jobs; o->jobs--) span(c, 'E', "job", 0, t, c->last_ts);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  static chrome_t c;
+  static tf_reader_t r;
+  const char *path = NULL, *out = NULL;
+  double hz = 0.0;
+  long long n;
+  int i;
+
+  for (i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-c") && i + 1 < argc)      hz  = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc) out = argv[++i];
+    else if (!strcmp(argv[i], "-S") && i + 1 < argc) {
+      char *eq;
+      unsigned long bit = strtoul(argv[++i], &eq, 0);
+      if (*eq != '=' || bit >= NSIGS) { path = NULL; break; }
+      c.sig[bit] = eq + 1;
+    }
+    else if (argv[i][0] != '-' && !path)             path = argv[i];
+    else { path = NULL; break; }
+  }
+  if (!path) {
+    fprintf(stderr, "usage: %s [-c core_hz] [-S bit=name]... [-o out.json] trace.{trf,hex,bin}\n", argv[0]);
+    return 2;
+  }
+
+  c.f = out ? fopen(out, "w") : stdout;
+  if (!c.f) { perror(out); return 1; }
+  setvbuf(c.f, NULL, _IOFBF, 1u << 20);
+  c.first = 1;
+  c.run   = NSLOTS;
+  fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", c.f);
+
+  if (tf_open(&r, path) == 0) {
+    c.names = r.names;
+    c.hz    = hz > 0.0 ? (uint64_t)hz : (r.hdr->hz ? r.hdr->hz : 100000000u);
+    n = tf_scan(&r, 0, UINT64_MAX, TF_ALL_THREADS, on_event, &c);
+    tf_close(&r);
+  } else {
+    size_t len = 0;
+    uint8_t *img = load_dump(path, &len);
+    c.hz = hz > 0.0 ? (uint64_t)hz : 100000000u;
+    n = img ? trace_ring_read(img, len, &c.names, on_event, &c) : -1;
+    free(img);
+  }
+  if (n < 0) { fprintf(stderr, "%s: not a trace file or g_trace dump\n", path); return 1; }
+
+  finish(&c);
+  fputs("\n]}\n", c.f);
+  if ((out ? fclose(c.f) : fflush(c.f)) != 0) { perror(out ? out : "stdout"); return 1; }
+  fprintf(stderr, "# %llu events\n", (unsigned long long)c.events);
+  return 0;
+}
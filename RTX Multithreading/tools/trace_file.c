@@ -0,0 +1,244 @@
+/* COE718 Lab 3a - indexed binary trace file, see trace_file.h */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "trace_file.h"
+
+/* ------------------- Varints ------------------- */
+static uint8_t *put_varint(uint8_t *p, uint64_t v)
+{
+  while (v >= 0x80u) { *p++ = (uint8_t)(v | 0x80u); v >>= 7; }
+  *p++ = (uint8_t)v;
+  return p;
+}
+
+/* NULL when the varint runs past end or over 64 bits */
+static const uint8_t *get_varint(const uint8_t *p, const uint8_t *end, uint64_t *v)
+{
+  uint64_t x = 0;
+  unsigned shift = 0;
+
+  while (p < end && shift < 64u) {
+    uint8_t b = *p++;
+    x |= (uint64_t)(b & 0x7Fu) << shift;
+    if (!(b & 0x80u)) { *v = x; return p; }
+    shift += 7u;
+  }
+  return NULL;
+}
+
+/* ------------------- Writer ------------------- */
+static int flush_block(tf_writer_t *w)
+{
+  tf_index_t *c = &w->cur;
+
+  if (c->count == 0u) return 0;
+  if (w->hdr.blocks == w->index_cap) {
+    uint64_t cap = w->index_cap ? 2u * w->index_cap : 1024u;
+    tf_index_t *ix = realloc(w->index, (size_t)cap * sizeof *ix);
+    if (!ix) return w->error = -1;
+    w->index     = ix;
+    w->index_cap = cap;
+  }
+  if (fwrite(w->buf, 1, c->bytes, w->f) != c->bytes) return w->error = -1;
+  w->index[w->hdr.blocks++] = *c;
+  c->offset += c->bytes;
+  c->first  += c->count;
+  c->count   = 0u;
+  c->bytes   = 0u;
+  c->threads = 0u;
+  c->evs     = 0u;
+  return 0;
+}
+
+int tf_create(tf_writer_t *w, const char *path, uint32_t hz, uint32_t block_events)
+{
+  memset(w, 0, sizeof *w);
+  w->hdr.magic        = TF_MAGIC;
+  w->hdr.version      = TF_VERSION;
+  w->hdr.hz           = hz;
+  w->hdr.block_events = block_events ? block_events : TF_BLOCK_EVENTS;
+  w->buf = malloc((size_t)w->hdr.block_events * TF_EV_MAX_BYTES);
+  w->f   = w->buf ? fopen(path, "wb") : NULL;
+  if (!w->f) { free(w->buf); w->buf = NULL; return -1; }
+  setvbuf(w->f, NULL, _IOFBF, 1u << 20);
+  /* placeholder, tf_finish() writes the real one */
+  if (fwrite(&w->hdr, sizeof w->hdr, 1, w->f) != 1u) w->error = -1;
+  w->cur.offset = sizeof w->hdr;
+  return w->error;
+}
+
+int tf_write(tf_writer_t *w, const trace_ev_t *e)
+{
+  tf_index_t *c = &w->cur;
+  uint8_t *p;
+
+  if (w->error) return -1;
+  if (w->hdr.events && e->ts < w->prev_ts) return -1;
+  if (c->count == 0u) {
+    c->t_first = e->ts;
+    w->prev_ts = e->ts;
+  }
+  p = put_varint(w->buf + c->bytes, e->ts - w->prev_ts);
+  *p++ = e->ev;
+  *p++ = e->thread;
+  p = put_varint(p, e->arg);
+  c->bytes    = (uint32_t)(p - w->buf);
+  c->t_last   = e->ts;
+  c->threads |= tf_thread_bit(e->thread);
+  c->evs     |= 1u << (e->ev < 31u ? e->ev : 31u);
+  w->prev_ts  = e->ts;
+  if (w->hdr.events++ == 0u) w->hdr.t_first = e->ts;
+  w->hdr.t_last = e->ts;
+  if (++c->count == w->hdr.block_events) return flush_block(w);
+  return 0;
+}
+
+void tf_set_names(tf_writer_t *w, const trace_names_t *n)
+{
+  unsigned t;
+  for (t = 0; t < TRACE_MAX_THREADS; ++t) memcpy(w->hdr.name[t], n->name[t], TRACE_NAME_LEN);
+}
+
+int tf_finish(tf_writer_t *w)
+{
+  static const uint8_t pad[8];
+  int rc;
+
+  if (!w->f) return -1;
+  if (flush_block(w) == 0) {
+    uint64_t off = w->cur.offset, aligned = (off + 7u) & ~(uint64_t)7u;
+    w->hdr.index_off = aligned;
+    if (fwrite(pad, 1, (size_t)(aligned - off), w->f) != aligned - off ||
+        fwrite(w->index, sizeof *w->index, (size_t)w->hdr.blocks, w->f) != w->hdr.blocks ||
+        fseek(w->f, 0, SEEK_SET) != 0 ||
+        fwrite(&w->hdr, sizeof w->hdr, 1, w->f) != 1u)
+      w->error = -1;
+  }
+  rc = (fclose(w->f) != 0) ? -1 : w->error;
+  free(w->buf);
+  free(w->index);
+  w->f     = NULL;
+  w->buf   = NULL;
+  w->index = NULL;
+  return rc;
+}
+
+/* ------------------- Reader ------------------- */
+int tf_open(tf_reader_t *r, const char *path)
+{
+  struct stat st;
+  const tf_header_t *h;
+  int fd = open(path, O_RDONLY);
+  unsigned t;
+  void *m;
+
+  memset(r, 0, sizeof *r);
+  if (fd < 0) return -1;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof *h) { close(fd); return -1; }
+  m = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (m == MAP_FAILED) return -1;
+  r->map = (const uint8_t *)m;
+  r->len = (size_t)st.st_size;
+  h = (const tf_header_t *)m;
+  if (h->magic != TF_MAGIC || h->version != TF_VERSION || h->block_events == 0u ||
+      (h->index_off & 7u) || h->index_off > r->len ||
+      h->blocks > (r->len - h->index_off) / sizeof(tf_index_t)) {
+    tf_close(r);
+    return -1;
+  }
+  r->hdr   = h;
+  r->index = (const tf_index_t *)(r->map + h->index_off);
+  for (t = 0; t < TRACE_MAX_THREADS; ++t) memcpy(r->names.name[t], h->name[t], TRACE_NAME_LEN);
+  return 0;
+}
+
+void tf_close(tf_reader_t *r)
+{
+  if (r->map) munmap((void *)r->map, r->len);
+  memset(r, 0, sizeof *r);
+}
+
+uint64_t tf_find(const tf_reader_t *r, uint64_t t)
+{
+  uint64_t lo = 0, hi = r->hdr->blocks;
+
+  while (lo < hi) {                     /* first block with t_last >= t */
+    uint64_t mid = lo + (hi - lo) / 2u;
+    if (r->index[mid].t_last < t) lo = mid + 1u;
+    else                          hi = mid;
+  }
+  return lo;
+}
+
+/* Walks block b, passing the events in [t0, t1) on the threads in mask to
+   fn; stops at the first event at or after t1.  Count or -1. */
+static long walk(const tf_reader_t *r, uint64_t b, uint64_t t0, uint64_t t1, uint32_t mask,
+                 trace_ev_fn fn, void *ctx)
+{
+  const tf_index_t *x = &r->index[b];
+  const uint8_t *p, *end;
+  trace_ev_t e;
+  uint64_t v;
+  uint32_t k;
+  long n = 0;
+
+  if (x->offset > r->hdr->index_off || x->bytes > r->hdr->index_off - x->offset ||
+      x->count > r->hdr->block_events) return -1;
+  p   = r->map + x->offset;
+  end = p + x->bytes;
+  e.ts = x->t_first;
+  for (k = 0; k < x->count; ++k) {
+    if (!(p = get_varint(p, end, &v)) || end - p < 2) return -1;
+    e.ts    += v;
+    e.ev     = p[0];
+    e.thread = p[1];
+    if (!(p = get_varint(p + 2, end, &v))) return -1;
+    e.arg = (uint16_t)v;
+    if (e.ts >= t1) break;
+    if (e.ts >= t0 && (tf_thread_bit(e.thread) & mask)) {
+      fn(&e, ctx);
+      n++;
+    }
+  }
+  return n;
+}
+
+typedef struct { trace_ev_t *out; long n; } collect_t;
+
+static void collect(const trace_ev_t *e, void *ctx)
+{
+  collect_t *c = (collect_t *)ctx;
+  c->out[c->n++] = *e;
+}
+
+long tf_block(const tf_reader_t *r, uint64_t b, trace_ev_t *out)
+{
+  collect_t c;
+
+  if (b >= r->hdr->blocks) return -1;
+  c.out = out;
+  c.n   = 0;
+  return walk(r, b, 0, UINT64_MAX, TF_ALL_THREADS, collect, &c) < 0 ? -1 : c.n;
+}
+
+long long tf_scan(const tf_reader_t *r, uint64_t t0, uint64_t t1, uint32_t threads,
+                  trace_ev_fn fn, void *ctx)
+{
+  uint64_t b;
+  long long total = 0;
+
+  for (b = tf_find(r, t0); b < r->hdr->blocks && r->index[b].t_first < t1; ++b) {
+    long n;
+    if (!(r->index[b].threads & threads)) continue;
+    if ((n = walk(r, b, t0, t1, threads, fn, ctx)) < 0) return -1;
+    total += n;
+  }
+  return total;
+}
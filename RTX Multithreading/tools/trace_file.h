@@ -0,0 +1,112 @@
+/* COE718 Lab 3a - indexed binary trace file (.trf) for the host tools
+ *
+ * A soak run of the round-robin demos yields far more events than a text
+ * timeline can hold.  A .trf file keeps them in trace_model.h's event
+ * model, packed into blocks and indexed so that a reader maps the file
+ * and jumps to a time window with a binary search over the index instead
+ * of decoding everything before it.
+ *
+ *   header    tf_header_t, rewritten when the writer closes
+ *   block 0   events of block 0, packed as below
+ *   ...
+ *   index     tf_index_t[blocks] at header.index_off, 8-byte aligned
+ *
+ * Block events are packed back to back, each one as
+ *
+ *   varint  ts - previous ts (the first one against the block's t_first)
+ *   byte    ev
+ *   byte    thread
+ *   varint  arg
+ *
+ * with the varints little-endian base 128 (7 bits per byte, bit 7 set on
+ * every byte but the last).  Timestamps must not decrease; a typical
+ * scheduler trace packs to 5-6 bytes per event against 16 in memory.
+ * Each index entry carries the block's time range and the mask of the
+ * threads (bit = slot, bit 31 = TRACE_NO_THREAD or any slot above 30) and
+ * events in it, so a thread filter skips whole blocks unread.
+ *
+ * The file is written in host byte order; the reader rejects a file whose
+ * magic does not match.  Build the tools with trace_file.c and -Ihost.
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "trace_model.h"
+
+#define TF_MAGIC        0x31465254u     /* "TRF1" */
+#define TF_VERSION      1u
+#define TF_BLOCK_EVENTS 4096u           /* default events per block */
+#define TF_EV_MAX_BYTES 15u             /* 10-byte delta, ev, thread, 3-byte arg */
+#define TF_ALL_THREADS  0xFFFFFFFFu
+
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t hz;                          /* core clock of the timestamps */
+  uint32_t block_events;
+  uint64_t events;
+  uint64_t blocks;
+  uint64_t index_off;
+  uint64_t t_first, t_last;
+  char     name[TRACE_MAX_THREADS][TRACE_NAME_LEN];
+} tf_header_t;
+
+typedef struct {
+  uint64_t offset;                      /* of the block in the file */
+  uint64_t first;                       /* events in the blocks before */
+  uint64_t t_first, t_last;
+  uint32_t count;                       /* events in the block */
+  uint32_t bytes;                       /* packed size */
+  uint32_t threads;                     /* tf_thread_bit() mask */
+  uint32_t evs;                         /* 1 << ev mask, bit 31 = ev >= 31 */
+} tf_index_t;
+
+static inline uint32_t tf_thread_bit(uint8_t thread)
+{
+  return 1u << (thread < 31u ? thread : 31u);
+}
+
+/* ------------------- Writer ------------------- */
+typedef struct {
+  FILE       *f;
+  tf_header_t hdr;
+  tf_index_t  cur;                      /* block being packed */
+  uint8_t    *buf;
+  uint64_t    prev_ts;
+  tf_index_t *index;
+  uint64_t    index_cap;
+  int         error;
+} tf_writer_t;
+
+/* Creates path; block_events 0 = TF_BLOCK_EVENTS.  0 or -1. */
+int  tf_create(tf_writer_t *w, const char *path, uint32_t hz, uint32_t block_events);
+/* Appends one event; -1 on a write error or a timestamp going backwards. */
+int  tf_write(tf_writer_t *w, const trace_ev_t *e);
+/* Thread names may arrive during the capture; the last ones set are kept. */
+void tf_set_names(tf_writer_t *w, const trace_names_t *n);
+/* Flushes the last block, the index and the header.  0 or -1. */
+int  tf_finish(tf_writer_t *w);
+
+/* ------------------- Reader ------------------- */
+typedef struct {
+  const uint8_t     *map;
+  size_t             len;
+  const tf_header_t *hdr;
+  const tf_index_t  *index;
+  trace_names_t      names;
+} tf_reader_t;
+
+/* Maps path read-only and checks the header and index.  0 or -1. */
+int      tf_open(tf_reader_t *r, const char *path);
+void     tf_close(tf_reader_t *r);
+/* First block that may hold an event at or after t, O(log blocks);
+   hdr->blocks when none does. */
+uint64_t tf_find(const tf_reader_t *r, uint64_t t);
+/* Unpacks block b into out[hdr->block_events].  Event count or -1. */
+long     tf_block(const tf_reader_t *r, uint64_t b, trace_ev_t *out);
+/* Events with t0 <= ts < t1 on the threads in mask, oldest first, into
+   fn.  Only the blocks overlapping the window are unpacked.  Event count
+   or -1 on a corrupt block. */
+long long tf_scan(const tf_reader_t *r, uint64_t t0, uint64_t t1, uint32_t threads,
+                  trace_ev_fn fn, void *ctx);
@@ -0,0 +1,72 @@
+/* COE718 Lab 3a - host event model for trace.h records
+ *
+ * Every trace source the host tools read (a g_trace RAM dump, a SWO
+ * capture, the telemetry stream) ends up as a sequence of trace_ev_t:
+ * the RAM ring's record with the timestamp widened to 64 bits and the
+ * thread names alongside.  trace_ring_read() unwraps a g_trace dump into
+ * that model; trace_ev_print() is the one text format.
+ */
+#pragma once
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "trace_names.h"
+
+typedef struct {
+  uint64_t ts;                          /* core cycles, monotonic */
+  uint8_t  ev;
+  uint8_t  thread;                      /* name slot or TRACE_NO_THREAD */
+  uint16_t arg;
+} trace_ev_t;
+
+typedef struct {
+  char name[TRACE_MAX_THREADS][TRACE_NAME_LEN + 1];
+} trace_names_t;
+
+typedef void (*trace_ev_fn)(const trace_ev_t *e, void *ctx);
+
+static inline const char *trace_thread_name(const trace_names_t *n, uint8_t t)
+{
+  if (t == TRACE_NO_THREAD) return "-";
+  return (t < TRACE_MAX_THREADS && n->name[t][0]) ? n->name[t] : "?";
+}
+
+static inline void trace_ev_print(FILE *f, const trace_ev_t *e, const trace_names_t *n, double hz)
+{
+  fprintf(f, "%14.1f us  %-8s %-16s %u\n", (double)e->ts / hz * 1e6,
+          trace_thread_name(n, e->thread), trace_ev_name(e->ev), e->arg);
+}
+
+/* g_trace image (trace_ring_t, little-endian): names into *n, the kept
+   records oldest first into fn.  Returns the record count or -1. */
+static inline long trace_ring_read(const uint8_t *img, size_t len, trace_names_t *n,
+                                   trace_ev_fn fn, void *ctx)
+{
+  const size_t hdr = 16u + TRACE_MAX_THREADS * TRACE_NAME_LEN;
+  uint32_t slots, rsz, head, first, k, prev = 0;
+  uint64_t hi = 0;
+  unsigned t;
+
+  if (len < hdr || (img[0] | img[1] << 8 | img[2] << 16 | (uint32_t)img[3] << 24) != TRACE_MAGIC) return -1;
+  slots = img[4] | img[5] << 8 | img[6] << 16 | (uint32_t)img[7] << 24;
+  rsz   = img[8] | img[9] << 8 | img[10] << 16 | (uint32_t)img[11] << 24;
+  head  = img[12] | img[13] << 8 | img[14] << 16 | (uint32_t)img[15] << 24;
+  if (rsz < 8u || hdr + (size_t)slots * rsz > len) return -1;
+  memset(n, 0, sizeof *n);
+  for (t = 0; t < TRACE_MAX_THREADS; ++t) memcpy(n->name[t], img + 16 + t * TRACE_NAME_LEN, TRACE_NAME_LEN);
+
+  first = (head > slots) ? head - slots : 0u;
+  for (k = first; k != head; ++k) {
+    const uint8_t *p = img + hdr + (size_t)(k % slots) * rsz;
+    uint32_t ts = p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+    trace_ev_t e;
+    if (k != first && ts < prev) hi += 1ull << 32;   /* CYCCNT wrapped */
+    prev   = ts;
+    e.ts     = hi | ts;
+    e.ev     = p[4];
+    e.thread = p[5];
+    e.arg    = (uint16_t)(p[6] | p[7] << 8);
+    fn(&e, ctx);
+  }
+  return (long)(head - first);
+}
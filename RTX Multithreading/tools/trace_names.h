@@ -0,0 +1,25 @@
+/* COE718 Lab 3a - trace event names for the host tools
+ *
+ * One string per TR_* code in trace.h, same order; the array size check
+ * fails the build when an event is appended there but not here.  Needs
+ * -Ihost for the cmsis_os.h that trace.h includes.
+ */
+#pragma once
+#include "trace.h"
+
+static const char *const trace_ev_names[] = {
+  "NONE", "USER", "THREAD_CREATE", "THREAD_EXIT",
+  "JOB_SUBMIT", "JOB_START", "JOB_END",
+  "MUTEX_WAIT", "MUTEX_ACQUIRE", "MUTEX_RELEASE", "PRIO_BOOST",
+  "PT_RELEASE", "PT_START", "PT_END",
+  "CE_FRAME", "CE_OVERRUN",
+  "BUDGET_OVERRUN", "BUDGET_THROTTLE", "BUDGET_RESTORE",
+  "RR_ROTATE",
+  "SIGNAL_SET", "SIGNAL_WAKE", "LCD_BEGIN", "LCD_END",
+};
+typedef char trace_names_complete[sizeof trace_ev_names / sizeof trace_ev_names[0] == TR_EV_COUNT ? 1 : -1];
+
+static inline const char *trace_ev_name(unsigned ev)
+{
+  return ev < TR_EV_COUNT ? trace_ev_names[ev] : "?";
+}
@@ -0,0 +1,189 @@
+/* COE718 Lab 3a - RAM trace recorder, see trace.h */
+
+#include "trace.h"
+#include "LPC17xx.h"            /* __LDREXW/__STREXW */
+#include "hrclock.h"
+#include "qstat.h"
+
+trace_ring_t g_trace;
+
+static osThreadId trace_ids[TRACE_MAX_THREADS];
+static uint32_t   trace_nthreads;
+
+/* per slot: lap of the last record completely written there, so a reader
+   can tell a claimed slot from a filled one (0: none since trace_clear).
+   Full width: head / TRACE_SLOTS + 1 never reaches 0 nor repeats a lap
+   before head itself wraps, which a uint8_t did after 256 laps. */
+static volatile uint32_t trace_lap[TRACE_SLOTS];
+#define TRACE_LAP(n)  ((n) / TRACE_SLOTS + 1u)
+
+#if QSTAT
+static uint32_t          trace_sig_at[TRACE_MAX_THREADS];   /* last set, per receiver */
+static volatile uint32_t trace_sig_pending;
+#endif
+
+#if TRACE_ITM
+volatile uint32_t g_trace_itm_drops;
+
+static void trace_itm_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  ITM->LAR = 0xC5ACCE55u;               /* unlock the ITM registers */
+  ITM->TCR = ITM_TCR_ITMENA_Msk | ITM_TCR_TSENA_Msk | ITM_TCR_SYNCENA_Msk |
+             (1u << ITM_TCR_TraceBusID_Pos);   /* timestamps in core cycles */
+  ITM->TER |= 7u << TRACE_ITM_PORT;
+}
+
+/* never waits: a full FIFO drops the word */
+static __inline void trace_itm_put(uint32_t port, uint32_t w)
+{
+  if (!(ITM->TCR & ITM_TCR_ITMENA_Msk)) return;
+  if (ITM->PORT[port].u32) ITM->PORT[port].u32 = w;
+  else                     g_trace_itm_drops++;
+}
+#endif
+
+void trace_init(void)
+{
+  g_trace.magic    = TRACE_MAGIC;
+  g_trace.slots    = TRACE_SLOTS;
+  g_trace.rec_size = sizeof(trace_rec_t);
+  trace_nthreads   = 0u;
+  trace_clear();
+#if TRACE_ITM
+  trace_itm_init();
+#endif
+}
+
+/* drop recorded events, keep thread names */
+void trace_clear(void)
+{
+  uint32_t i;
+
+  g_trace.head = 0u;
+  for (i = 0; i < TRACE_SLOTS; ++i) trace_lap[i] = 0u;
+}
+
+int trace_filled(uint32_t n)
+{
+  return trace_lap[n & (TRACE_SLOTS - 1u)] == TRACE_LAP(n);
+}
+
+uint8_t trace_register(osThreadId id, const char *name)
+{
+  uint32_t i, slot;
+
+  for (i = 0; i < trace_nthreads; ++i) {
+    if (trace_ids[i] == id) return (uint8_t)i;
+  }
+  if (trace_nthreads >= TRACE_MAX_THREADS) return TRACE_NO_THREAD;
+  slot = trace_nthreads;
+  for (i = 0; i < TRACE_NAME_LEN - 1u && name && name[i]; ++i) g_trace.name[slot][i] = name[i];
+  g_trace.name[slot][i] = '\0';
+  trace_ids[slot] = id;
+  trace_nthreads  = slot + 1u;  /* publish after the name is in place */
+#if TRACE_ITM
+  {
+    const uint8_t *n = (const uint8_t *)g_trace.name[slot];   /* slot + 7 chars */
+    trace_itm_put(TRACE_ITM_PORT + 1u, slot | n[0] << 8 | n[1] << 16 | (uint32_t)n[2] << 24);
+    trace_itm_put(TRACE_ITM_PORT + 2u, n[3] | n[4] << 8 | n[5] << 16 | (uint32_t)n[6] << 24);
+  }
+#endif
+  return (uint8_t)slot;
+}
+
+uint8_t trace_slot(osThreadId id)
+{
+  uint32_t i, n = trace_nthreads;
+  for (i = 0; i < n; ++i) {
+    if (trace_ids[i] == id) return (uint8_t)i;
+  }
+  return TRACE_NO_THREAD;
+}
+
+uint8_t trace_self(void)
+{
+  return trace_slot(osThreadGetId());
+}
+
+void trace_event(uint8_t ev, uint8_t thread, uint16_t arg)
+{
+  uint32_t h;
+  trace_rec_t *r;
+
+  do {
+    h = __LDREXW(&g_trace.head);
+  } while (__STREXW(h + 1u, &g_trace.head));
+
+  r = &g_trace.rec[h & (TRACE_SLOTS - 1u)];
+  r->ts     = hrclock_cyc32();
+  r->ev     = ev;
+  r->thread = thread;
+  r->arg    = arg;
+  __DMB();                              /* record before its lap */
+  trace_lap[h & (TRACE_SLOTS - 1u)] = TRACE_LAP(h);
+#if TRACE_ITM
+  trace_itm_put(TRACE_ITM_PORT, ev | (uint32_t)thread << 8 | (uint32_t)arg << 16);
+#endif
+}
+
+/* recorded before the set: a higher-priority waiter runs inside osSignalSet */
+int32_t trace_signal_set(osThreadId id, int32_t signals)
+{
+  uint8_t  self = trace_self(), to = trace_slot(id);
+  uint32_t b;
+
+  for (b = 0; b < 16u; ++b) {
+    if ((uint32_t)signals & (1uL << b)) trace_event(TR_SIGNAL_SET, self, (uint16_t)(to | b << 8));
+  }
+#if QSTAT
+  if (to < TRACE_MAX_THREADS) {
+    trace_sig_at[to] = hrclock_cyc32();
+    trace_sig_pending |= 1uL << to;
+  }
+#endif
+  return osSignalSet(id, signals);
+}
+
+osEvent trace_signal_wait(int32_t signals, uint32_t millisec)
+{
+  osEvent e = osSignalWait(signals, millisec);
+  uint8_t self;
+
+  if (e.status != osEventSignal) return e;
+  self = trace_self();
+  trace_event(TR_SIGNAL_WAKE, self, (uint16_t)e.value.signals);
+#if QSTAT
+  if (self < TRACE_MAX_THREADS && (trace_sig_pending & (1uL << self))) {
+    trace_sig_pending &= ~(1uL << self);
+    QS_ADD(QS_SIG_WAKE, hrclock_cyc32() - trace_sig_at[self]);
+  }
+#endif
+  return e;
+}
+
+uint32_t trace_pair_stats(uint8_t ev_a, uint8_t ev_b, uint32_t *mean, uint32_t *max)
+{
+  uint32_t open_ts[TRACE_PAIR_IDS];
+  uint32_t head = g_trace.head, k, pairs = 0u, worst = 0u;
+  uint64_t sum = 0u, open_ok = 0u;
+
+  k = (head > TRACE_SLOTS) ? head - TRACE_SLOTS : 0u;
+  for (; k < head; ++k) {
+    const trace_rec_t *r = &g_trace.rec[k & (TRACE_SLOTS - 1u)];
+    uint32_t a = r->arg & (TRACE_PAIR_IDS - 1u);
+    if (r->ev == ev_a) {
+      open_ts[a] = r->ts;
+      open_ok |= 1uLL << a;
+    } else if (r->ev == ev_b && (open_ok & (1uLL << a))) {
+      uint32_t dt = r->ts - open_ts[a];
+      open_ok &= ~(1uLL << a);
+      sum += dt;
+      if (dt > worst) worst = dt;
+      pairs++;
+    }
+  }
+  if (mean) *mean = pairs ? (uint32_t)(sum / pairs) : 0u;
+  if (max)  *max  = worst;
+  return pairs;
+}
@@ -0,0 +1,119 @@
+/* COE718 Lab 3a - RAM trace recorder
+ *
+ * Fixed-size ring of 8-byte events (timestamp, event, thread, argument)
+ * that any thread can append to without locking.  Threads are named once
+ * with trace_register(); the names live inside g_trace so a debugger dump
+ * of g_trace is self-describing for the host tools.
+ *
+ * Build with TRACE_ENABLE=0 to compile every TRACE() call site out.
+ *
+ * With TRACE_ITM=1 every event is also written to ITM stimulus port
+ * TRACE_ITM_PORT as one word, ev | thread << 8 | arg << 16, and the ITM
+ * adds local timestamp packets in core cycles; registered names go out on
+ * the next two ports.  trace_init() enables the ITM and its timestamps,
+ * the debugger sets up SWO (uVision Trace: core clock 100 MHz).  A word
+ * that finds the ITM FIFO full is dropped and counted in
+ * g_trace_itm_drops, so a slow SWO link never stalls the caller.
+ * tools/swo_decode turns a raw SWO capture back into these events.
+ */
+#pragma once
+#include "cmsis_os.h"
+#include <stdint.h>
+
+#ifndef TRACE_ENABLE
+# define TRACE_ENABLE      1
+#endif
+
+#define TRACE_SLOTS        256u         /* power of two */
+#define TRACE_MAX_THREADS  16u
+#define TRACE_NAME_LEN     8u
+#define TRACE_MAGIC        0x31435254u  /* "TRC1" */
+#define TRACE_NO_THREAD    0xFFu        /* ISR or unregistered thread */
+
+#ifndef TRACE_ITM
+# define TRACE_ITM         0
+#endif
+#define TRACE_ITM_PORT     1u           /* events; +1, +2: thread names */
+
+/* Event codes; append only so old dumps keep decoding. */
+enum {
+  TR_NONE = 0,
+  TR_USER,            /* arg: caller defined */
+  TR_THREAD_CREATE,   /* arg: thread slot created */
+  TR_THREAD_EXIT,     /* arg: thread slot */
+  TR_JOB_SUBMIT,      /* arg: job id */
+  TR_JOB_START,       /* arg: job id */
+  TR_JOB_END,         /* arg: job id */
+  TR_MUTEX_WAIT,      /* arg: mutex_probe index, contended wait begins */
+  TR_MUTEX_ACQUIRE,   /* arg: mutex_probe index */
+  TR_MUTEX_RELEASE,   /* arg: mutex_probe index */
+  TR_PRIO_BOOST,      /* arg: mutex_probe index, holder was boosted */
+  TR_PT_RELEASE,      /* arg: periodic task index */
+  TR_PT_START,        /* arg: periodic task index */
+  TR_PT_END,          /* arg: periodic task index */
+  TR_CE_FRAME,        /* arg: cyclic executive minor frame */
+  TR_CE_OVERRUN,      /* arg: minor frame still running at the boundary */
+  TR_BUDGET_OVERRUN,  /* arg: budget.h thread index, from the ISR */
+  TR_BUDGET_THROTTLE, /* arg: budget.h thread index */
+  TR_BUDGET_RESTORE,  /* arg: budget.h thread index */
+  TR_RR_ROTATE,       /* arg: rr_slice.h thread index, quantum used up */
+  TR_SIGNAL_SET,      /* arg: target slot | signal bit << 8, one per bit */
+  TR_SIGNAL_WAKE,     /* arg: signal flags that ended the wait */
+  TR_LCD_BEGIN,       /* arg: LCD line */
+  TR_LCD_END,         /* arg: LCD line */
+  TR_EV_COUNT
+};
+
+typedef struct {
+  uint32_t ts;                          /* hrclock_cyc32(), core cycles */
+  uint8_t  ev;
+  uint8_t  thread;                      /* registered slot or TRACE_NO_THREAD */
+  uint16_t arg;
+} trace_rec_t;
+
+typedef struct {
+  uint32_t          magic;
+  uint32_t          slots;
+  uint32_t          rec_size;
+  volatile uint32_t head;               /* total events ever recorded */
+  char              name[TRACE_MAX_THREADS][TRACE_NAME_LEN];
+  trace_rec_t       rec[TRACE_SLOTS];   /* oldest overwritten first */
+} trace_ring_t;
+
+extern trace_ring_t g_trace;
+#if TRACE_ITM
+extern volatile uint32_t g_trace_itm_drops;
+#endif
+
+void    trace_init(void);
+void    trace_clear(void);
+uint8_t trace_register(osThreadId id, const char *name);
+uint8_t trace_self(void);
+uint8_t trace_slot(osThreadId id);
+void    trace_event(uint8_t ev, uint8_t thread, uint16_t arg);
+
+/* trace_event() claims a slot by advancing head and fills it afterwards,
+   so a reader that can preempt writers (tm_collect) stops at the first
+   event n, counted like head, for which this is still 0. */
+int     trace_filled(uint32_t n);
+
+/* osSignalSet/osSignalWait that also record the hand-off, so a host tool
+   can draw it from sender to receiver; use through the macros below. */
+int32_t trace_signal_set(osThreadId id, int32_t signals);
+osEvent trace_signal_wait(int32_t signals, uint32_t millisec);
+
+/* Pairs every ev_b with the latest earlier ev_a carrying the same arg and
+   returns how many pairs were found; mean/max are in cycles. Args are
+   matched modulo TRACE_PAIR_IDS, so callers keep their ids below it. */
+#define TRACE_PAIR_IDS     64u          /* power of two, at most 64 */
+uint32_t trace_pair_stats(uint8_t ev_a, uint8_t ev_b, uint32_t *mean, uint32_t *max);
+
+#if TRACE_ENABLE
+# define TRACE(ev, arg)              trace_event((ev), trace_self(), (uint16_t)(arg))
+# define TRACE_SIGNAL_SET(id, sig)   trace_signal_set((id), (sig))
+# define TRACE_SIGNAL_WAIT(sig, ms)  trace_signal_wait((sig), (ms))
+#else
+# define TRACE(ev, arg)              ((void)0)
+# define TRACE_SIGNAL_SET(id, sig)   osSignalSet((id), (sig))
+# define TRACE_SIGNAL_WAIT(sig, ms)  osSignalWait((sig), (ms))
+#endif
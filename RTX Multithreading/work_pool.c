@@ -0,0 +1,140 @@
+/* COE718 Lab 3a - persistent worker-thread pool, see work_pool.h */
+
+#include "work_pool.h"
+#include "trace.h"
+
+volatile uint32_t wp_jobs_run   = 0;
+volatile uint32_t wp_queue_peak = 0;
+
+/* ------------------- Priority queue (binary max-heap) ------------------- */
+static osThreadId wp_tid[WP_WORKERS];
+static wp_job_t *wp_heap[WP_QUEUE];
+static uint32_t  wp_count;
+static uint32_t  wp_seq;
+
+osMutexDef(wp_lock);
+static osMutexId wp_lock;
+osSemaphoreDef(wp_items);
+static osSemaphoreId wp_items;
+
+static int wp_before(const wp_job_t *a, const wp_job_t *b)
+{
+  if (a->prio != b->prio) return a->prio > b->prio;
+  return (int32_t)(a->seq - b->seq) < 0;
+}
+
+static void heap_push(wp_job_t *j)
+{
+  uint32_t i = wp_count++;
+  while (i > 0u) {
+    uint32_t p = (i - 1u) / 2u;
+    if (!wp_before(j, wp_heap[p])) break;
+    wp_heap[i] = wp_heap[p];
+    i = p;
+  }
+  wp_heap[i] = j;
+}
+
+static wp_job_t *heap_pop(void)
+{
+  wp_job_t *top = wp_heap[0], *last;
+  uint32_t i = 0u;
+
+  last = wp_heap[--wp_count];
+  for (;;) {
+    uint32_t c = 2u * i + 1u;
+    if (c >= wp_count) break;
+    if (c + 1u < wp_count && wp_before(wp_heap[c + 1u], wp_heap[c])) c++;
+    if (!wp_before(wp_heap[c], last)) break;
+    wp_heap[i] = wp_heap[c];
+    i = c;
+  }
+  if (wp_count) wp_heap[i] = last;
+  return top;
+}
+
+/* ------------------- Workers ------------------- */
+void wp_worker(void const *arg);
+osThreadDef(wp_worker, osPriorityNormal, WP_WORKERS, 0);
+
+void wp_worker(void const *arg)
+{
+  (void)arg;
+  for (;;) {
+    wp_job_t *j;
+    uint8_t self_done;
+
+    (void)osSemaphoreWait(wp_items, osWaitForever);
+    osMutexWait(wp_lock, osWaitForever);
+    j = wp_count ? heap_pop() : 0;
+    osMutexRelease(wp_lock);
+    if (!j) continue;
+
+    self_done = j->self_done;          /* j may be reused once fn returns */
+    TRACE(TR_JOB_START, j->id);
+    j->fn(j);
+    if (!self_done) wp_job_done(j);
+  }
+}
+
+void wp_job_done(wp_job_t *job)
+{
+  osThreadId notify = job->notify;
+  int32_t    signal = job->signal;
+
+  TRACE(TR_JOB_END, job->id);
+  wp_jobs_run++;
+  job->done = 1u;                       /* last access: the owner may reuse it */
+  if (notify) osSignalSet(notify, signal);
+}
+
+int wp_init(void)
+{
+  static const char *const names[] = { "wp0", "wp1", "wp2", "wp3", "wp4", "wp5", "wp6", "wp7" };
+  uint32_t i;
+  osThreadId id;
+
+  wp_lock  = osMutexCreate(osMutex(wp_lock));
+  wp_items = osSemaphoreCreate(osSemaphore(wp_items), 0);
+  if (!wp_lock || !wp_items) return -1;
+  for (i = 0; i < WP_WORKERS; ++i) {
+    id = osThreadCreate(osThread(wp_worker), NULL);
+    if (!id) return -1;
+    wp_tid[i] = id;
+    (void)trace_register(id, names[i & 7u]);
+  }
+  return 0;
+}
+
+osThreadId wp_worker_tid(uint32_t k)
+{
+  return (k < WP_WORKERS) ? wp_tid[k] : 0;
+}
+
+int wp_submit(wp_job_t *job)
+{
+  osMutexWait(wp_lock, osWaitForever);
+  if (wp_count >= WP_QUEUE) {
+    osMutexRelease(wp_lock);
+    return -1;
+  }
+  job->done = 0u;
+  job->seq  = wp_seq++;
+  TRACE(TR_JOB_SUBMIT, job->id);        /* before any worker can see it */
+  heap_push(job);
+  if (wp_count > wp_queue_peak) wp_queue_peak = wp_count;
+  osMutexRelease(wp_lock);
+
+  (void)osSemaphoreRelease(wp_items);
+  return 0;
+}
+
+void wp_wait(wp_job_t *job)
+{
+  while (!job->done) (void)osSignalWait(job->signal, osWaitForever);
+}
+
+uint32_t wp_pending(void)
+{
+  return wp_count;
+}
@@ -0,0 +1,51 @@
+/* COE718 Lab 3a - persistent worker-thread pool
+ *
+ * WP_WORKERS threads are created once by wp_init() and then take jobs from
+ * a priority queue for the life of the program, so thread count, TCBs and
+ * stack RAM stay constant no matter how many jobs are queued.  Higher
+ * wp_job_t.prio runs first; equal priorities run in submit order.
+ *
+ * The submitter owns the job storage until completion, which is reported
+ * by setting job->done and, if job->notify is set, job->signal on that
+ * thread; wp_wait() relies on the latter, so set notify to the waiting
+ * thread and signal to a non-zero mask.  wp_submit() never blocks: it
+ * returns -1 when WP_QUEUE jobs are already waiting.
+ *
+ * Once completion is reported the submitter may reuse the job, so nothing
+ * touches it afterwards.  A job whose fn has side effects that let the
+ * submitter move on (a task-graph node releasing its successors) sets
+ * self_done and calls wp_job_done() itself before them; the worker then
+ * leaves the job alone once fn returns.
+ */
+#pragma once
+#include "cmsis_os.h"
+#include <stdint.h>
+
+#define WP_WORKERS   3u
+#define WP_QUEUE     16u
+
+typedef struct wp_job wp_job_t;
+typedef void (*wp_fn_t)(wp_job_t *job);
+
+struct wp_job {
+  wp_fn_t           fn;
+  void             *ctx;
+  uint32_t          arg;
+  uint8_t           prio;       /* 0 = lowest */
+  uint16_t          id;         /* trace argument */
+  osThreadId        notify;     /* 0: no completion signal */
+  int32_t           signal;
+  uint32_t          seq;        /* set by wp_submit(), FIFO tie-break */
+  uint8_t           self_done;  /* 1: fn calls wp_job_done() */
+  volatile uint8_t  done;
+};
+
+int      wp_init(void);
+int      wp_submit(wp_job_t *job);
+void     wp_wait(wp_job_t *job);
+void     wp_job_done(wp_job_t *job);
+uint32_t wp_pending(void);
+osThreadId wp_worker_tid(uint32_t k);
+
+extern volatile uint32_t wp_jobs_run;        /* watch */
+extern volatile uint32_t wp_queue_peak;      /* watch: deepest queue seen */
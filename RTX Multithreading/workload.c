@@ -0,0 +1,144 @@
+/* COE718 Lab 3a - calibrated synthetic workloads, see workload.h */
+
+#include "workload.h"
+#include "hrclock.h"
+#include "cmsis_os.h"
+
+wl_cal_t g_wl;
+
+static volatile uint32_t wl_sink;       /* keeps every result live */
+static uint32_t          wl_sram[WL_SRAM_WORDS];
+
+/* 4 KB of constants in flash: (i * golden ratio) */
+#define WL_E(i)     ((uint32_t)(i) * 2654435761u)
+#define WL_4(i)     WL_E(i), WL_E((i) + 1), WL_E((i) + 2), WL_E((i) + 3)
+#define WL_16(i)    WL_4(i), WL_4((i) + 4), WL_4((i) + 8), WL_4((i) + 12)
+#define WL_64(i)    WL_16(i), WL_16((i) + 16), WL_16((i) + 32), WL_16((i) + 48)
+#define WL_256(i)   WL_64(i), WL_64((i) + 64), WL_64((i) + 128), WL_64((i) + 192)
+static const uint32_t wl_flash[WL_FLASH_WORDS] = {
+  WL_256(0), WL_256(256), WL_256(512), WL_256(768)
+};
+
+/* ------------------- Kernels (16 operations per iteration) ------------------- */
+static uint32_t wl_compute(uint32_t n, uint32_t x)
+{
+  uint32_t acc = 0u, i;
+  while (n--) {
+    for (i = 0; i < 16u; ++i) {
+      x   = x * 1664525u + 1013904223u;
+      acc += (x >> 16) * (x & 0xFFFFu);
+      acc ^= acc << 7;
+    }
+  }
+  return acc;
+}
+
+static uint32_t wl_stream(uint32_t n, uint32_t pos)
+{
+  uint32_t acc = 0u, i;
+  while (n--) {
+    for (i = 0; i < 16u; ++i) {
+      uint32_t v = wl_sram[pos];
+      wl_sram[pos] = v + acc;
+      acc += v;
+      pos = (pos + 1u) & (WL_SRAM_WORDS - 1u);
+    }
+  }
+  return acc;
+}
+
+/* 37 words = 148 bytes apart: a new 16-byte flash line on every read */
+static uint32_t wl_flash_read(uint32_t n, uint32_t pos)
+{
+  uint32_t acc = 0u, i;
+  while (n--) {
+    for (i = 0; i < 16u; ++i) {
+      acc += wl_flash[pos];
+      pos = (pos + 37u) & (WL_FLASH_WORDS - 1u);
+    }
+  }
+  return acc;
+}
+
+static uint32_t wl_branch(uint32_t n, uint32_t x)
+{
+  uint32_t a = 1u, b = 2u, i;
+  while (n--) {
+    for (i = 0; i < 16u; ++i) {
+      x = (x >> 1) ^ (-(x & 1u) & 0xD0000001u);   /* 32-bit Galois LFSR */
+      if (x & 1u)       a += b;
+      else if (x & 2u)  b ^= a;
+      else if (x & 4u)  a -= x;
+      else              b += 3u;
+    }
+  }
+  return a ^ b;
+}
+
+static uint32_t wl_ipc(uint32_t n)
+{
+  osThreadId self = osThreadGetId();
+  uint32_t i, got = 0u;
+  while (n--) {
+    for (i = 0; i < 8u; ++i) {          /* 2 kernel calls each */
+      (void)osSignalSet(self, WL_SIG_IPC);
+      got += osSignalWait(WL_SIG_IPC, 0).status == osEventSignal;
+    }
+  }
+  return got;
+}
+
+static uint32_t wl_kernel(wl_kind_t k, uint32_t n)
+{
+  static uint32_t seed = 0x12345678u;
+  seed += 0x9E3779B9u;
+  switch (k) {
+    case WL_COMPUTE: return wl_compute(n, seed);
+    case WL_SRAM:    return wl_stream(n, seed & (WL_SRAM_WORDS - 1u));
+    case WL_FLASH:   return wl_flash_read(n, seed & (WL_FLASH_WORDS - 1u));
+    case WL_BRANCH:  return wl_branch(n, seed | 1u);
+    case WL_IPC:     return wl_ipc(n);
+    default:         return 0u;
+  }
+}
+
+/* ------------------- Calibration ------------------- */
+/* best of three, so an interrupt or a preemption cannot inflate it */
+static void wl_calibrate(wl_kind_t k)
+{
+  uint32_t best = 0xFFFFFFFFu, trial;
+
+  for (trial = 0; trial < 3u; ++trial) {
+    uint32_t t0 = hrclock_cyc32(), dt;
+    wl_sink += wl_kernel(k, WL_CAL_ITERS);
+    dt = hrclock_cyc32() - t0;
+    if (dt < best) best = dt;
+  }
+  g_wl.cyc_q8[k] = (uint32_t)(((uint64_t)best << 8) / WL_CAL_ITERS);
+  if (g_wl.cyc_q8[k] == 0u) g_wl.cyc_q8[k] = 1u;
+}
+
+void wl_init(void)
+{
+  uint32_t k;
+  g_wl.hz = g_hrclock.hz;
+  for (k = 0; k < (uint32_t)WL_IPC; ++k) wl_calibrate((wl_kind_t)k);
+  g_wl.cyc_q8[WL_IPC] = 0u;             /* needs a running thread */
+}
+
+uint32_t wl_iters(wl_kind_t k, uint32_t cycles)
+{
+  if ((uint32_t)k >= (uint32_t)WL_KINDS) return 0u;
+  if (g_wl.cyc_q8[k] == 0u) wl_calibrate(k);
+  return (uint32_t)(((uint64_t)cycles << 8) / g_wl.cyc_q8[k]);
+}
+
+void wl_run_cycles(wl_kind_t k, uint32_t cycles)
+{
+  wl_sink += wl_kernel(k, wl_iters(k, cycles));
+}
+
+void wl_run_us(wl_kind_t k, uint32_t us)
+{
+  wl_run_cycles(k, (uint32_t)(((uint64_t)us * g_wl.hz) / 1000000u));
+}
@@ -0,0 +1,39 @@
+/* COE718 Lab 3a - calibrated synthetic workloads
+ *
+ * Replaces spin loops whose "work unit" has no known duration.  Each
+ * kernel's cost per iteration is measured in core cycles with DWT at boot
+ * (wl_init(), after hrclock_init()), so a load is asked for in time and
+ * stays the same length whatever the clock and flash wait states are:
+ *
+ *   WL_COMPUTE  register-only multiply/xorshift arithmetic
+ *   WL_SRAM     read-modify-write stream over a WL_SRAM_WORDS buffer
+ *   WL_FLASH    strided reads of a const table, so most reads miss the
+ *               flash accelerator's line buffers
+ *   WL_BRANCH   data-dependent branches driven by an LFSR
+ *   WL_IPC      osSignalSet/osSignalWait on the calling thread, two SVCs
+ *               per iteration; calibrated on first use, from a thread
+ *
+ * The kernels are not preemption-aware: wl_run_us() runs a fixed number
+ * of iterations, so time spent preempted comes on top.
+ */
+#pragma once
+#include <stdint.h>
+
+#define WL_SRAM_WORDS    512u           /* 2 KB */
+#define WL_FLASH_WORDS   1024u          /* 4 KB */
+#define WL_CAL_ITERS     64u
+#define WL_SIG_IPC       (1 << 10)
+
+typedef enum { WL_COMPUTE = 0, WL_SRAM, WL_FLASH, WL_BRANCH, WL_IPC, WL_KINDS } wl_kind_t;
+
+typedef struct {
+  uint32_t hz;                          /* core clock at calibration */
+  uint32_t cyc_q8[WL_KINDS];            /* cycles per iteration, Q8; 0 = not yet */
+} wl_cal_t;
+
+extern wl_cal_t g_wl;
+
+void     wl_init(void);                 /* calibrates all but WL_IPC */
+void     wl_run_us(wl_kind_t k, uint32_t us);
+void     wl_run_cycles(wl_kind_t k, uint32_t cycles);
+uint32_t wl_iters(wl_kind_t k, uint32_t cycles);